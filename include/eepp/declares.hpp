@@ -95,6 +95,15 @@
 	#define	EE_ARM
 #endif
 
+/// SIMD instruction sets available for the vertex and pixel kernels ( the vertex kernels work with single precision floats only )
+#if !defined( EE_NO_SIMD ) && !defined( EE_USE_DOUBLES )
+	#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+		#define EE_SSE2
+	#elif defined( __ARM_NEON__ ) || defined( __ARM_NEON )
+		#define EE_NEON
+	#endif
+#endif
+
 /// Activate at least one backend for the compilation
 #if !defined( EE_BACKEND_SDL_ACTIVE ) && !defined( EE_BACKEND_SFML_ACTIVE )
 	#define EE_BACKEND_SDL_ACTIVE
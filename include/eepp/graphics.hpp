@@ -5,12 +5,17 @@
 #include <eepp/graphics/blendmode.hpp>
 #include <eepp/graphics/renderer/crenderergl.hpp>
 #include <eepp/graphics/renderer/crenderergl3.hpp>
+#include <eepp/graphics/renderer/crenderernull.hpp>
 #include <eepp/graphics/renders.hpp>
 #include <eepp/graphics/cimage.hpp>
+#include <eepp/graphics/ccompressedimage.hpp>
 #include <eepp/graphics/ctexture.hpp>
 #include <eepp/graphics/ctextureloader.hpp>
+#include <eepp/graphics/ctexturecache.hpp>
+#include <eepp/graphics/cimagesaver.hpp>
 #include <eepp/graphics/ctexturefactory.hpp>
 #include <eepp/graphics/ctexturepacker.hpp>
+#include <eepp/graphics/ccollisionmask.hpp>
 #include <eepp/graphics/csubtexture.hpp>
 #include <eepp/graphics/ctextureatlas.hpp>
 #include <eepp/graphics/cglobaltextureatlas.hpp>
@@ -29,6 +34,8 @@
 #include <eepp/graphics/cconsole.hpp>
 #include <eepp/graphics/cbatchrenderer.hpp>
 #include <eepp/graphics/cglobalbatchrenderer.hpp>
+#include <eepp/graphics/cbatchrecorder.hpp>
+#include <eepp/graphics/cstaticbatch.hpp>
 #include <eepp/graphics/ctextcache.hpp>
 #include <eepp/graphics/pixelperfect.hpp>
 #include <eepp/graphics/cshader.hpp>
@@ -0,0 +1,80 @@
+#ifndef EE_GRAPHICSCBATCHRECORDER_HPP
+#define EE_GRAPHICSCBATCHRECORDER_HPP
+
+#include <eepp/graphics/cbatchrenderer.hpp>
+
+namespace EE { namespace Graphics {
+
+/** @brief A batch renderer that records the batched geometry instead of drawing it, so it can be filled from a worker thread.
+*	Every worker thread fills its own recorder ( for example one per map layer or per UI window ). The vertexs are kept in the recorder arena,
+*	and every texture, blend mode, draw mode or transform change starts a new command. Nothing is sent to OpenGL while recording.
+*	When the workers are done, the main thread draws the recorders with cBatchRecorder::Submit.
+*	A recorder must be used by one thread at a time, and SetLineWidth and SetPointSize can't be called while recording.
+*/
+class EE_API cBatchRecorder : public cBatchRenderer {
+	public:
+		/** @param Order The submission order of the recorder ( lower orders are drawn first )
+		*	@param Prealloc The number of vertexs preallocated for the batch
+		*/
+		cBatchRecorder( const Int32& Order = 0, const eeUint& Prealloc = 1024 );
+
+		~cBatchRecorder();
+
+		/** Set the submission order of the recorder */
+		void Order( const Int32& order );
+
+		/** @return The submission order of the recorder */
+		const Int32& Order() const;
+
+		/** Moves the pending batched vertexs to the arena. It must be called by the recording thread when it's done. */
+		void Finish();
+
+		/** Clears the recorded commands. The arena memory is kept for the next frame. */
+		void Clear();
+
+		/** @return The number of commands recorded */
+		Uint32 GetCommandsCount() const;
+
+		/** @return The number of vertexs recorded */
+		Uint32 GetVertexsCount() const;
+
+		/** Draws the recorded geometry. It must be called from the thread that owns the GL context, once every recorder is finished.
+		*	The recorders are drawn sorted by their order, and the recorders with the same order keep the order they were passed, so the result
+		*	doesn't depend on which worker finished first. Consecutive commands that share the same state are merged in one draw call,
+		*	even if they come from different recorders.
+		*	@param Recorders The recorders to draw
+		*	@param Count The number of recorders
+		*	@param ClearRecorders If the recorders must be cleared after drawing them
+		*/
+		static void Submit( cBatchRecorder ** Recorders, const Uint32& Count, const bool& ClearRecorders = true );
+	protected:
+		class cCommand {
+			public:
+				EE_DRAW_MODE		Mode;
+				EE_BLEND_MODE		Blend;
+				const cTexture *	Texture;
+				eeFloat				Rotation;
+				eeVector2f			Scale;
+				eeVector2f			Position;
+				eeVector2f			Center;
+				Uint32				Start;
+				Uint32				Count;
+		};
+
+		Int32					mOrder;
+		std::vector<cCommand>	mCommands;
+		std::vector<eeVertex>	mArena;
+		std::vector<eeVertex>	mMerged;
+
+		void Render( eeVertex * Vertex, const Uint32& NumVertex );
+
+		void DrawCommand( const cCommand& Cmd, eeVertex * Vertex, const Uint32& NumVertex );
+
+		static bool SameState( const cCommand& a, const cCommand& b );
+
+		static bool OrderLess( const cBatchRecorder * a, const cBatchRecorder * b );
+};
+
+}}
+
+#endif
@@ -18,8 +18,29 @@ struct eeVertex {
 	eeColorA color;
 };
 
+/** @brief The vertex sent to the GPU by the batch renderer with the packed vertex format ( 16 bytes instead of 20 ).
+*	The texture coordinates are stored as normalized 16 bits integers, so they must be in the [0,1] range.
+*/
+struct eeVertexPacked {
+	eeVector2f pos;
+	Uint16 u;
+	Uint16 v;
+	eeColorA color;
+};
+
+/** @enum EE_BATCH_VERTEX_FORMAT The vertex layout used by the batch renderer to submit the vertexs */
+enum EE_BATCH_VERTEX_FORMAT {
+	BVF_FLOAT,	//!< eeVertex, float texture coordinates
+	BVF_PACKED	//!< eeVertexPacked, normalized 16 bits texture coordinates
+};
+
 class cTextureFactory;
 class cTexture;
+class cStaticBatch;
+
+namespace Private {
+class cVertexStreamBuffer;
+}
 
 /** @brief A batch rendering class. */
 class EE_API cBatchRenderer {
@@ -37,7 +58,9 @@ class EE_API cBatchRenderer {
 		/** Set the current texture to render on the batch ( if you change the texture and you have batched something, this will be renderer immediately ) */
 		void SetTexture( const cTexture * Tex );
 
-		/** Set the predefined blending function to use on the batch */
+		/** @brief Set the predefined blending function to use on the batch
+		*	If the current texture is premultiplied ( see cTexture::Premultiplied ) ALPHA_NORMAL and ALPHA_BLENDONE are drawn with ALPHA_PREMULTIPLIED,
+		*	so the alpha and the additive sprites of premultiplied textures share the same batch. Set the texture before the blend mode. */
 		void SetBlendMode( const EE_BLEND_MODE& Blend );
 
 		/** Set if every batch call have to be immediately rendered */
@@ -91,6 +114,17 @@ class EE_API cBatchRenderer {
 		/** Add to the batch a quad with the vertex freely seted ( this will change your batch rendering method to DM_QUADS, so if you were using another one will Draw all the batched vertexs first ) */
 		void BatchQuadFreeEx( const eeFloat& x0, const eeFloat& y0, const eeFloat& x1, const eeFloat& y1, const eeFloat& x2, const eeFloat& y2, const eeFloat& x3, const eeFloat& y3, const eeFloat& Angle = 0.0f, const eeFloat& Scale = 1.0f );
 
+		/** Add to the batch an array of quads ( this will change your batch rendering method to DM_QUADS, so if you were using another one will Draw all the batched vertexs first ).
+		*	The vertexs are generated 4 quads at a time with SSE2 or NEON when available, it's the fastest way to batch many sprites ( particles, bullets ).
+		*	@param Positions The top-left corner of every quad
+		*	@param Sizes The width and height of every quad
+		*	@param Angles The rotation of every quad around its center, in degrees ( NULL to not rotate them )
+		*	@param TexCoords The texture sector ( Left, Top, Right, Bottom ) of every quad ( NULL to use the current subset )
+		*	@param Colors The color of every quad ( NULL to use the current quads color )
+		*	@param Count The number of quads
+		*/
+		void BatchQuadArray( const eeVector2f * Positions, const eeVector2f * Sizes, const eeFloat * Angles, const eeRectf * TexCoords, const eeColorA * Colors, const Uint32& Count );
+
 		/** This will set as the default batch rendering to GL_QUADS. WIll reset the texture subset rendering to the whole texture. Will reset the default color rendering to eeColorA(255,255,255,255). */
 		void QuadsBegin();
 
@@ -210,7 +244,92 @@ class EE_API cBatchRenderer {
 
 		/** @return If the blending mode switch is forced */
 		const bool& ForceBlendModeChange() const;
+
+		/** Enable or disable the deferred batching mode.
+		*	In deferred mode texture and blend mode changes don't break the batch. Quads and triangles are recorded with a ( layer, blend, texture ) key,
+		*	and when the batch is drawn they are sorted and merged by that key, keeping the submission order only between primitives that overlap.
+		*/
+		void BatchDeferred( const bool& deferred );
+
+		/** @return If the deferred batching mode is enabled */
+		const bool& BatchDeferred() const;
+
+		/** Set the layer of the primitives batched in deferred mode ( lower layers are always rendered first ) */
+		void BatchLayer( const Int32& layer ) { mLayer = layer; }
+
+		/** @return The layer of the primitives batched in deferred mode */
+		Int32 BatchLayer() const { return mLayer; }
+
+		/** @return The number of draw calls issued since the last flush stats reset */
+		const Uint32& FlushesTaken() const;
+
+		/** @return The number of draw calls saved by the deferred mode since the last flush stats reset */
+		const Uint32& FlushesAvoided() const;
+
+		/** Reset the flushes taken and avoided counters */
+		void ResetFlushStats();
+
+		/** Enable or disable the streaming upload of the batched vertexs.
+		*	When enabled the vertexs are written into a ring of vertex buffer segments instead of being submitted from client memory on every flush.
+		*	If vertex buffers aren't supported by the renderer it falls back to client arrays.
+		*	It is disabled by default.
+		*/
+		void BatchStreaming( const bool& streaming );
+
+		/** @return If the streaming upload is enabled */
+		const bool& BatchStreaming() const;
+
+		/** @return If the last flush was uploaded through the streaming vertex buffer ( false if it fell back to client arrays ) */
+		const bool& StreamingActive() const;
+
+		/** Set the vertex layout used to submit the batched vertexs.
+		*	BVF_PACKED halves the texture coordinates bandwidth, it's meant for sprites from atlases.
+		*	A flush falls back to BVF_FLOAT when it isn't textured, when a texture coordinate is outside the [0,1] range ( repeated textures )
+		*	or when the renderer can't read normalized integer texture coordinates ( the fixed pipeline renderers ).
+		*/
+		void BatchVertexFormat( const EE_BATCH_VERTEX_FORMAT& format );
+
+		/** @return The vertex layout used to submit the batched vertexs */
+		const EE_BATCH_VERTEX_FORMAT& BatchVertexFormat() const;
+
+		/** @return If the last flush was submitted with the packed vertex layout */
+		const bool& PackedActive() const;
+
+		/** Enable or disable the transform baking.
+		*	When enabled the batch rotation, scale and position are applied to the vertexs on the CPU when they are batched, instead of
+		*	being set in the modelview matrix when the batch is drawn. Primitives batched with different transforms can share the same draw call,
+		*	and the matrix stack is never touched by the batch ( the vertexs are drawn with the current modelview matrix ).
+		*/
+		void BatchBakeTransform( const bool& bake );
+
+		/** @return If the transform baking is enabled */
+		const bool& BatchBakeTransform() const;
+
+		/** Enable or disable the multi-texture batching.
+		*	When enabled, quads and triangles with up to EE_MAX_TEXTURE_UNITS different textures ( and untextured ones ) share the same draw call:
+		*	every texture is bound to its own texture unit, the unit is stored in the texture coordinates of the vertexs, and the renderer
+		*	multi-texture shader samples the right one. It needs a renderer with a multi-texture shader ( OpenGL 3 and OpenGL ES 2 ),
+		*	otherwise the batch is split by texture as usual. The primitives with texture coordinates outside the [-1,3) range are drawn by themselves.
+		*	It's not used in deferred mode.
+		*/
+		void BatchMultiTexture( const bool& multi );
+
+		/** @return If the multi-texture batching is enabled */
+		const bool& BatchMultiTexture() const;
 	protected:
+		friend class cStaticBatch;
+
+		class cDeferredPrim {
+			public:
+				Int32				Layer;
+				EE_BLEND_MODE		Blend;
+				const cTexture *	Texture;
+				Uint32				Start;
+				Uint32				Count;
+				eeRectf				Bounds;
+		};
+
+
 		eeVertex *			mVertex;
 		eeUint				mVertexSize;
 		eeVertex *			mTVertex;
@@ -219,6 +338,8 @@ class EE_API cBatchRenderer {
 		const cTexture *	mTexture;
 		cTextureFactory *	mTF;
 		EE_BLEND_MODE		mBlend;
+		EE_BLEND_MODE		mRequestedBlend;
+		bool				mAdditive;
 
 		eeTexCoord			mTexCoord[4];
 		eeColorA			mVerColor[4];
@@ -232,9 +353,58 @@ class EE_API cBatchRenderer {
 
 		bool				mForceRendering;
 		bool				mForceBlendMode;
+		bool				mDeferred;
+		Int32				mLayer;
+
+		std::vector<cDeferredPrim>	mDeferredPrims;
+		std::vector<eeVertex>		mDeferredVertex;
+
+		Uint32				mFlushesTaken;
+		Uint32				mFlushesAvoided;
+
+		bool				mStreaming;
+		bool				mStreamingActive;
+		Private::cVertexStreamBuffer * mStream;
+
+		EE_BATCH_VERTEX_FORMAT		mVertexFormat;
+		bool						mPackedActive;
+		std::vector<eeVertexPacked>	mPackedVertex;
+
+		bool				mBakeTransform;
+		bool				mRecording;
+		cStaticBatch *		mCapture;
+
+		bool				mMultiTexture;
+		bool				mSlotted;
+		const cTexture *	mSlots[ EE_MAX_TEXTURE_UNITS ];
+		Uint32				mSlotsCount;
 
 		void Flush();
 
+		bool PackVertexs( const eeVertex * Vertex, const Uint32& NumVertex );
+
+		bool HasTransform() const;
+
+		bool IsMultiTexturing() const;
+
+		bool SlotVertexs( const eeUint& num );
+
+		void FlushExcept( const eeUint& num );
+
+		void RenderMultiTexture( eeVertex * Vertex, const Uint32& NumVertex );
+
+		virtual void Render( eeVertex * Vertex, const Uint32& NumVertex );
+
+		void DeferPrimitive( const Uint32& Start, const Uint32& Count );
+
+		void DrawDeferred();
+
+		bool IsDeferring() const;
+
+		static bool DeferredSameState( const cDeferredPrim& a, const cDeferredPrim& b );
+
+		static bool DeferredLayerLess( const cDeferredPrim& a, const cDeferredPrim& b );
+
 		void Init();
 
 		void AddVertexs( const eeUint& num );
@@ -0,0 +1,60 @@
+#ifndef EE_GRAPHICSCCOLLISIONMASK_HPP
+#define EE_GRAPHICSCCOLLISIONMASK_HPP
+
+#include <eepp/graphics/base.hpp>
+
+namespace EE { namespace Graphics {
+
+/** @brief A 1 bit per pixel mask of the solid pixels of an image, used for the pixel perfect collisions.
+*	Every row is packed in 64 bits words, so the collisions are tested 64 pixels at a time.
+*	@see cSubTexture::GetCollisionMask
+*/
+class EE_API cCollisionMask {
+	public:
+		/** Creates an empty mask */
+		cCollisionMask();
+
+		/** Creates the mask of a block of pixels @see Create */
+		cCollisionMask( const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels, const Uint32& Pitch, const Uint8& AlphaThreshold = 0 );
+
+		/** @brief Creates the mask of a block of pixels.
+		*	A pixel is solid if its alpha is greater than AlphaThreshold. The images without alpha ( 1 and 3 channels ) are solid.
+		*	@param Pixels The first pixel of the block
+		*	@param Width The block width
+		*	@param Height The block height
+		*	@param Channels The number of channels of the pixels
+		*	@param Pitch The size in bytes of a row of the image that contains the block
+		*	@param AlphaThreshold The maximum alpha of the pixels that don't collide
+		*/
+		void Create( const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels, const Uint32& Pitch, const Uint8& AlphaThreshold = 0 );
+
+		/** @return The mask width */
+		const Uint32& Width() const;
+
+		/** @return The mask height */
+		const Uint32& Height() const;
+
+		/** @return If the pixel is solid ( false if the position is outside the mask ) */
+		bool IsSolid( const Int32& X, const Int32& Y ) const;
+
+		/** @brief Tests if two masks collide.
+		*	@param X The position of this mask
+		*	@param Y The position of this mask
+		*	@param Other The other mask
+		*	@param OtherX The position of the other mask
+		*	@param OtherY The position of the other mask
+		*	@return True if any solid pixel of this mask overlaps a solid pixel of the other mask.
+		*/
+		bool Collide( const Int32& X, const Int32& Y, const cCollisionMask& Other, const Int32& OtherX, const Int32& OtherY ) const;
+	protected:
+		Uint32				mWidth;
+		Uint32				mHeight;
+		Uint32				mWordsPerRow;
+		std::vector<Uint64>	mBits;
+
+		Uint64 GetBits( const Uint64 * Row, const Int32& X ) const;
+};
+
+}}
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef EE_GRAPHICSCCOMPRESSEDIMAGE_HPP
+#define EE_GRAPHICSCCOMPRESSEDIMAGE_HPP
+
+#include <eepp/graphics/base.hpp>
+
+namespace EE { namespace Graphics {
+
+/** @brief A KTX container holding pre-compressed texture blocks ( S3TC, ETC1, ETC2 or ASTC ).
+*	The blocks are uploaded directly with glCompressedTexImage2D when the GPU supports the format, so the texture uses a fraction of the memory and upload bandwidth of RGBA8.
+*	When the format is not supported the blocks can be decompressed to RGBA8 in software ( every format except ASTC ).
+*	The texture loader recognizes the KTX files automatically, and the images can be saved as KTX with SAVE_TYPE_KTX ( compressed to S3TC ).
+*/
+class EE_API cCompressedImage {
+	public:
+		enum CompressionType {
+			COMPRESSION_UNKNOWN,
+			COMPRESSION_S3TC,
+			COMPRESSION_ETC1,
+			COMPRESSION_ETC2,
+			COMPRESSION_ASTC
+		};
+
+		/** @return If the data in memory starts with the KTX identifier */
+		static bool IsCompressedImage( const Uint8 * Data, const Uint32& Size );
+
+		/** @return If the file is a KTX container */
+		static bool IsCompressedImage( const std::string& Filepath );
+
+		/** @brief Compresses the pixels to S3TC and saves them in a KTX container.
+		*	The images with alpha channel are compressed to DXT5, the images without alpha to DXT1. */
+		static bool Save( const std::string& Filepath, const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels );
+
+		cCompressedImage();
+
+		/** Reads the KTX container from memory. The data is not copied, it must live while the image is used. */
+		bool LoadFromMemory( const Uint8 * Data, const Uint32& Size );
+
+		/** @return The width of the first level */
+		const Uint32& Width() const;
+
+		/** @return The height of the first level */
+		const Uint32& Height() const;
+
+		/** @return The OpenGL internal format of the blocks */
+		const Uint32& InternalFormat() const;
+
+		/** @return The family of the compression format */
+		CompressionType Type() const;
+
+		/** @return The number of mipmap levels in the container */
+		Uint32 LevelsCount() const;
+
+		/** @return 4 if the format has an alpha channel, 3 otherwise */
+		Uint32 Channels() const;
+
+		/** @return The size of the compressed blocks of every level */
+		Uint32 DataSize() const;
+
+		/** @return If the GPU can use the compressed blocks directly */
+		bool IsSupported() const;
+
+		/** @return If the blocks can be decompressed in software */
+		bool CanDecompress() const;
+
+		/** @return If the levels of the container can be sampled with a mipmap filter.
+		*	A container can store only the first levels of the mip chain, those are only usable if the maximum level of the texture can be set, or if the chain reaches 1x1.
+		*/
+		bool CanMipmap() const;
+
+		/** @brief Creates a new OpenGL texture with the compressed blocks.
+		*	@param Mipmaps Upload the mipmap levels of the container ( if CanMipmap )
+		*	@param ClampMode The texture clamp mode
+		*	@return The OpenGL texture id or 0 if the upload failed
+		*/
+		Uint32 Upload( const bool& Mipmaps, const EE_CLAMP_MODE& ClampMode ) const;
+
+		/** @brief Decompresses a level to RGBA8.
+		*	@return The pixels allocated with malloc, or NULL if the format can't be decompressed. The caller must free them. */
+		Uint8 * Decompress( const Uint32& Level = 0 ) const;
+	protected:
+		const Uint8 *		mData;
+		Uint32				mSize;
+		Uint32				mWidth;
+		Uint32				mHeight;
+		Uint32				mFormat;
+		std::vector<Uint32>	mLevelOffset;
+		std::vector<Uint32>	mLevelSize;
+};
+
+}}
+
+#endif
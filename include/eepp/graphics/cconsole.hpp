@@ -224,6 +224,9 @@ class EE_API cConsole : protected iLogReader {
 		/** Internal Callback for default command ( hide ) */
 		void CmdHideConsole( const std::vector < String >& params );
 
+		/** Internal Callback for default command ( profiler ) */
+		void CmdProfiler( const std::vector < String >& params );
+
 		/** The Default Commands Callbacks for the Console ( don't call it ) */
 		void PrivInputCallback( InputEvent * Event );
 
@@ -6,16 +6,110 @@
 
 namespace EE { namespace Graphics {
 
+class cImage;
+
+namespace Private { class cTextureAtlasPage; }
+
+/** @brief The occupancy statistics of the runtime atlas pages */
+class EE_API cAtlasPageStats {
+	public:
+		cAtlasPageStats();
+
+		/** Number of pages */
+		Uint32	Pages;
+
+		/** Number of SubTextures packed in the pages */
+		Uint32	SubTextures;
+
+		/** Total area of the pages ( in pixels ) */
+		Uint32	TotalArea;
+
+		/** Area used by the packed images, including the pixel border ( in pixels ) */
+		Uint32	UsedArea;
+
+		/** Number of free rectangles left in the pages */
+		Uint32	FreeRects;
+
+		/** Area of the largest free rectangle ( in pixels ) */
+		Uint32	LargestFreeArea;
+
+		/** UsedArea / TotalArea */
+		eeFloat	Occupancy;
+
+		/** 1 - LargestFreeArea / free area. 0 means that all the free space is in one rectangle, near 1 means that the free space is split in many small rectangles. */
+		eeFloat	Fragmentation;
+};
+
 /** @brief Any SubTexture that doesn't belong to an specific TextureAtlas ( a real texture atlas texture ), goes here.
 	This is useful to auto release the SubTextures.
+	The global texture atlas can also pack small loose textures at runtime into shared texture pages ( see RuntimeAtlasing ), so the sprites
+	that use different image files can be batched together.
 */
 class EE_API cGlobalTextureAtlas : public cTextureAtlas {
 	SINGLETON_DECLARE_HEADERS(cGlobalTextureAtlas)
 
 	public:
 		~cGlobalTextureAtlas();
+
+		/** Enables or disables the runtime atlasing ( disabled by default ).
+		*	When disabled Pack will create a SubTexture from a loose texture, as always. */
+		void RuntimeAtlasing( const bool& enable );
+
+		/** @return If the runtime atlasing is enabled */
+		const bool& RuntimeAtlasing() const;
+
+		/** Sets the runtime atlas options. The page size can only be changed before the first page is created.
+		*	@param PageWidth The width of every page texture.
+		*	@param PageHeight The height of every page texture.
+		*	@param MaxSize The images with a width or height bigger than this are not packed, they keep their own texture.
+		*	@param PixelBorder The pixels added to separate one image to another. Use at least 1 pixel if the SubTextures will be scaled.
+		*/
+		void RuntimeAtlasOptions( const Uint32& PageWidth = 1024, const Uint32& PageHeight = 1024, const Uint32& MaxSize = 256, const Uint32& PixelBorder = 1 );
+
+		/** Packs an image into a runtime atlas page, a new page is created if it doesn't fit in any page.
+		*	@return The SubTexture that represents the image, NULL if the runtime atlasing is disabled or the image is too big.
+		*/
+		cSubTexture * Pack( cImage * Img, const std::string& Name );
+
+		/** Loads an image file and packs it into a runtime atlas page.
+		*	If the runtime atlasing is disabled or the image is too big it is loaded as a loose texture, and the SubTexture will use the full texture.
+		*	@param Filepath The image path
+		*	@param Name The SubTexture name ( the file name without extension if empty )
+		*/
+		cSubTexture * Pack( const std::string& Filepath, const std::string& Name = "" );
+
+		/** Copies an already loaded texture into a runtime atlas page.
+		*	If the runtime atlasing is disabled or the texture is too big, the SubTexture will use the full texture.
+		*	@param TexId The texture id
+		*	@param Name The SubTexture name ( the texture file name without extension if empty )
+		*	@param RemoveTexture Removes the loose texture from the texture factory once copied.
+		*/
+		cSubTexture * Pack( const Uint32& TexId, const std::string& Name = "", const bool& RemoveTexture = true );
+
+		/** @return The number of runtime atlas pages */
+		Uint32 GetPagesCount() const;
+
+		/** @return The texture of the runtime atlas page */
+		cTexture * GetPage( const Uint32& Index ) const;
+
+		/** @return The statistics of a runtime atlas page */
+		cAtlasPageStats GetPageStats( const Uint32& Index ) const;
+
+		/** @return The statistics of all the runtime atlas pages */
+		cAtlasPageStats GetPagesStats() const;
 	protected:
+		std::vector<Private::cTextureAtlasPage*>	mPages;
+		Uint32										mPageWidth;
+		Uint32										mPageHeight;
+		Uint32										mMaxSize;
+		Uint32										mPixelBorder;
+		bool										mRuntimeAtlasing;
+
 		cGlobalTextureAtlas();
+
+		bool CanPack( cImage * Img ) const;
+
+		void AddPageStats( cAtlasPageStats& Stats, Private::cTextureAtlasPage * Page ) const;
 };
 
 }}
@@ -27,6 +27,13 @@ class EE_API cImage {
 		/** Set the save quality of Jpeg files ( between 0 and 100 )  */
 		static void JpegQuality( Uint32 level );
 
+		/** @return The current PNG compression level */
+		static Int32 PngCompressionLevel();
+
+		/** @brief Set the zlib compression level of PNG files ( between 0 and 9, 6 by default ).
+		**	The levels 1 to 3 encode several times faster at the cost of slightly bigger files, useful for screenshots. */
+		static void PngCompressionLevel( Int32 level );
+
 		/** @return The File Extension of a Save Type */
 		static std::string SaveTypeToExtension( const Int32& Format );
 
@@ -129,6 +136,10 @@ class EE_API cImage {
 		/** Save the Image to a new File in a specific format */
 		virtual bool SaveToFile( const std::string& filepath, const EE_SAVE_TYPE& Format );
 
+		/** @brief Save the Image to a new File in a background thread.
+		**	The pixels are copied, so the image can be modified or released immediately. @see cImageSaver */
+		void SaveToFileAsync( const std::string& filepath, const EE_SAVE_TYPE& Format );
+
 		/** Create an Alpha mask from a Color */
 		virtual void CreateMaskFromColor( const eeColorA& ColorKey, Uint8 Alpha );
 
@@ -153,9 +164,28 @@ class EE_API cImage {
 		/** Flip the image ( rotate the image 90º ) */
 		virtual void Flip();
 
+		/** Flip the image vertically ( the first row becomes the last row ) */
+		virtual void FlipVertical();
+
+		/** Multiply the color channels by the alpha channel. Only the images with alpha ( 2 and 4 channels ) are modified. */
+		virtual void PremultiplyAlpha();
+
+		/** Reorder the channels of the image, every parameter is the index of the source channel used for that channel.
+		**	For example SwizzleChannels( 2, 1, 0, 3 ) converts a RGBA image to BGRA. The indexes of the channels that the image doesn't have are ignored. */
+		virtual void SwizzleChannels( const Uint8& R, const Uint8& G, const Uint8& B, const Uint8& A = 3 );
+
 		/** Create a thumnail of the image */
 		cImage * Thumbnail( const Uint32& maxWidth, const Uint32& maxHeight, EE_RESAMPLER_FILTER filter = RESAMPLER_LANCZOS4 );
 
+		/** @brief Creates the next mipmap level of the image ( half the size of the image, at least 1x1 ).
+		**	The box filter keeps the pixel art sharp, the other filters give smoother mipmaps.
+		**	@return The new image, or NULL if the image is already 1x1. The caller must release it. */
+		cImage * CreateMipmap( EE_RESAMPLER_FILTER filter = RESAMPLER_BOX );
+
+		/** @brief Creates the complete mip chain of the image down to 1x1, every level is resampled from the previous one.
+		**	@return The mipmap levels without the image itself, the biggest first. The caller must release them. */
+		std::vector<cImage*> CreateMipmaps( EE_RESAMPLER_FILTER filter = RESAMPLER_BOX );
+
 		/** Creates a cropped image from the current image */
 		cImage * Crop( eeRecti rect );
 
@@ -175,6 +205,7 @@ class EE_API cImage {
 		cImage& operator =(const cImage& right);
 	protected:
 		static Uint32 sJpegQuality;
+		static Int32 sPngCompressionLevel;
 
 		Uint8 *			mPixels;
 		eeUint 			mWidth;
@@ -0,0 +1,41 @@
+#ifndef EE_GRAPHICSCIMAGESAVER_HPP
+#define EE_GRAPHICSCIMAGESAVER_HPP
+
+#include <eepp/graphics/base.hpp>
+
+namespace EE { namespace Graphics {
+
+class cImage;
+
+/** @brief Saves images to disk in background threads, so the caller doesn't wait for the image encoding.
+*	Used by cImage::SaveToFileAsync and cWindow::TakeScreenshot. The pending images are saved before the saver is destroyed.
+*/
+class EE_API cImageSaver {
+	SINGLETON_DECLARE_HEADERS(cImageSaver)
+
+	public:
+		~cImageSaver();
+
+		/** @brief Saves the image in a background thread.
+		*	The saver takes the ownership of the image, it's released after saving it. */
+		void Save( cImage * Img, const std::string& Filepath, const EE_SAVE_TYPE& Format );
+
+		/** @return The number of images that are still being saved */
+		Uint32 GetPendingCount();
+
+		/** Blocks until all the pending images are saved */
+		void Wait();
+	protected:
+		class cSaveJob;
+
+		std::list<cSaveJob*>	mJobs;
+		cMutex					mMutex;
+
+		cImageSaver();
+
+		void RemoveFinished( const bool& Wait );
+};
+
+}}
+
+#endif
@@ -37,13 +37,13 @@ class EE_API cScrollParallax {
 		bool Create( cSubTexture * SubTexture, const eeVector2f& Position = eeVector2f(), const eeSizef& Size = eeSizef(), const eeVector2f& Speed = eeVector2f(), const eeColorA& Color = eeColorA(), const EE_BLEND_MODE& Blend = ALPHA_NORMAL );
 
 		/** Set the parallax texture color. */
-		void Color( const eeColorA& Color ) { mColor = Color; }
+		void Color( const eeColorA& Color ) { mColor = Color; mVersion++; }
 
 		/** Get the parallax texture color. */
 		eeColorA Color() const { return mColor; }
 
 		/** Set the Blend Mode used. */
-		void BlendMode( const EE_BLEND_MODE& Blend ) { mBlend = Blend; }
+		void BlendMode( const EE_BLEND_MODE& Blend ) { mBlend = Blend; mVersion++; }
 
 		/** @return The Blend Mode used for the parallax. */
 		const EE_BLEND_MODE& BlendMode() const { return mBlend; }
@@ -76,6 +76,10 @@ class EE_API cScrollParallax {
 		
 		/** @return The parallax movement speed. */
 		const eeVector2f& Speed() const;
+
+		/** @return The version of the parallax, it changes every time a property of the parallax is modified.
+		*	A static parallax ( without speed ) can be recorded in a cStaticBatch and recorded again only when the version changes. */
+		const Uint32& Version() const;
 	private:
 		cSubTexture * 		mSubTexture;
 		EE_BLEND_MODE		mBlend;
@@ -89,6 +93,7 @@ class EE_API cScrollParallax {
 		eeVector2i			mTiles;
 		eeRectf				mAABB;
 		eeSizef				mRealSize;
+		Uint32				mVersion;
 		
 		void SetSubTexture();
 		
@@ -0,0 +1,98 @@
+#ifndef EE_GRAPHICSCSTATICBATCH_HPP
+#define EE_GRAPHICSCSTATICBATCH_HPP
+
+#include <eepp/graphics/cbatchrenderer.hpp>
+
+namespace EE { namespace Graphics {
+
+class cVertexBuffer;
+
+/** @brief Records the geometry sent to a batch renderer once and keeps it in static vertex buffers, so it can be drawn again without batching it every frame.
+*	Any draw call that goes through the batch renderer between Begin and End is captured instead of drawn ( SubTextures, primitives, text, etc ).
+*	Every texture, blend mode or draw mode change starts a new vertex buffer, consecutive captures with the same state are merged.
+*	The static batch must be recorded again when the source content changes, it can be invalidated explicitly or by the version of the source:
+*	@code
+*	if ( !StaticBatch.IsValid( Parallax.Version() ) ) {
+*		StaticBatch.Begin( Parallax.Version() );
+*		Parallax.Draw();
+*		StaticBatch.End();
+*	}
+*
+*	StaticBatch.Draw();
+*	@endcode
+*	The line width and the point size are not recorded.
+*/
+class EE_API cStaticBatch {
+	public:
+		cStaticBatch();
+
+		~cStaticBatch();
+
+		/** Starts recording the geometry sent to the batch renderer. The previous recorded geometry is released.
+		*	@param SourceVersion The version of the recorded content ( see IsValid )
+		*	@param Source The batch renderer to capture ( the global batch renderer if NULL )
+		*/
+		void Begin( const Uint32& SourceVersion = 0, cBatchRenderer * Source = NULL );
+
+		/** Stops the recording and uploads the recorded geometry to the vertex buffers */
+		void End();
+
+		/** @return If the static batch is recording */
+		const bool& IsRecording() const;
+
+		/** Draws the recorded geometry */
+		void Draw();
+
+		/** Draws the recorded geometry moved by an offset */
+		void Draw( const eeVector2f& Offset );
+
+		/** Releases the recorded geometry, the static batch must be recorded again */
+		void Invalidate();
+
+		/** @return If the static batch was recorded and not invalidated */
+		bool IsValid() const;
+
+		/** @return If the static batch was recorded with the source version indicated and not invalidated */
+		bool IsValid( const Uint32& SourceVersion ) const;
+
+		/** @return The source version of the recorded geometry */
+		const Uint32& SourceVersion() const;
+
+		/** @return The number of vertex buffers ( draw calls ) of the static batch */
+		Uint32 GetCommandsCount() const;
+
+		/** @return The number of vertexs recorded */
+		Uint32 GetVertexsCount() const;
+	protected:
+		friend class cBatchRenderer;
+
+		class cCommand {
+			public:
+				EE_DRAW_MODE		Mode;
+				EE_BLEND_MODE		Blend;
+				Uint32				TexId;
+				Uint32				Start;
+				Uint32				Count;
+				cVertexBuffer *		Buffer;
+		};
+
+		cBatchRenderer *		mSource;
+		std::vector<cCommand>	mCommands;
+		std::vector<eeVertex>	mVertexs;
+		Uint32					mVertexsCount;
+		Uint32					mSourceVersion;
+		bool					mRecording;
+		bool					mValid;
+
+		void Capture( const EE_DRAW_MODE& Mode, const EE_BLEND_MODE& Blend, const cTexture * Texture, const eeVertex * Vertex, const Uint32& NumVertex );
+
+		void Build();
+
+		void Release();
+
+		static bool CanMerge( const EE_DRAW_MODE& Mode );
+};
+
+}}
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <eepp/graphics/base.hpp>
 #include <eepp/graphics/ctexture.hpp>
+#include <eepp/graphics/ccollisionmask.hpp>
 #include <eepp/math/originpoint.hpp>
 
 namespace EE { namespace Graphics {
@@ -104,6 +105,15 @@ class EE_API cSubTexture {
 		/** Creates a copy in memory from the texture loaded in VRAM.  */
 		void CacheColors();
 
+		/** @brief Creates the collision mask of the SubTexture ( 1 bit per pixel ) from the texture loaded in VRAM.
+		*	It uses the local copy of the texture if there is one, otherwise the texture is downloaded from VRAM.
+		*	@param AlphaThreshold The maximum alpha of the pixels that don't collide
+		*	@see cTextureAtlas::CacheCollisionMasks */
+		void CacheCollisionMask( const Uint8& AlphaThreshold = 0 );
+
+		/** @return The collision mask of the SubTexture, it's created if it wasn't cached before. */
+		const cCollisionMask * GetCollisionMask();
+
 		/** @return The alpha value that corresponds to the position indicated in the SubTexture.
 		*	If the SubTexture wasn't locked before this call, it will be locked automatically. */
 		Uint8 GetAlphaAt( const Int32& X, const Int32& Y );
@@ -117,7 +127,7 @@ class EE_API cSubTexture {
 		*/
 		void SetColorAt( const Int32& X, const Int32& Y, const eeColorA& Color );
 
-		/** Deletes the texture buffer from memory ( not from VRAM ) if it was cached before ( using Lock() ). */
+		/** Deletes the texture buffer, the alpha mask and the collision mask from memory ( not from VRAM ) if they were cached before. */
 		void ClearCache();
 
 		/** @brief Locks the texture to be able to perform read/write operations.
@@ -146,6 +156,7 @@ class EE_API cSubTexture {
 	protected:
 		Uint8 *		mPixels;
 		Uint8 *		mAlpha;
+		cCollisionMask * mCollisionMask;
 		std::string mName;
 		Uint32		mId;
 		Uint32 		mTexId;
@@ -127,6 +127,16 @@ class EE_API cTexture : public cImage, private NonCopyable {
 		/** Flip the texture ( rotate the texture 90º ). Warning: This is flipped in memory, a real flipping. */
 		void Flip();
 
+		/** Flip the texture vertically. Warning: This is flipped in memory, a real flipping. */
+		void FlipVertical();
+
+		/** Multiply the color channels of the texture by its alpha channel.
+		*	The texture is marked as premultiplied, calling it again does nothing. */
+		void PremultiplyAlpha();
+
+		/** Reorder the channels of the texture @see cImage::SwizzleChannels */
+		void SwizzleChannels( const Uint8& R, const Uint8& G, const Uint8& B, const Uint8& A = 3 );
+
 		/** @return If the Texture has a copy on the local memory */
 		bool LocalCopy();
 
@@ -139,6 +149,13 @@ class EE_API cTexture : public cImage, private NonCopyable {
 		/** @return If the texture is Grabed */
 		bool Grabed() const;
 
+		/** @brief Set if the color channels of the texture are premultiplied by its alpha channel.
+		*	The batch renderer draws the premultiplied textures with ALPHA_PREMULTIPLIED instead of ALPHA_NORMAL and ALPHA_BLENDONE. */
+		void Premultiplied( const bool& isPremultiplied );
+
+		/** @return If the color channels of the texture are premultiplied by its alpha channel */
+		bool Premultiplied() const;
+
 		/** @return If the texture was compressed on load (DXT compression) */
 		bool IsCompressed() const;
 
@@ -233,7 +250,8 @@ class EE_API cTexture : public cImage, private NonCopyable {
 			TEX_FLAG_MODIFIED	=	( 1 << 1 ),
 			TEX_FLAG_COMPRESSED	=	( 1 << 2 ),
 			TEX_FLAG_LOCKED		= 	( 1 << 3 ),
-			TEX_FLAG_GRABED		=	( 1 << 4 )
+			TEX_FLAG_GRABED		=	( 1 << 4 ),
+			TEX_FLAG_PREMULTIPLIED	=	( 1 << 5 )
 		};
 
 		friend class cTextureFactory;
@@ -77,6 +77,11 @@ class EE_API cTextureAtlas : public tResourceManager<cSubTexture> {
 
 		/** @return The number of textures linked to the texture atlas. */
 		Uint32 GetTexturesCount();
+
+		/** @brief Creates the collision masks of all the SubTextures ( see cSubTexture::CacheCollisionMask ).
+		*	Every texture of the atlas is downloaded from VRAM only once. Call it after loading the texture atlas to avoid creating the masks in the first collision test.
+		*	@param AlphaThreshold The maximum alpha of the pixels that don't collide */
+		void CacheCollisionMasks( const Uint8& AlphaThreshold = 0 );
 	protected:
 		friend class cTextureAtlasLoader;
 
@@ -0,0 +1,91 @@
+#ifndef EE_GRAPHICSCTEXTURECACHE_HPP
+#define EE_GRAPHICSCTEXTURECACHE_HPP
+
+#include <eepp/graphics/base.hpp>
+
+namespace EE { namespace System { class cMappedFile; } }
+
+namespace EE { namespace Graphics {
+
+class cImage;
+
+#define EE_TEXTURE_CACHE_MAGIC ( ( 'E' << 0 ) | ( 'E' << 8 ) | ( 'T' << 16 ) | ( 'C' << 24 ) )
+
+/** @brief A persistent disk cache of the decoded textures.
+*	The texture loader saves the decoded pixels of the images loaded from files and packs, and the next time the same image is loaded
+*	the pixels are uploaded directly from the cache file mapped in memory, skipping the image decoding.
+*	The cache entries are keyed by the source path, the source modification date ( the pack modification date for the files inside a pack ), the color key
+*	and the mipmap filter, so a modified image is decoded again. The mip chains generated by the loader are saved after the image pixels. The compressed textures ( DDS, PVR, PKM and KTX ) are uploaded directly and never cached.
+*	The cache is disabled by default:
+*	@code
+*	cTextureCache::instance()->CachePath( Sys::GetConfigPath( "mygame" ) + "texcache/" );
+*	cTextureCache::instance()->Enabled( true );
+*	@endcode
+*/
+class EE_API cTextureCache {
+	SINGLETON_DECLARE_HEADERS(cTextureCache)
+
+	public:
+		~cTextureCache();
+
+		/** Enables or disables the texture cache */
+		void Enabled( const bool& enabled );
+
+		/** @return If the texture cache is enabled */
+		const bool& Enabled() const;
+
+		/** Sets the directory where the cache files are saved ( by default a directory inside the system temporary path ) */
+		void CachePath( const std::string& path );
+
+		/** @return The directory where the cache files are saved */
+		const std::string& CachePath() const;
+
+		/** Removes all the cache files */
+		void Clear();
+
+		/** @brief Maps a cache entry in memory.
+		*	@param Source The path of the source image
+		*	@param SourceDate The modification date of the source image
+		*	@param Options The load options that change the decoded pixels
+		*	@param Width Returns the image width
+		*	@param Height Returns the image height
+		*	@param Channels Returns the image number of channels
+		*	@param Pixels Returns the pointer to the pixels inside the mapped file
+		*	@param Levels Returns the number of levels saved ( the mipmap levels follow the image pixels, every level half the size of the previous one )
+		*	@return The mapped cache file, or NULL if the entry doesn't exist or it's outdated. The caller must delete it after using the pixels.
+		*/
+		cMappedFile * Open( const std::string& Source, const Uint32& SourceDate, const Uint32& Options, int * Width, int * Height, int * Channels, const Uint8 ** Pixels, Uint32 * Levels );
+
+		/** @brief Saves the decoded pixels of a source image in the cache
+		*	@param Mipmaps The mipmap levels of the image ( optional ) */
+		bool Store( const std::string& Source, const Uint32& SourceDate, const Uint32& Options, const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels, const std::vector<cImage*> * Mipmaps = NULL );
+
+		/** @return The size of an image and its mipmap levels */
+		static Uint32 GetLevelsSize( const Uint32& Width, const Uint32& Height, const Uint32& Channels, const Uint32& Levels );
+	protected:
+		cTextureCache();
+
+		/** The cache file header, the pixels start at DataOffset */
+		struct sCacheHdr {
+			Uint32	Magic;
+			Uint32	Version;
+			Uint32	SourceHash;
+			Uint32	SourceDate;
+			Uint32	Options;
+			Uint32	Width;
+			Uint32	Height;
+			Uint32	Channels;
+			Uint32	DataOffset;
+			Uint32	DataSize;
+			Uint32	Levels;
+		};
+
+		bool			mEnabled;
+		std::string		mCachePath;
+
+		std::string GetEntryPath( const std::string& Source, const Uint32& Options ) const;
+};
+
+}}
+
+#endif
@@ -4,9 +4,12 @@
 #include <eepp/graphics/base.hpp>
 #include <eepp/system/cobjectloader.hpp>
 
+namespace EE { namespace System { class cMappedFile; } }
+
 namespace EE { namespace Graphics {
 
 class cTexture;
+class cImage;
 
 /** @brief The Texture loader loads a texture in synchronous or asynchronous mode.
 @see cObjectLoader
@@ -69,10 +72,23 @@ class EE_API cTextureLoader : public cObjectLoader {
 		/** A color key can be set to be transparent in the texture. This must be set before the loading is done. */
 		void			SetColorKey( eeColor Color );
 
+		/** @brief Generates the mipmaps in the loader thread with the filter indicated, instead of letting the GL driver generate them.
+		**	The box filter keeps the pixel art sharp. Only used if the texture is loaded with mipmaps. This must be set before the loading is done.
+		**	The mip chain is saved with the decoded pixels in the texture cache ( if enabled ). */
+		void			SetMipmapFilter( const EE_RESAMPLER_FILTER& filter );
+
+		/** @brief Multiplies the color channels by the alpha channel in the loader thread, the texture is marked as premultiplied ( see cTexture::Premultiplied ).
+		**	Only the textures with alpha are premultiplied ( the compressed textures uploaded directly are not modified ).
+		**	The pixels of the textures loaded from pixels are modified in place, as with the color key. This must be set before the loading is done. */
+		void			SetPremultiplyAlpha( const bool& premultiply );
+
 		/** This must be called for the asynchronous mode to update the texture data to the GPU, the call must be done from the same thread that the GL context was created ( the main thread ).
 		** @see cObjectLoader::Update */
 		void 			Update();
 
+		/** @return If the texture was decoded and it's waiting the Update call to be uploaded to the GPU */
+		bool			IsWaitingUpdate();
+
 		/** @brief Releases the texture loaded ( if was already loaded ), it will destroy the texture from memory. */
 		void			Unload();
 
@@ -111,14 +127,31 @@ class EE_API cTextureLoader : public cObjectLoader {
 
 		void			Reset();
 	private:
-		bool			mTexLoaded;
+		volatile bool	mTexLoaded;
 		bool			mDirectUpload;
 		int				mImgType;
 		int				mIsCompressed;
+		bool			mColorKeyApplied;
+		cMappedFile *	mCacheFile;
+		bool			mCpuMipmaps;
+		EE_RESAMPLER_FILTER	mMipmapFilter;
+		std::vector<cImage*>	mMipmaps;
+		bool			mPremultiplyAlpha;
+		bool			mAlphaPremultiplied;
 
 		cClock			mTE;
 
 		void			LoadFile();
+		void			LoadCompressedImage();
+		bool			LoadFromCache();
+		void			StoreInCache();
+		bool			GetCacheSource( std::string& Source, Uint32& SourceDate );
+		Uint32			GetCacheOptions();
+		void			ApplyColorKey();
+		void			ApplyPremultiplyAlpha();
+		void			GenerateMipmaps();
+		void			UploadMipmaps();
+		void			ReleaseMipmaps();
 		void 			LoadFromPath();
 		void			LoadFromMemory();
 		void			LoadFromPack();
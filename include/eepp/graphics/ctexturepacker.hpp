@@ -37,15 +37,23 @@
 namespace EE { namespace Graphics {
 class cImage;
 
-namespace Private { class cTexturePackerNode; class cTexturePackerTex; }
+namespace Private { class cTexturePackerNode; class cTexturePackerTex; class cTexturePackerSaveJob; }
 
 using namespace Private;
 
 /** @brief The Texture Packer class is used to create new Texture Atlases.
 *	Atlases can be created indicating the texture atlas size and adding textures to the atlases.
+*	The textures that don't fit in the atlas are packed in new pages ( child atlases ). The pages are composed and saved in parallel, one thread per CPU.
 */
 class EE_API cTexturePacker {
 	public:
+		/** The algorithm used to place the textures in the atlas */
+		enum PackMethod {
+			PackFreeList,		//!< Best fit in a free list of nodes, counting the shared edges
+			PackMaxRectsBSSF,	//!< MaxRects, places every texture in the free rectangle that leaves the shortest side left over
+			PackMaxRectsBAF		//!< MaxRects, places every texture in the free rectangle that leaves the smallest area left over
+		};
+
 		/** Creates a new texture packer ( you will need to call SetOptions before adding any texture or image ). */
 		cTexturePacker();
 
@@ -55,8 +63,9 @@ class EE_API cTexturePacker {
 		*	@param ForcePowOfTwo Indicates that if the max with and height must be adjusted to fit a power of two texture.
 		*	@param PixelBorder Indicates how many pixels will be added to separate one image to another in the texture atlas. Usefull to avoid artifacts when rendered scaled SubTextures. Use at least 1 pixel to separate images if you will scale any SubTexture.
 		*	@param AllowFlipping Indicates if the images can be flipped inside the texture atlas. This is not compatible with eepp ( since it can't flip the textures back to the original orientation ). So avoid it for eepp.
+		*	@param Method The packing algorithm. The MaxRects methods create fewer and denser pages with big sets of textures.
 		*/
-		cTexturePacker( const Uint32& MaxWidth, const Uint32& MaxHeight, const bool& ForcePowOfTwo = true, const Uint32& PixelBorder = 0, const bool& AllowFlipping = false );
+		cTexturePacker( const Uint32& MaxWidth, const Uint32& MaxHeight, const bool& ForcePowOfTwo = true, const Uint32& PixelBorder = 0, const bool& AllowFlipping = false, const PackMethod& Method = PackFreeList );
 
 		~cTexturePacker();
 
@@ -76,11 +85,19 @@ class EE_API cTexturePacker {
 		/** @brief Save the texture atlas to a file, in the indicated format.
 		*	If PackTexture() has not been called, it will be called automatically by the function ( so you don't need to call it ).
 		*	@param Filepath The path were it will be saved the new texture atlas.
-		*	@param Format The image format of the new texture atlas.
+		*	@param Format The image format of the new texture atlas. SAVE_TYPE_DDS and SAVE_TYPE_KTX save the atlas compressed to S3TC, so it's uploaded directly to the GPU when the format is supported.
 		*	@param SaveExtensions Indicates if the extensions of the image files must be saved. Usually you wan't to find the SubTextures by its name without extension, but this can be changed here.
 		*/
 		void Save( const std::string& Filepath, const EE_SAVE_TYPE& Format = SAVE_TYPE_PNG, const bool& SaveExtensions = false );
 
+		/** @brief Save the texture atlas reusing the layout of the texture atlas previously saved in the same path ( incremental rebuild ).
+		*	The textures that kept their name and size keep their place, the new and resized textures are placed in the free space ( or in new pages ), and only the rectangles of the modified textures are rewritten.
+		*	The pages without changes are not encoded again. This must be called instead of PackTextures and Save.
+		*	If there isn't a previous texture atlas, or it was created with different options, the texture atlas is packed and saved from scratch.
+		*	@return True if the previous layout was reused.
+		*/
+		bool SaveIncremental( const std::string& Filepath, const EE_SAVE_TYPE& Format = SAVE_TYPE_PNG, const bool& SaveExtensions = false );
+
 		/** Clear all the textures added */
 		void Close();
 
@@ -91,8 +108,9 @@ class EE_API cTexturePacker {
 		*	@param ForcePowOfTwo Indicates that if the max with and height must be adjusted to fit a power of two texture.
 		*	@param PixelBorder Indicates how many pixels will be added to separate one image to another in the texture atlas. Usefull to avoid artifacts when rendered scaled SubTextures. Use at least 1 pixel to separate images if you will scale any SubTexture.
 		*	@param AllowFlipping Indicates if the images can be flipped inside the texture atlas. This is not compatible with eepp ( since it can't flip the textures back to the original orientation ). So avoid it for eepp.
+		*	@param Method The packing algorithm. The MaxRects methods create fewer and denser pages with big sets of textures.
 		*/
-		void SetOptions( const Uint32& MaxWidth, const Uint32& MaxHeight, const bool& ForcePowOfTwo = true, const Uint32& PixelBorder = 0, const bool& AllowFlipping = false );
+		void SetOptions( const Uint32& MaxWidth, const Uint32& MaxHeight, const bool& ForcePowOfTwo = true, const Uint32& PixelBorder = 0, const bool& AllowFlipping = false, const PackMethod& Method = PackFreeList );
 
 		/** @return The texture atlas to generate width. */
 		const Int32& Width() const;
@@ -102,7 +120,28 @@ class EE_API cTexturePacker {
 
 		/** @return If the texture atlas has already been saved, returns the file path to the texture atlas. */
 		const std::string& GetFilepath() const;
+
+		/** @return The packing algorithm used */
+		const PackMethod& GetPackMethod() const;
+
+		/** @brief Set if the color channels of the pages must be premultiplied by the alpha channel when saved.
+		*	The texture atlas loader marks the textures of the atlas as premultiplied ( see cTexture::Premultiplied ). This must be set before saving. */
+		void SetPremultipliedAlpha( const bool& Premultiplied );
+
+		/** @return If the pages are saved with premultiplied alpha */
+		const bool& GetPremultipliedAlpha() const;
+
+		/** @return The number of pages ( the texture atlas and its childs ) created by the packing */
+		Uint32 GetPagesCount() const;
+
+		/** @return The fraction of the area of the page used by the textures ( 0 to 1 ). The page 0 is the texture atlas itself, the next pages are its childs. */
+		eeFloat GetPageOccupancy( const Uint32& Page ) const;
+
+		/** @return The fraction of the area of all the pages used by the textures ( 0 to 1 ). */
+		eeFloat GetOccupancy() const;
 	protected:
+		friend class Private::cTexturePackerSaveJob;
+
 		enum PackStrategy {
 			PackBig,
 			PackTiny,
@@ -128,6 +167,13 @@ class EE_API cTexturePacker {
 		Int32							mPixelBorder;
 		bool							mSaveExtensions;
 		EE_SAVE_TYPE					mFormat;
+		PackMethod						mMethod;
+		Int32							mUsedArea;
+		std::vector<eeRecti>			mFreeRects;
+		bool							mIncremental;
+		bool							mDirty;
+		std::vector<eeRecti>			mDirtyRects;
+		bool							mPremultiplied;
 
 		cTexturePacker * 				GetChild() const;
 
@@ -135,14 +181,24 @@ class EE_API cTexturePacker {
 
 		std::list<cTexturePackerTex*> *	GetTexturePackPtr();
 
-		void							ChildSave( const EE_SAVE_TYPE& Format );
+		void							SavePage();
+
+		void							SavePages( const std::string& Filepath, const EE_SAVE_TYPE& Format, const bool& SaveExtensions );
+
+		bool							PackIncremental( const std::string& Filepath, const EE_SAVE_TYPE& Format, const bool& SaveExtensions );
+
+		bool							CopyTexture( cImage * Img, cTexturePackerTex * t );
+
+		void							ClearRect( cImage * Img, eeRecti Rect );
+
+		eeRecti							GetTextureRect( cTexturePackerTex * t ) const;
+
+		Uint32							GetAtlasFlags() const;
 
 		void							SaveSubTextures();
 
     	void 							NewFree( Int32 x, Int32 y, Int32 width, Int32 height );
 
-    	bool 							MergeNodes();
-
     	void 							Validate();
 
 		cTexturePackerTex *				GetLonguestEdge();
@@ -161,14 +217,20 @@ class EE_API cTexturePacker {
 
 		void							CreateSubTexturesHdr( cTexturePacker * Packer, std::vector<sSubTextureHdr>& SubTextures );
 
-		cTexturePackerNode *			GetBestFit( cTexturePackerTex * t, cTexturePackerNode ** prevBestFit, Int32 * EdgeCount );
-
     	void							InsertTexture( cTexturePackerTex * t, cTexturePackerNode * bestFit, Int32 edgeCount, cTexturePackerNode * previousBestFit );
 
     	void							AddBorderToTextures( const Int32& BorderSize );
 
     	void							CreateChild();
 
+		void							PackMaxRects();
+
+		bool							FindMaxRectsPosition( cTexturePackerTex * t, eeRecti& Pos, bool& Flipped );
+
+		void							PlaceMaxRect( const eeRecti& Used );
+
+		void							CalcUsedArea();
+
 		bool							AddPackerTex( cTexturePackerTex * TPack );
 };
 
@@ -45,6 +45,7 @@ typedef struct sTextureAtlasHdrS {
 #define HDR_TEXTURE_ATLAS_ALLOW_FLIPPING		( 1 << 0 )
 #define HDR_TEXTURE_ATLAS_REMOVE_EXTENSION		( 1 << 1 )
 #define HDR_TEXTURE_ATLAS_POW_OF_TWO			( 1 << 2 )
+#define HDR_TEXTURE_ATLAS_PREMULTIPLIED_ALPHA	( 1 << 3 )
 
 #define EE_TEXTURE_ATLAS_MAGIC_OLD ( ( 'E' << 0 ) | ( 'E' << 8 ) | ( 'T' << 16 ) | ( 'G' << 24 ) )
 #define EE_TEXTURE_ATLAS_MAGIC ( ( 'E' << 0 ) | ( 'E' << 8 ) | ( 'T' << 16 ) | ( 'A' << 24 ) )
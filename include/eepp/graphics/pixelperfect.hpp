@@ -2,6 +2,7 @@
 #define EE_GRAPHICS_PIXELPERFECT_H
 
 #include <eepp/graphics/ctexture.hpp>
+#include <eepp/graphics/csubtexture.hpp>
 
 namespace EE { namespace Graphics {
 
@@ -14,7 +15,7 @@ namespace EE { namespace Graphics {
 * @param y2 Screen Y axis position for the second texture
 * @param Tex1_SrcRECT The sector of the texture from TexId_1 that you are rendering, the sector you want to collide ( on cSprite the SprSrcRECT )
 * @param Tex2_SrcRECT  The sector of the texture from TexId_2 that you are rendering, the sector you want to collide ( on cSprite the SprSrcRECT )
-* @warning Stress the CPU easily. \n Creates a copy of the texture on the app contex. \n It will not work with scaled or rotated textures.
+* @warning Stress the CPU easily. \n Creates a copy of the texture on the app contex. \n It will not work with scaled or rotated textures. \n The SubTextures version uses cached collision masks and it's much faster.
 * @return True if collided
 */
 bool EE_API PixelPerfectCollide( cTexture * Tex1, const eeUint& x1, const eeUint& y1, cTexture * Tex2, const eeUint& x2, const eeUint& y2, const eeRectu& Tex1_SrcRECT = eeRectu(0,0,0,0), const eeRectu& Tex2_SrcRECT = eeRectu(0,0,0,0) );
@@ -30,6 +31,42 @@ bool EE_API PixelPerfectCollide( cTexture * Tex1, const eeUint& x1, const eeUint
 */
 bool EE_API PixelPerfectCollide( cTexture * Tex, const eeUint& x1, const eeUint& y1, const eeUint& x2, const eeUint& y2, const eeRectu& Tex1_SrcRECT = eeRectu(0,0,0,0) );
 
+/** Pixel Perfect Collition between two SubTextures. It tests the collision masks of the SubTextures 64 pixels at a time ( see cSubTexture::GetCollisionMask ).
+* @param SubTex1 First SubTexture
+* @param x1 Screen X axis position for the first SubTexture
+* @param y1 Screen Y axis position for the first SubTexture
+* @param SubTex2 Second SubTexture
+* @param x2 Screen X axis position for the second SubTexture
+* @param y2 Screen Y axis position for the second SubTexture
+* @note The positions are the same used to draw the SubTextures ( the SubTexture offset is added ).
+* @warning It will not work with scaled or rotated SubTextures ( or with a destination size different from the source size ).
+* @return True if collided
+*/
+bool EE_API PixelPerfectCollide( cSubTexture * SubTex1, const Int32& x1, const Int32& y1, cSubTexture * SubTex2, const Int32& x2, const Int32& y2 );
+
+/** Pixel Perfect Collition between a SubTexture and a point
+* @param SubTex The SubTexture
+* @param x1 Screen X axis position for the SubTexture
+* @param y1 Screen Y axis position for the SubTexture
+* @param x2 Screen X axis position for the point on screen
+* @param y2 Screen Y axis position for the point on screen
+* @return True if collided
+*/
+bool EE_API PixelPerfectCollide( cSubTexture * SubTex, const Int32& x1, const Int32& y1, const Int32& x2, const Int32& y2 );
+
+/** Pixel Perfect Collition between a SubTexture and many SubTextures ( for example a sprite and the tiles of a map ).
+* The SubTextures whose bounding boxes don't overlap are discarded without creating their collision masks.
+* @param SubTex The SubTexture to test
+* @param x Screen X axis position for the SubTexture
+* @param y Screen Y axis position for the SubTexture
+* @param Others The SubTextures to test against ( the NULL elements are skipped )
+* @param OthersPos The screen positions of the SubTextures to test against
+* @param Count The number of SubTextures to test against
+* @param Collisions If not NULL it receives Count flags, true for every SubTexture that collides. If NULL the test stops in the first collision.
+* @return The number of SubTextures that collide ( 0 or 1 if Collisions is NULL )
+*/
+Uint32 EE_API PixelPerfectCollide( cSubTexture * SubTex, const Int32& x, const Int32& y, cSubTexture ** Others, const eeVector2i * OthersPos, const Uint32& Count, bool * Collisions = NULL );
+
 }}
 
 #endif
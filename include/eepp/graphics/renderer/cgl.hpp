@@ -15,6 +15,7 @@ class cRendererGL;
 class cRendererGL3;
 class cRendererGL3CP;
 class cRendererGLES2;
+class cRendererNull;
 
 /** @brief This class is an abstraction of some OpenGL functionality.
 *	eepp have 3 different rendering pipelines: OpenGL 2, OpenGL 3 and OpenGL ES 2. This abstraction is to encapsulate this pipelines.
@@ -71,33 +72,38 @@ class EE_API cGL {
 
 		Uint32 GetTextureOpEnum( const EE_TEXTURE_OP& Type );
 
-		void Clear ( GLbitfield mask );
+		virtual void Clear ( GLbitfield mask );
 
-		void ClearColor ( GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha );
+		virtual void ClearColor ( GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha );
 
-		void Scissor ( GLint x, GLint y, GLsizei width, GLsizei height );
+		virtual void Scissor ( GLint x, GLint y, GLsizei width, GLsizei height );
 
-		void PolygonMode( GLenum face, GLenum mode );
+		virtual void PolygonMode( GLenum face, GLenum mode );
 
 		std::string GetExtensions();
 
-		const char * GetString( GLenum name );
+		virtual const char * GetString( GLenum name );
 
-		void DrawArrays (GLenum mode, GLint first, GLsizei count);
+		virtual void DrawArrays (GLenum mode, GLint first, GLsizei count);
 
-		void DrawElements( GLenum mode, GLsizei count, GLenum type, const GLvoid *indices );
+		virtual void DrawElements( GLenum mode, GLsizei count, GLenum type, const GLvoid *indices );
 
-		void BindTexture ( GLenum target, GLuint texture );
+		virtual void BindTexture ( GLenum target, GLuint texture );
 
-		void ActiveTexture( GLenum texture );
+		/** Deletes the textures, the texture units where they were bound revert to the texture 0 ( as OpenGL does ). */
+		virtual void DeleteTextures ( GLsizei n, const GLuint * textures );
 
-		void BlendFunc ( GLenum sfactor, GLenum dfactor );
+		virtual void ActiveTexture( GLenum texture );
 
-		void Viewport ( GLint x, GLint y, GLsizei width, GLsizei height );
+		virtual void BlendFunc ( GLenum sfactor, GLenum dfactor );
+
+		virtual void BlendFuncSeparate ( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha );
+
+		virtual void Viewport ( GLint x, GLint y, GLsizei width, GLsizei height );
 
 		void LineSmooth( const bool& Enable );
 
-		void LineWidth ( GLfloat width );
+		virtual void LineWidth ( GLfloat width );
 
 		/** Reapply the line smooth state */
 		void LineSmooth();
@@ -118,6 +124,8 @@ class EE_API cGL {
 
 		cRendererGLES2 * GetRendererGLES2();
 
+		cRendererNull * GetRendererNull();
+
 		virtual void PointSize( GLfloat size ) = 0;
 
 		virtual GLfloat PointSize() = 0;
@@ -182,7 +190,7 @@ class EE_API cGL {
 
 		virtual GLenum GetCurrentMatrixMode() = 0;
 
-		void GetViewport( GLint * viewport );
+		virtual void GetViewport( GLint * viewport );
 
 		virtual GLint Project( GLfloat objx, GLfloat objy, GLfloat objz, const GLfloat modelMatrix[16], const GLfloat projMatrix[16], const GLint viewport[4], GLfloat *winx, GLfloat *winy, GLfloat *winz ) = 0;
 
@@ -192,23 +200,68 @@ class EE_API cGL {
 
 		eeVector3f UnProjectCurrent( const eeVector3f& point );
 
-		void StencilFunc( GLenum func, GLint ref, GLuint mask );
+		virtual void StencilFunc( GLenum func, GLint ref, GLuint mask );
+
+		virtual void StencilOp( GLenum fail, GLenum zfail, GLenum zpass );
 
-		void StencilOp( GLenum fail, GLenum zfail, GLenum zpass );
+		virtual void StencilMask ( GLuint mask );
 
-		void StencilMask ( GLuint mask );
+		virtual void ColorMask ( GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha );
 
-		void ColorMask ( GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha );
+		virtual void BindVertexArray ( GLuint array );
 
-		void BindVertexArray ( GLuint array );
+		virtual void DeleteVertexArrays ( GLsizei n, const GLuint *arrays );
 
-		void DeleteVertexArrays ( GLsizei n, const GLuint *arrays );
+		virtual void GenVertexArrays ( GLsizei n, GLuint *arrays );
 
-		void GenVertexArrays ( GLsizei n, GLuint *arrays );
+		/** @return The vertex array object bound with BindVertexArray */
+		const GLuint& GetCurrentVertexArray() const;
 
 		const bool& QuadsSupported() const;
 
 		const int& QuadVertexs() const;
+
+		/** Enable or disable the redundant state change filter ( enabled by default ).
+		*	cGL keeps a shadow of the bound state ( textures per unit, blend function, enabled caps, client arrays, line width, point size and current program ),
+		*	and the calls that doesn't change it are not sent to OpenGL.
+		*/
+		void StateFilter( const bool& enabled );
+
+		/** @return If the redundant state change filter is enabled */
+		const bool& StateFilter() const;
+
+		/** @return The number of state changes sent to OpenGL since the last reset */
+		const Uint32& StateChangesIssued() const;
+
+		/** @return The number of redundant state changes dropped since the last reset */
+		const Uint32& StateChangesDropped() const;
+
+		/** Reset the issued and dropped state changes counters */
+		void ResetStateChangesStats();
+
+		/** Forget the shadowed state, so the next state changes are always sent to OpenGL.
+		*	Must be called after changing the GL state without using cGL ( for example after creating a texture with SOIL ).
+		*	The active texture unit is kept, since the engine never changes it outside cGL.
+		*/
+		virtual void InvalidateStateCache();
+
+		/** Requests to forget the shadowed state at the start of the next frame.
+		*	Unlike InvalidateStateCache it can be called from any thread ( for example from the texture loader threads ).
+		*/
+		void InvalidateStateCacheDeferred();
+
+		/** Forgets the shadowed state if it was requested by InvalidateStateCacheDeferred. Called by the window from the main thread every frame. */
+		void UpdateStateCache();
+
+		/** @return The number of texture units that the multi-texture shader samples ( 1 if the renderer doesn't have one ) */
+		virtual Uint32 MultiTextureUnits();
+
+		/** Sets or unsets the multi-texture shader.
+		*	The shader reads the texture unit of every vertex from its u texture coordinate ( u + unit * EE_TEXTURE_SLOT_STRIDE, and
+		*	EE_MAX_TEXTURE_UNITS for the untextured vertexs ), and samples the texture bound to that unit.
+		*	@return False if the shader can't be set now ( a custom shader, the clipping planes or the point sprites are active )
+		*/
+		virtual bool MultiTextureShader( const bool& enable );
 	protected:
 		enum GLStateFlags {
 			GLSF_LINE_SMOOTH	= 0,
@@ -223,8 +276,26 @@ class EE_API cGL {
 		int		mQuadVertexs;
 		GLfloat mLineWidth;
 		GLuint	mCurVAO;
+		bool	mStateFilter;
+		Uint32	mStateChangesIssued;
+		Uint32	mStateChangesDropped;
+		GLuint	mStateTexture[ EE_MAX_TEXTURE_UNITS ];
+		Uint32	mStateTextureUnit;
+		GLenum	mStateBlend[4];
+		GLuint	mStateProgram;
+		std::map<GLenum, bool> mStateCaps;
+		volatile bool mStateCacheDirty;
 
 		std::list<eeRectf> mPlanesClipped;
+
+		/** Counts a state change request.
+		*	@param changed If the request changes the shadowed state
+		*	@return If the request must be sent to OpenGL
+		*/
+		bool IssueState( const bool& changed );
+
+		/** @return If the shadowed state of the capability is known and equal to enabled */
+		bool StateIs( const std::map<GLenum, bool>& States, const GLenum& cap, const bool& enabled );
 	private:
 		void WriteExtension( Uint8 Pos, Uint32 BitWrite );
 };
@@ -24,6 +24,8 @@ class EE_API cRendererGL : public cGL {
 
 		GLfloat PointSize();
 
+		void InvalidateStateCache();
+
 		void PushMatrix();
 
 		void PopMatrix();
@@ -75,8 +77,9 @@ class EE_API cRendererGL : public cGL {
 		GLint Project( GLfloat objx, GLfloat objy, GLfloat objz, const GLfloat modelMatrix[16], const GLfloat projMatrix[16], const GLint viewport[4], GLfloat *winx, GLfloat *winy, GLfloat *winz );
 
 		GLint UnProject( GLfloat winx, GLfloat winy, GLfloat winz, const GLfloat modelMatrix[16], const GLfloat projMatrix[16], const GLint viewport[4], GLfloat *objx, GLfloat *objy, GLfloat *objz );
-	protected:	
-		
+	protected:
+		std::map<GLenum, bool>	mClientStates;
+		GLfloat					mPointSize;
 };
 
 #endif
@@ -9,6 +9,7 @@ namespace EE { namespace Graphics {
 
 enum EEGL3_SHADERS {
 	EEGL3_SHADER_BASE,
+	EEGL3_SHADER_MULTITEXTURE,
 	EEGL3_SHADERS_COUNT
 };
 
@@ -32,6 +33,8 @@ class EE_API cRendererGL3 : public cGL {
 
 		GLfloat PointSize();
 
+		void InvalidateStateCache();
+
 		void PushMatrix();
 
 		void PopMatrix();
@@ -101,6 +104,10 @@ class EE_API cRendererGL3 : public cGL {
 		GLint UnProject( GLfloat winx, GLfloat winy, GLfloat winz, const GLfloat modelMatrix[16], const GLfloat projMatrix[16], const GLint viewport[4], GLfloat *objx, GLfloat *objy, GLfloat *objz );
 
 		void ReloadCurrentShader();
+
+		Uint32 MultiTextureUnits();
+
+		bool MultiTextureShader( const bool& enable );
 	protected:
 		Private::cMatrixStack *	mStack;
 		GLint					mProjectionMatrix_id;	// cpu-side hook to shader uniform
@@ -32,6 +32,8 @@ class EE_API cRendererGL3CP : public cGL {
 
 		GLfloat PointSize();
 
+		void InvalidateStateCache();
+
 		void PushMatrix();
 
 		void PopMatrix();
@@ -12,6 +12,7 @@ enum EEGLES2_SHADERS {
 	EEGLES2_SHADER_CLIPPED,
 	EEGLES2_SHADER_POINTSPRITE,
 	EEGLES2_SHADER_PRIMITIVE,
+	EEGLES2_SHADER_MULTITEXTURE,
 	EEGLES2_SHADERS_COUNT
 };
 
@@ -35,6 +36,8 @@ class EE_API cRendererGLES2 : public cGL {
 
 		GLfloat PointSize();
 
+		void InvalidateStateCache();
+
 		void PushMatrix();
 
 		void PopMatrix();
@@ -104,6 +107,10 @@ class EE_API cRendererGLES2 : public cGL {
 		GLint UnProject( GLfloat winx, GLfloat winy, GLfloat winz, const GLfloat modelMatrix[16], const GLfloat projMatrix[16], const GLint viewport[4], GLfloat *objx, GLfloat *objy, GLfloat *objz );
 
 		void ReloadCurrentShader();
+
+		Uint32 MultiTextureUnits();
+
+		bool MultiTextureShader( const bool& enable );
 	protected:
 		Private::cMatrixStack *	mStack;
 		GLint					mProjectionMatrix_id;	// cpu-side hook to shader uniform
@@ -0,0 +1,275 @@
+#ifndef EE_GRAPHICS_CRENDERERNULL_HPP
+#define EE_GRAPHICS_CRENDERERNULL_HPP
+
+#include <eepp/graphics/renderer/cgl.hpp>
+
+namespace EE { namespace Graphics {
+
+namespace Private {
+class cMatrixStack;
+}
+
+/** @enum EEGL_COMMAND The GL commands captured by the null renderer */
+enum EEGL_COMMAND {
+	EEGL_CMD_DRAW_ARRAYS,
+	EEGL_CMD_DRAW_ELEMENTS,
+	EEGL_CMD_BIND_TEXTURE,
+	EEGL_CMD_ACTIVE_TEXTURE,
+	EEGL_CMD_BLEND_FUNC,
+	EEGL_CMD_ENABLE,
+	EEGL_CMD_DISABLE,
+	EEGL_CMD_ENABLE_CLIENT_STATE,
+	EEGL_CMD_DISABLE_CLIENT_STATE,
+	EEGL_CMD_VERTEX_POINTER,
+	EEGL_CMD_COLOR_POINTER,
+	EEGL_CMD_TEXCOORD_POINTER,
+	EEGL_CMD_MATRIX_MODE,
+	EEGL_CMD_PUSH_MATRIX,
+	EEGL_CMD_POP_MATRIX,
+	EEGL_CMD_LOAD_IDENTITY,
+	EEGL_CMD_LOAD_MATRIX,
+	EEGL_CMD_MULT_MATRIX,
+	EEGL_CMD_TRANSLATE,
+	EEGL_CMD_ROTATE,
+	EEGL_CMD_SCALE,
+	EEGL_CMD_PROJECTION,
+	EEGL_CMD_VIEWPORT,
+	EEGL_CMD_SCISSOR,
+	EEGL_CMD_CLEAR,
+	EEGL_CMD_LINE_WIDTH,
+	EEGL_CMD_POINT_SIZE,
+	EEGL_CMD_SET_SHADER,
+	EEGL_CMD_CLIP_PLANE,
+	EEGL_CMD_CLIP_2D_ENABLE,
+	EEGL_CMD_CLIP_2D_DISABLE,
+	EEGL_CMD_COUNT
+};
+
+/** @brief A GL call captured by the null renderer.
+*	Params holds the integer arguments of the call ( enums, names, counts ) and FParams the floating point arguments, in call order.
+*/
+class cGLCommand {
+	public:
+		cGLCommand( EEGL_COMMAND cmd = EEGL_CMD_COUNT );
+
+		EEGL_COMMAND	Cmd;
+		Int32			Params[4];
+		GLfloat			FParams[4];
+};
+
+/** @brief The draw and state statistics of a frame rendered with the null renderer */
+class cGLFrameStats {
+	public:
+		cGLFrameStats();
+
+		void Reset();
+
+		/** Number of DrawArrays and DrawElements calls */
+		Uint32	DrawCalls;
+
+		/** Number of vertexs submitted by the draw calls */
+		Uint32	Vertexs;
+
+		/** Number of texture binds ( including the redundant ones ) */
+		Uint32	TextureBinds;
+
+		/** Number of state change calls ( binds, blend, caps, client states, line width, point size and shaders ) */
+		Uint32	StateChanges;
+
+		/** Number of state change calls that didn't change anything */
+		Uint32	RedundantStateChanges;
+
+		/** Number of calls to the matrix stack */
+		Uint32	MatrixOperations;
+};
+
+/** @brief A renderer that doesn't need a GL context.
+*	It records every draw, bind, blend and matrix call into an in-memory command log and keeps per frame statistics, so the batching, culling and UI
+*	changes can be benchmarked and regression-tested on machines without a GPU. Nothing is sent to OpenGL, so textures must be pushed to the
+*	texture factory instead of being loaded ( cTextureFactory::PushTexture ).
+*/
+class EE_API cRendererNull : public cGL {
+	public:
+		cRendererNull();
+
+		~cRendererNull();
+
+		EEGL_version Version();
+
+		std::string VersionStr();
+
+		void Init();
+
+		/** Simulates a renderer that doesn't support quads ( like GL3 Core Profile and GLES2 ), so the batch renderer will draw the quads as indexed triangles. */
+		void QuadsSupported( const bool& supported );
+
+		/** Enable or disable the command log ( the frame statistics are always collected ) */
+		void RecordCommands( const bool& record );
+
+		/** @return If the command log is enabled */
+		const bool& RecordCommands() const;
+
+		/** @return The commands recorded in the current frame */
+		const std::vector<cGLCommand>& GetCommands() const;
+
+		/** @return The commands recorded in the last finished frame */
+		const std::vector<cGLCommand>& GetLastFrameCommands() const;
+
+		/** @return The statistics of the current frame */
+		const cGLFrameStats& GetFrameStats() const;
+
+		/** @return The statistics of the last finished frame */
+		const cGLFrameStats& GetLastFrameStats() const;
+
+		/** @return The number of frames finished */
+		const Uint32& GetFrameCount() const;
+
+		/** Finish the current frame, the current log and statistics become the last frame ones. */
+		void EndFrame();
+
+		void Clear ( GLbitfield mask );
+
+		void ClearColor ( GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha );
+
+		void Scissor ( GLint x, GLint y, GLsizei width, GLsizei height );
+
+		void PolygonMode( GLenum face, GLenum mode );
+
+		const char * GetString( GLenum name );
+
+		void DrawArrays (GLenum mode, GLint first, GLsizei count);
+
+		void DrawElements( GLenum mode, GLsizei count, GLenum type, const GLvoid *indices );
+
+		void BindTexture ( GLenum target, GLuint texture );
+
+		void DeleteTextures ( GLsizei n, const GLuint * textures );
+
+		void ActiveTexture( GLenum texture );
+
+		void BlendFunc ( GLenum sfactor, GLenum dfactor );
+
+		void BlendFuncSeparate ( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha );
+
+		void Viewport ( GLint x, GLint y, GLsizei width, GLsizei height );
+
+		void LineWidth ( GLfloat width );
+
+		void GetViewport( GLint * viewport );
+
+		void StencilFunc( GLenum func, GLint ref, GLuint mask );
+
+		void StencilOp( GLenum fail, GLenum zfail, GLenum zpass );
+
+		void StencilMask ( GLuint mask );
+
+		void ColorMask ( GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha );
+
+		void BindVertexArray ( GLuint array );
+
+		void DeleteVertexArrays ( GLsizei n, const GLuint *arrays );
+
+		void GenVertexArrays ( GLsizei n, GLuint *arrays );
+
+		void PointSize( GLfloat size );
+
+		GLfloat PointSize();
+
+		void ClientActiveTexture( GLenum texture );
+
+		void Disable ( GLenum cap );
+
+		void Enable( GLenum cap );
+
+		void PushMatrix();
+
+		void PopMatrix();
+
+		void LoadIdentity();
+
+		void Translatef( GLfloat x, GLfloat y, GLfloat z );
+
+		void Rotatef( GLfloat angle, GLfloat x, GLfloat y, GLfloat z );
+
+		void Scalef( GLfloat x, GLfloat y, GLfloat z );
+
+		void MatrixMode ( GLenum mode );
+
+		void Ortho ( GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar );
+
+		void LookAt( GLfloat eyeX, GLfloat eyeY, GLfloat eyeZ, GLfloat centerX, GLfloat centerY, GLfloat centerZ, GLfloat upX, GLfloat upY, GLfloat upZ );
+
+		void Perspective ( GLfloat fovy, GLfloat aspect, GLfloat zNear, GLfloat zFar );
+
+		void EnableClientState( GLenum array );
+
+		void DisableClientState( GLenum array );
+
+		void VertexPointer ( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer, GLuint allocate );
+
+		void ColorPointer ( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer, GLuint allocate );
+
+		void TexCoordPointer ( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer, GLuint allocate );
+
+		void SetShader( cShaderProgram * Shader );
+
+		Uint32 MultiTextureUnits();
+
+		/** The multi-texture shader is recorded as a EEGL_CMD_SET_SHADER command with -1 as program */
+		bool MultiTextureShader( const bool& enable );
+
+		void Clip2DPlaneEnable( const Int32& x, const Int32& y, const Int32& Width, const Int32& Height );
+
+		void Clip2DPlaneDisable();
+
+		void MultMatrixf ( const GLfloat *m );
+
+		void ClipPlane( GLenum plane, const GLdouble *equation );
+
+		void TexEnvi( GLenum target, GLenum pname, GLint param );
+
+		void LoadMatrixf( const GLfloat *m );
+
+		void Frustum( GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat near_val, GLfloat far_val );
+
+		void GetCurrentMatrix( GLenum mode, GLfloat * m );
+
+		GLenum GetCurrentMatrixMode();
+
+		GLint Project( GLfloat objx, GLfloat objy, GLfloat objz, const GLfloat modelMatrix[16], const GLfloat projMatrix[16], const GLint viewport[4], GLfloat *winx, GLfloat *winy, GLfloat *winz );
+
+		GLint UnProject( GLfloat winx, GLfloat winy, GLfloat winz, const GLfloat modelMatrix[16], const GLfloat projMatrix[16], const GLint viewport[4], GLfloat *objx, GLfloat *objy, GLfloat *objz );
+	protected:
+		Private::cMatrixStack *		mStack;
+		GLenum						mCurrentMode;
+		std::vector<cGLCommand>		mCommands;
+		std::vector<cGLCommand>		mLastCommands;
+		cGLFrameStats				mStats;
+		cGLFrameStats				mLastStats;
+		Uint32						mFrames;
+		bool						mRecord;
+		std::map<GLenum, bool>		mCaps;
+		std::map<GLenum, bool>		mClientStates;
+		GLuint						mBoundTexture[ EE_MAX_TEXTURE_UNITS ];
+		Uint32						mActiveTexture;
+		GLenum						mBlendSrc;
+		GLenum						mBlendDst;
+		GLenum						mBlendSrcAlpha;
+		GLenum						mBlendDstAlpha;
+		GLfloat						mPointSize;
+		cShaderProgram *			mCurShader;
+		bool						mMultiTexture;
+		GLint						mViewport[4];
+
+		cGLCommand& Record( EEGL_COMMAND cmd );
+
+		void StateChange( const bool& redundant );
+
+		void SetCap( std::map<GLenum, bool>& States, const GLenum& cap, const bool& enable, EEGL_COMMAND cmd );
+
+		void MatrixOp( EEGL_COMMAND cmd, GLfloat x = 0, GLfloat y = 0, GLfloat z = 0, GLfloat w = 0 );
+};
+
+}}
+
+#endif
@@ -5,6 +5,9 @@ namespace EE { namespace Graphics {
 
 #define EE_MAX_TEXTURE_UNITS 4
 
+/** The offset added to the u texture coordinate per texture slot by the multi-texture batching, the multi-texture shader decodes it */
+#define EE_TEXTURE_SLOT_STRIDE 4
+
 /** @enum EE_FILL_MODE Defines the fill mode for the primitives. */
 enum EE_FILL_MODE {
 	DRAW_LINE, 				//!< Draw only lines
@@ -27,6 +30,7 @@ enum EE_BLEND_MODE {
 	ALPHA_ALPHACHANNELS, 	//!< src SRC_ALPHA dst SRC_ALPHA
 	ALPHA_DESTALPHA, 		//!< src SRC_ALPHA dst DST_ALPHA
 	ALPHA_MULTIPLY, 		//!< src DST_COLOR dst ZERO
+	ALPHA_PREMULTIPLIED,	//!< src ONE dst ONE_MINUS_SRC_ALPHA ( for premultiplied alpha textures and colors )
 	ALPHA_CUSTOM			//!< Disable the Predefined blend mode for the use of custom blend funcs.
 };
 
@@ -48,7 +52,8 @@ enum EE_SAVE_TYPE {
 	SAVE_TYPE_BMP 		= 1,
 	SAVE_TYPE_PNG 		= 2,
 	SAVE_TYPE_DDS 		= 3,
-	SAVE_TYPE_JPG		= 4
+	SAVE_TYPE_JPG		= 4,
+	SAVE_TYPE_KTX		= 5		//! KTX container with S3TC compressed blocks ( see cCompressedImage )
 };
 
 /** @enum EE_RESAMPLER_FILTER The filter used to resample/resize an image. */
@@ -23,6 +23,9 @@
 #include <eepp/system/tresourcemanager.hpp>
 #include <eepp/system/cpackmanager.hpp>
 #include <eepp/system/cthreadlocal.hpp>
+#include <eepp/system/cmappedfile.hpp>
 #include <eepp/system/tthreadlocalptr.hpp>
+#include <eepp/system/cprofiler.hpp>
+#include <eepp/system/cfixedtimestep.hpp>
 
 #endif
@@ -0,0 +1,84 @@
+#ifndef EE_SYSTEMCFIXEDTIMESTEP_HPP
+#define EE_SYSTEMCFIXEDTIMESTEP_HPP
+
+#include <eepp/system/base.hpp>
+#include <eepp/system/ctime.hpp>
+
+namespace EE { namespace System {
+
+/** @brief Decouples the update rate from the render rate.
+*	The elapsed frame time is accumulated, and the simulation is advanced in steps of a fixed duration, so the updates are deterministic no matter the frame rate.
+*	The render can interpolate between the previous and the current simulation states with the Alpha factor.
+*	@code
+*	cFixedTimestep Timestep( Milliseconds( 1000.0 / 30.0 ) );
+*
+*	void MainLoop() {
+*		Timestep.Advance( Window->Elapsed() );
+*
+*		while ( Timestep.Step() ) {
+*			PrevPos = Pos;
+*			Update( Timestep.StepTime() );
+*		}
+*
+*		Draw( cFixedTimestep::Interpolate( PrevPos, Pos, Timestep.Alpha() ) );
+*	}
+*	@endcode
+*/
+class EE_API cFixedTimestep {
+	public:
+		/** @param StepTime The duration of every update step
+		*	@param MaxSteps The maximum number of steps that can be accumulated, the time that exceeds it is dropped ( this avoids the spiral of death when the updates are slower than real time ).
+		*/
+		cFixedTimestep( const cTime& StepTime = Microseconds( 16667 ), const Uint32& MaxSteps = 8 );
+
+		/** Sets the duration of every update step */
+		void StepTime( const cTime& StepTime );
+
+		/** @return The duration of every update step */
+		const cTime& StepTime() const;
+
+		/** Sets the maximum number of steps that can be accumulated */
+		void MaxSteps( const Uint32& MaxSteps );
+
+		/** @return The maximum number of steps that can be accumulated */
+		const Uint32& MaxSteps() const;
+
+		/** Accumulates the elapsed time of the frame.
+		*	@return The number of steps pending */
+		Uint32 Advance( const cTime& Elapsed );
+
+		/** Consumes a step if there is one pending.
+		*	@return True if a step must be run */
+		bool Step();
+
+		/** @return The number of steps pending */
+		Uint32 PendingSteps() const;
+
+		/** @return The interpolation factor between the previous and the current step ( from 0 to 1 ) */
+		eeFloat Alpha() const;
+
+		/** @return The number of steps run since the creation ( or the last reset ) */
+		const Uint64& StepsCount() const;
+
+		/** @return The simulated time ( StepsCount * StepTime ) */
+		cTime SimulationTime() const;
+
+		/** Clears the accumulated time and the steps count */
+		void Reset();
+
+		/** Linear interpolation between the previous and the current state */
+		template <typename T>
+		static T Interpolate( const T& Previous, const T& Current, const eeFloat& Alpha ) {
+			return Previous + ( Current - Previous ) * Alpha;
+		}
+	protected:
+		cTime		mStepTime;
+		Int64		mStep;
+		Int64		mAccumulator;
+		Uint32		mMaxSteps;
+		Uint64		mStepsCount;
+};
+
+}}
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef EE_SYSTEMCMAPPEDFILE_HPP
+#define EE_SYSTEMCMAPPEDFILE_HPP
+
+#include <eepp/base.hpp>
+#include <eepp/base/noncopyable.hpp>
+
+namespace EE { namespace System {
+
+namespace Platform { class cMappedFileImpl; }
+
+/** @brief Maps a file in memory in read only mode.
+**	The pages of the file are loaded by the operating system when they are accessed, so big files can be used without reading them. */
+class EE_API cMappedFile : NonCopyable {
+	public:
+		/** @brief Maps the file in memory
+		**	@param Filepath The path of the file to map */
+		cMappedFile( const std::string& Filepath );
+
+		~cMappedFile();
+
+		/** @return If the file was mapped */
+		bool IsOpen() const;
+
+		/** @return The pointer to the mapped file data ( NULL if it's not open ) */
+		const Uint8 * GetData() const;
+
+		/** @return The size of the mapped file */
+		Uint64 GetSize() const;
+	private:
+		Platform::cMappedFileImpl *		mMappedFileImpl;
+};
+
+}}
+
+#endif
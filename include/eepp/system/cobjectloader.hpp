@@ -51,6 +51,9 @@ class EE_API cObjectLoader : protected cThread {
 		/** @returns If the resource is loading. */
 		virtual bool	IsLoading();
 
+		/** @returns If the asynchronous part of the loading finished and the resource only waits for the Update call to finish loading ( for example a decoded texture waiting to be uploaded to the GPU ). */
+		virtual bool	IsWaitingUpdate();
+
 		/** @returns If the loader is asynchronous */
 		bool			Threaded() const;
 
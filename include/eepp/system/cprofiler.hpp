@@ -0,0 +1,154 @@
+#ifndef EE_SYSTEMCPROFILER_HPP
+#define EE_SYSTEMCPROFILER_HPP
+
+#include <eepp/system/base.hpp>
+#include <eepp/system/tsingleton.hpp>
+#include <eepp/system/cmutex.hpp>
+#include <eepp/system/cclock.hpp>
+#include <eepp/system/tthreadlocalptr.hpp>
+
+namespace EE { namespace System {
+
+namespace Private { class cProfilerThread; }
+
+/** @brief A zone measured by the profiler */
+class EE_API cProfilerEvent {
+	public:
+		cProfilerEvent();
+
+		/** The zone name ( must be a string with static storage, usually a string literal ) */
+		const char *	Name;
+
+		/** Start time of the zone, in microseconds since the profiler was created */
+		Int64			Start;
+
+		/** Duration of the zone in microseconds */
+		Int64			Duration;
+
+		/** The frame number where the zone started */
+		Uint32			Frame;
+
+		/** The profiler index of the thread that measured the zone ( 0 is the first thread that used the profiler, usually the main thread ) */
+		Uint32			Thread;
+
+		/** The nesting level of the zone */
+		Uint32			Depth;
+};
+
+/** @brief The timing of a frame */
+class EE_API cProfilerFrame {
+	public:
+		cProfilerFrame();
+
+		/** The frame number */
+		Uint32			Number;
+
+		/** Start time of the frame, in microseconds since the profiler was created */
+		Int64			Start;
+
+		/** Duration of the frame in microseconds ( 0 if the frame didn't finish yet ) */
+		Int64			Duration;
+
+		/** GPU time of the frame in microseconds, -1 if unknown ( the GPU timer queries are not supported, or the result is not ready yet ) */
+		Int64			GpuDuration;
+};
+
+/** @brief A scoped timer profiler with named zones.
+*	Every thread writes its zones in its own ring buffer, so measuring a zone never locks ( only the first zone of a thread locks, to register the thread buffer ).
+*	The window marks the frames ( and measures the GPU time of the frame when the timer queries are available ), so the zones can be grouped by frame.
+*	The last frames can be exported to the Chrome trace format ( chrome://tracing ) or dumped to the console with the "profiler" command.
+*	Zones are measured only while the profiler is enabled, use the eePROFILE_ZONE macro to measure a scope:
+*	@code
+*	void cMap::Update() {
+*		eePROFILE_ZONE( "Map Update" );
+*		...
+*	}
+*	@endcode
+*/
+class EE_API cProfiler {
+	SINGLETON_DECLARE_HEADERS(cProfiler)
+
+	public:
+		~cProfiler();
+
+		/** Enables or disables the profiler ( disabled by default ) */
+		void Enabled( const bool& enabled );
+
+		/** @return If the profiler is enabled */
+		const bool& Enabled() const;
+
+		/** @return The current time in microseconds since the profiler was created */
+		Int64 Now() const;
+
+		/** Finishes the current frame and starts a new one. It's called by the window every time the frame is displayed. */
+		void FrameMark();
+
+		/** @return The current frame number */
+		Uint32 FrameNumber() const;
+
+		/** Sets the GPU time of a frame. The GPU times are usually known some frames later. */
+		void GpuFrameTime( const Uint32& Frame, const cTime& Time );
+
+		/** Adds a finished zone to the current thread ring buffer */
+		void AddZone( const char * Name, const Int64& Start, const Int64& End, const Uint32& Depth );
+
+		/** @return The last finished frames ( up to Count frames ), the oldest first */
+		std::vector<cProfilerFrame> GetFrames( const Uint32& Count ) const;
+
+		/** @return The zones measured in the last Count finished frames, sorted by start time */
+		std::vector<cProfilerEvent> GetZones( const Uint32& Count ) const;
+
+		/** @brief Exports the last frames to the Chrome trace event format
+		*	@param Filepath The JSON file path
+		*	@param Count The number of finished frames to export ( 0 exports all the frames kept by the profiler )
+		*/
+		bool ExportChromeTrace( const std::string& Filepath, const Uint32& Count = 0 ) const;
+
+		/** @return A readable report of the last Count finished frames, with the frame times and the time spent in every zone */
+		std::string GetReport( const Uint32& Count ) const;
+	protected:
+		friend class cProfilerZone;
+
+		cProfiler();
+
+		enum ProfilerLimits {
+			FRAMES_COUNT		= 512,
+			THREAD_ZONES_COUNT	= 16384
+		};
+
+		cClock										mClock;
+		bool										mEnabled;
+		volatile Uint32								mFrame;
+		cProfilerFrame								mFrames[ FRAMES_COUNT ];
+		mutable cMutex								mThreadsMutex;
+		std::vector<Private::cProfilerThread*>		mThreads;
+		tThreadLocalPtr<Private::cProfilerThread>	mThread;
+
+		Private::cProfilerThread * GetThread();
+};
+
+/** @brief Measures the time spent in the scope where the instance lives. Use it with the eePROFILE_ZONE macro. */
+class EE_API cProfilerZone : NonCopyable {
+	public:
+		cProfilerZone( const char * Name );
+
+		~cProfilerZone();
+	protected:
+		const char *				mName;
+		Private::cProfilerThread *	mThread;
+		Int64						mStart;
+};
+
+}}
+
+#define eePROFILE_CONCAT_( a, b ) a##b
+#define eePROFILE_CONCAT( a, b ) eePROFILE_CONCAT_( a, b )
+
+/// Measures the current scope as a profiler zone, compile with EE_NO_PROFILER to remove the zones
+#ifndef EE_NO_PROFILER
+	#define eePROFILE_ZONE( name ) EE::System::cProfilerZone eePROFILE_CONCAT( eeProfilerZone, __LINE__ )( name )
+#else
+	#define eePROFILE_ZONE( name )
+#endif
+
+#endif
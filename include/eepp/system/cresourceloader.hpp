@@ -3,12 +3,15 @@
 
 #include <eepp/system/base.hpp>
 #include <eepp/system/cobjectloader.hpp>
+#include <eepp/system/ctime.hpp>
 
 namespace EE { namespace System {
 
 #define THREADS_AUTO (eeINDEX_NOT_FOUND)
 
-/** @brief A simple resource loader that can load a batch of resources synchronously or asynchronously */
+/** @brief A simple resource loader that can load a batch of resources synchronously or asynchronously
+**	In asynchronous mode the resources are decoded in up to MaxThreads loader threads, and the part that must be done in the main thread ( like the GPU upload of the textures )
+**	is done in Update, limited by the upload budget, so loading hundreds of textures doesn't stall a frame. */
 class EE_API cResourceLoader {
 	public:
 		typedef cb::Callback1<void, cResourceLoader *> ResLoadCallback;
@@ -60,11 +63,19 @@ class EE_API cResourceLoader {
 
 		/** @returns The number of resources added to load. */
 		Uint32			Count() const;
+
+		/** @brief Sets the maximum time spent finishing the resources in every Update call in asynchronous mode ( 2 ms by default ).
+		**	At least one resource is finished every call. A zero time finishes every resource ready in the same call. */
+		void			UploadBudget( const cTime& budget );
+
+		/** @return The maximum time spent finishing the resources in every Update call */
+		const cTime&	UploadBudget() const;
 	protected:
 		bool			mLoaded;
 		bool			mLoading;
 		bool			mThreaded;
 		Uint32			mThreads;
+		cTime			mUploadBudget;
 
 		std::list<ResLoadCallback>	mLoadCbs;
 		std::list<cObjectLoader *>	mObjs;
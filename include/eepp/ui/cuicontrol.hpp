@@ -240,6 +240,11 @@ class EE_API cUIControl {
 		eeRecti GetScreenRect();
 
 		void ChildsCloseAll();
+
+		/** Marks the area covered by the control as dirty, so it's redrawn in the next frame when the UI partial redraw is enabled ( see cUIManager::PartialRedraw ).
+		*	The position, size, visibility, skin state, text and animation changes invalidate the control automatically.
+		*	Controls that change its content by other means ( for example a control that draws something animated ) must call it. */
+		void Invalidate();
 	protected:
 		typedef std::map< Uint32, std::map<Uint32, UIEventCallback> > UIEventsMap;
 		friend class cUIManager;
@@ -383,6 +388,8 @@ class EE_API cUIControl {
 		eeSize GetSkinSize( cUISkin * Skin, const Uint32& State = cUISkinState::StateNormal );
 
 		eeRectf GetRectf();
+
+		eeRecti GetScreenBounds();
 };
 
 }}
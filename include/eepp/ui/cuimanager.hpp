@@ -7,6 +7,8 @@
 #include <eepp/window/cwindow.hpp>
 #include <eepp/window/cursorhelper.hpp>
 
+namespace EE { namespace Graphics { class cFrameBuffer; } }
+
 using namespace EE::Window::Cursor;
 
 namespace EE { namespace UI {
@@ -101,6 +103,40 @@ class EE_API cUIManager {
 		const bool& UseGlobalCursors();
 
 		void SetCursor( EE_CURSOR_TYPE cursor );
+
+		/** @brief Enables or disables the partial redraw of the UI ( disabled by default ).
+		*	When enabled the UI is drawn into a cached frame buffer, and only the regions invalidated by the controls are redrawn ( see cUIControl::Invalidate ).
+		*	The union of the dirty regions is redrawn with the scissor test, and the cache is drawn to the window every frame.
+		*	The cache contains the whole window ( cleared with the window back color ), so it's meant for applications that only draw the UI.
+		*	When nothing changed the application can skip the frame entirely, for example:
+		*	@code
+		*	cUIManager::instance()->Update();
+		*
+		*	if ( cUIManager::instance()->IsDirty() ) {
+		*		win->Clear();
+		*		cUIManager::instance()->Draw();
+		*		win->Display();
+		*	} else {
+		*		Sys::Sleep( 10 );
+		*	}
+		*	@endcode
+		*/
+		void PartialRedraw( const bool& enabled );
+
+		/** @return If the partial redraw is enabled */
+		const bool& PartialRedraw() const;
+
+		/** Marks a region of the window as dirty ( in screen coordinates ) */
+		void Invalidate( const eeRecti& Rect );
+
+		/** Marks the whole window as dirty */
+		void Invalidate();
+
+		/** @return If something must be redrawn. Always true if the partial redraw is disabled. */
+		bool IsDirty() const;
+
+		/** @return The union of the regions invalidated since the last draw */
+		const eeRecti& GetDirtyRect() const;
 	protected:
 		friend class cUIControl;
 		friend class cUIWindow;
@@ -129,6 +165,10 @@ class EE_API cUIManager {
 		bool				mShootingDown;
 		bool				mControlDragging;
 		bool				mUseGlobalCursors;
+		bool				mPartialRedraw;
+		bool				mDirty;
+		eeRecti				mDirtyRect;
+		Graphics::cFrameBuffer *	mCache;
 
 		cUIManager();
 
@@ -149,6 +189,8 @@ class EE_API cUIManager {
 		void				AddToCloseQueue( cUIControl * Ctrl );
 
 		void				CheckClose();
+
+		void				DrawCache();
 };
 
 }}
@@ -47,6 +47,8 @@ class EE_API cUIProgressBar : public cUIComplexControl {
 
 		virtual void Draw();
 
+		virtual void Update();
+
 		void MovementSpeed( const eeVector2f& Speed );
 
 		const eeVector2f& MovementSpeed() const;
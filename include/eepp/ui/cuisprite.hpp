@@ -38,6 +38,8 @@ class EE_API cUISprite : public cUIComplexControl {
 
 		virtual void Draw();
 
+		virtual void Update();
+
 		virtual void Alpha( const eeFloat& alpha );
 
 		cSprite * Sprite() const;
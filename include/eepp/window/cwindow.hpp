@@ -121,6 +121,27 @@ class WindowInfo {
 	eeWindowContex		Context;
 };
 
+/** @brief FrameTimeStats The frame time statistics of the last frames rendered ( in milliseconds ) */
+class FrameTimeStats {
+	public:
+
+	inline FrameTimeStats() :
+		Samples( 0 ),
+		Average( 0 ),
+		Min( 0 ),
+		Max( 0 ),
+		Variance( 0 ),
+		StdDeviation( 0 )
+	{}
+
+	Uint32			Samples;
+	eeDouble		Average;
+	eeDouble		Min;
+	eeDouble		Max;
+	eeDouble		Variance;
+	eeDouble		StdDeviation;
+};
+
 /** @brief DisplayMode contains a display mode available to use */
 class DisplayMode {
 	public:
@@ -243,6 +264,9 @@ class EE_API cWindow {
 		/** @return The current frames per second of the screen */
 		virtual Uint32 FPS() const;
 
+		/** @return The frame time statistics ( average, min, max, variance and standard deviation ) of the last frames rendered */
+		FrameTimeStats GetFrameTimeStats() const;
+
 		/** @return If the screen is windowed */
 		virtual bool Windowed() const;
 
@@ -302,15 +326,19 @@ class EE_API cWindow {
 		/** Captures the window front buffer and saves it to disk. \n
 		* You have to call it before Display, and after render all the objects. \n
 		* If the file path is empty will save the files like 0001.bmp, and will check if the file exists, otherwise will create 0002.bmp, and so on... \n
-		* You can set only the path to save the files, like "screenshots/"
-		* @return False if failed, otherwise returns True
+		* You can set only the path to save the files, like "screenshots/" \n
+		* If Async is true only the pixels are read in the calling thread, the image is encoded and saved in a background thread ( see cImageSaver ).
+		* @return False if failed, otherwise returns True ( in asynchronous mode it can't report if the file was saved )
 		*/
-		bool TakeScreenshot( std::string filepath = "", const EE_SAVE_TYPE& Format = SAVE_TYPE_PNG );
+		bool TakeScreenshot( std::string filepath = "", const EE_SAVE_TYPE& Format = SAVE_TYPE_PNG, const bool& Async = false );
 
 		/** @return The pointer to the Window Info ( read only ) */
 		const WindowInfo * GetWindowInfo() const;
 
-		/** Set a frame per second limit. It's not 100 % accurate. */
+		/** @brief Set a frame per second limit ( 0 = no limit ).
+		*	The limiter sleeps until a calibrated margin before the end of the frame ( the margin adapts to the sleep overshoot of the system ), and then spins
+		*	until the frame deadline. The deadlines are kept on a fixed grid, so the frame times don't drift.
+		*/
 		void FrameRateLimit( const Uint32& FrameRateLimit );
 
 		/** Get a frame per second limit. */
@@ -470,19 +498,27 @@ class EE_API cWindow {
 						Current(0),
 						Count(0),
 						Limit(0),
-						Error(0)
+						Deadline(0),
+						SleepMargin(0)
 					{}
 
 					Uint32 LastCheck;
 					Uint32 Current;
 					Uint32 Count;
 					eeFloat Limit;
-					Int32 Error;
+					Int64 Deadline;
+					Int64 SleepMargin;
 				};
 
+				enum { FRAME_TIMES_COUNT = 120 };
+
 				cFPSData		FPS;
 				cClock *		FrameElapsed;
+				cClock *		PacingClock;
 				cTime			ElapsedTime;
+				eeDouble		FrameTimes[ FRAME_TIMES_COUNT ];
+				Uint32			FrameTimesCount;
+				Uint32			FrameTimesIndex;
 
 				cFrameData();
 
@@ -517,6 +553,8 @@ class EE_API cWindow {
 		void LogSuccessfulInit( const std::string& BackendName, const std::string& ProcessPath = "" );
 
 		void LogFailureInit( const std::string& ClassName, const std::string& BackendName );
+
+		bool SaveScreenshot( const std::string& filepath, const EE_SAVE_TYPE& Format, const bool& Async );
 };
 
 }}
@@ -913,6 +913,12 @@ solution "eepp"
 		files { "src/examples/http_request/*.cpp" }
 		build_link_configuration( "eehttp-request", true )
 
+	project "eepp-pixel-benchmark"
+		kind "ConsoleApp"
+		language "C++"
+		files { "src/examples/pixel_benchmark/*.cpp" }
+		build_link_configuration( "eepixel-benchmark", true )
+
 if os.isfile("external_projects.lua") then
 	dofile("external_projects.lua")
 end
@@ -1,5 +1,6 @@
 #include <eepp/gaming/clightmanager.hpp>
 #include <eepp/gaming/cmap.hpp>
+#include <eepp/system/cprofiler.hpp>
 
 namespace EE { namespace Gaming {
 
@@ -23,6 +24,8 @@ cLightManager::~cLightManager() {
 }
 
 void cLightManager::Update() {
+	eePROFILE_ZONE( "Light Update" );
+
 	if ( mIsByVertex ) {
 		UpdateByVertex();
 	} else {
@@ -10,6 +10,7 @@
 #include <eepp/gaming/cobjectlayer.hpp>
 
 #include <eepp/system/cpackmanager.hpp>
+#include <eepp/system/cprofiler.hpp>
 
 #include <eepp/graphics/renderer/cgl.hpp>
 #include <eepp/graphics/cprimitives.hpp>
@@ -211,6 +212,8 @@ cLayer* cMap::GetLayer( const std::string& name ) {
 }
 
 void cMap::Draw() {
+	eePROFILE_ZONE( "Map Draw" );
+
 	cGlobalBatchRenderer::instance()->Draw();
 
 	if ( ClipedArea() ) {
@@ -441,6 +444,8 @@ const eeAABB& cMap::GetViewAreaAABB() const {
 }
 
 void cMap::Update() {
+	eePROFILE_ZONE( "Map Update" );
+
 	GetMouseOverTile();
 
 	UpdateScreenAABB();
@@ -98,6 +98,9 @@ void cUIMap::Update() {
 	if ( NULL != mMap ) {
 		mMap->Update();
 
+		// The map is animated, it's redrawn every frame
+		Invalidate();
+
 		if ( mEnabled && mVisible && IsMouseOver() ) {
 			Uint32 Flags 			= cUIManager::instance()->GetInput()->ClickTrigger();
 
@@ -0,0 +1,237 @@
+#include <eepp/graphics/batchhelper.hpp>
+
+#if defined( EE_SSE2 )
+#include <emmintrin.h>
+#elif defined( EE_NEON )
+#include <arm_neon.h>
+#endif
+
+namespace EE { namespace Graphics { namespace Private {
+
+#if defined( EE_SSE2 )
+// Stores the corners X, Y of 4 consecutive quads ( 4 vertexs per quad )
+static inline void StoreQuadsCorner( eeVertex * V, const __m128& X, const __m128& Y ) {
+	__m128 lo = _mm_unpacklo_ps( X, Y );
+	__m128 hi = _mm_unpackhi_ps( X, Y );
+
+	_mm_storel_pi( reinterpret_cast<__m64*>( &V[0].pos ), lo );
+	_mm_storeh_pi( reinterpret_cast<__m64*>( &V[4].pos ), lo );
+	_mm_storel_pi( reinterpret_cast<__m64*>( &V[8].pos ), hi );
+	_mm_storeh_pi( reinterpret_cast<__m64*>( &V[12].pos ), hi );
+}
+#elif defined( EE_NEON )
+static inline void StoreQuadsCorner( eeVertex * V, const float32x4_t& X, const float32x4_t& Y ) {
+	float32x4x2_t xy = vzipq_f32( X, Y );
+
+	vst1_f32( reinterpret_cast<float*>( &V[0].pos ), vget_low_f32( xy.val[0] ) );
+	vst1_f32( reinterpret_cast<float*>( &V[4].pos ), vget_high_f32( xy.val[0] ) );
+	vst1_f32( reinterpret_cast<float*>( &V[8].pos ), vget_low_f32( xy.val[1] ) );
+	vst1_f32( reinterpret_cast<float*>( &V[12].pos ), vget_high_f32( xy.val[1] ) );
+}
+#endif
+
+eeBatchTransform BatchTransformCreate( const eeVector2f& Position, const eeVector2f& Center, const eeFloat& Rotation, const eeVector2f& Scale ) {
+	eeFloat Rad	= Rotation * EE_PI_180;
+	eeFloat Cos	= eecos( Rad );
+	eeFloat Sin	= eesin( Rad );
+
+	eeBatchTransform T;
+	T.a		= Cos * Scale.x;
+	T.b		= Sin * Scale.x;
+	T.c		= -Sin * Scale.y;
+	T.d		= Cos * Scale.y;
+	T.tx	= Position.x + Center.x - ( T.a * Center.x + T.c * Center.y );
+	T.ty	= Position.y + Center.y - ( T.b * Center.x + T.d * Center.y );
+
+	return T;
+}
+
+void BatchTransformVertexs( eeVertex * Vertex, const Uint32& Count, const eeBatchTransform& T ) {
+	Uint32 i = 0;
+
+	#if defined( EE_SSE2 )
+	// Two vertexs per iteration: [ x0 y0 x1 y1 ]
+	__m128 ab	= _mm_setr_ps( T.a, T.b, T.a, T.b );
+	__m128 cd	= _mm_setr_ps( T.c, T.d, T.c, T.d );
+	__m128 t	= _mm_setr_ps( T.tx, T.ty, T.tx, T.ty );
+
+	for ( ; i + 1 < Count; i += 2 ) {
+		__m128 p = _mm_setzero_ps();
+		p = _mm_loadl_pi( p, reinterpret_cast<const __m64*>( &Vertex[i].pos ) );
+		p = _mm_loadh_pi( p, reinterpret_cast<const __m64*>( &Vertex[i + 1].pos ) );
+
+		__m128 xx	= _mm_shuffle_ps( p, p, _MM_SHUFFLE( 2, 2, 0, 0 ) );
+		__m128 yy	= _mm_shuffle_ps( p, p, _MM_SHUFFLE( 3, 3, 1, 1 ) );
+		__m128 r	= _mm_add_ps( _mm_add_ps( _mm_mul_ps( xx, ab ), _mm_mul_ps( yy, cd ) ), t );
+
+		_mm_storel_pi( reinterpret_cast<__m64*>( &Vertex[i].pos ), r );
+		_mm_storeh_pi( reinterpret_cast<__m64*>( &Vertex[i + 1].pos ), r );
+	}
+	#elif defined( EE_NEON )
+	float32x2_t ab	= { T.a, T.b };
+	float32x2_t cd	= { T.c, T.d };
+	float32x2_t t	= { T.tx, T.ty };
+
+	for ( ; i < Count; i++ ) {
+		float * pos		= reinterpret_cast<float*>( &Vertex[i].pos );
+		float32x2_t p	= vld1_f32( pos );
+		float32x2_t r	= vmla_lane_f32( vmla_lane_f32( t, ab, p, 0 ), cd, p, 1 );
+
+		vst1_f32( pos, r );
+	}
+	#endif
+
+	for ( ; i < Count; i++ ) {
+		eeVector2f& pos = Vertex[i].pos;
+		eeFloat x = pos.x;
+
+		pos.x = T.a * x + T.c * pos.y + T.tx;
+		pos.y = T.b * x + T.d * pos.y + T.ty;
+	}
+}
+
+void BatchQuadsGenerate( eeVertex * Vertex, const Uint32& Count, const eeVector2f * Positions, const eeVector2f * Sizes, const eeFloat * Angles, const eeRectf * TexCoords, const eeColorA * Colors, const eeTexCoord * DefTexCoords, const eeColorA * DefColors ) {
+	Uint32 i = 0;
+
+	// The corners of a quad rotated around its center ( cx, cy ), with half extents ( hw, hh ):
+	// A = hw * cos, B = hh * sin, C = hw * sin, D = hh * cos
+	// v0 = ( cx - A + B, cy - C - D ) v1 = ( cx - A - B, cy - C + D ) v2 = ( cx + A - B, cy + C + D ) v3 = ( cx + A + B, cy + C - D )
+	#if defined( EE_SSE2 ) || defined( EE_NEON )
+	for ( ; i + 3 < Count; i += 4 ) {
+		float px[4], py[4], hw[4], hh[4], cs[4], sn[4];
+
+		for ( Uint32 q = 0; q < 4; q++ ) {
+			px[q]	= Positions[ i + q ].x;
+			py[q]	= Positions[ i + q ].y;
+			hw[q]	= Sizes[ i + q ].x * 0.5f;
+			hh[q]	= Sizes[ i + q ].y * 0.5f;
+
+			if ( NULL != Angles && 0 != Angles[ i + q ] ) {
+				eeFloat Rad = Angles[ i + q ] * EE_PI_180;
+				cs[q]	= eecos( Rad );
+				sn[q]	= eesin( Rad );
+			} else {
+				cs[q]	= 1;
+				sn[q]	= 0;
+			}
+		}
+
+		#if defined( EE_SSE2 )
+		__m128 HW	= _mm_loadu_ps( hw );
+		__m128 HH	= _mm_loadu_ps( hh );
+		__m128 CS	= _mm_loadu_ps( cs );
+		__m128 SN	= _mm_loadu_ps( sn );
+		__m128 CX	= _mm_add_ps( _mm_loadu_ps( px ), HW );
+		__m128 CY	= _mm_add_ps( _mm_loadu_ps( py ), HH );
+		__m128 A	= _mm_mul_ps( HW, CS );
+		__m128 B	= _mm_mul_ps( HH, SN );
+		__m128 C	= _mm_mul_ps( HW, SN );
+		__m128 D	= _mm_mul_ps( HH, CS );
+		__m128 XmA	= _mm_sub_ps( CX, A );
+		__m128 XpA	= _mm_add_ps( CX, A );
+		__m128 YmC	= _mm_sub_ps( CY, C );
+		__m128 YpC	= _mm_add_ps( CY, C );
+
+		eeVertex * V = &Vertex[ i * 4 ];
+
+		StoreQuadsCorner( V		, _mm_add_ps( XmA, B ), _mm_sub_ps( YmC, D ) );
+		StoreQuadsCorner( V + 1	, _mm_sub_ps( XmA, B ), _mm_add_ps( YmC, D ) );
+		StoreQuadsCorner( V + 2	, _mm_sub_ps( XpA, B ), _mm_add_ps( YpC, D ) );
+		StoreQuadsCorner( V + 3	, _mm_add_ps( XpA, B ), _mm_sub_ps( YpC, D ) );
+		#else
+		float32x4_t HW	= vld1q_f32( hw );
+		float32x4_t HH	= vld1q_f32( hh );
+		float32x4_t CS	= vld1q_f32( cs );
+		float32x4_t SN	= vld1q_f32( sn );
+		float32x4_t CX	= vaddq_f32( vld1q_f32( px ), HW );
+		float32x4_t CY	= vaddq_f32( vld1q_f32( py ), HH );
+		float32x4_t A	= vmulq_f32( HW, CS );
+		float32x4_t B	= vmulq_f32( HH, SN );
+		float32x4_t C	= vmulq_f32( HW, SN );
+		float32x4_t D	= vmulq_f32( HH, CS );
+		float32x4_t XmA	= vsubq_f32( CX, A );
+		float32x4_t XpA	= vaddq_f32( CX, A );
+		float32x4_t YmC	= vsubq_f32( CY, C );
+		float32x4_t YpC	= vaddq_f32( CY, C );
+
+		eeVertex * V = &Vertex[ i * 4 ];
+
+		StoreQuadsCorner( V		, vaddq_f32( XmA, B ), vsubq_f32( YmC, D ) );
+		StoreQuadsCorner( V + 1	, vsubq_f32( XmA, B ), vaddq_f32( YmC, D ) );
+		StoreQuadsCorner( V + 2	, vsubq_f32( XpA, B ), vaddq_f32( YpC, D ) );
+		StoreQuadsCorner( V + 3	, vaddq_f32( XpA, B ), vsubq_f32( YpC, D ) );
+		#endif
+	}
+	#endif
+
+	for ( ; i < Count; i++ ) {
+		eeFloat hw = Sizes[i].x * 0.5f;
+		eeFloat hh = Sizes[i].y * 0.5f;
+		eeFloat cx = Positions[i].x + hw;
+		eeFloat cy = Positions[i].y + hh;
+		eeFloat cs = 1;
+		eeFloat sn = 0;
+
+		if ( NULL != Angles && 0 != Angles[i] ) {
+			eeFloat Rad = Angles[i] * EE_PI_180;
+			cs	= eecos( Rad );
+			sn	= eesin( Rad );
+		}
+
+		eeFloat A = hw * cs, B = hh * sn, C = hw * sn, D = hh * cs;
+
+		eeVertex * V = &Vertex[ i * 4 ];
+
+		V[0].pos.x = cx - A + B;	V[0].pos.y = cy - C - D;
+		V[1].pos.x = cx - A - B;	V[1].pos.y = cy - C + D;
+		V[2].pos.x = cx + A - B;	V[2].pos.y = cy + C + D;
+		V[3].pos.x = cx + A + B;	V[3].pos.y = cy + C - D;
+	}
+
+	for ( i = 0; i < Count; i++ ) {
+		eeVertex * V = &Vertex[ i * 4 ];
+
+		if ( NULL != TexCoords ) {
+			const eeRectf& R = TexCoords[i];
+
+			V[0].tex.u = R.Left;	V[0].tex.v = R.Top;
+			V[1].tex.u = R.Left;	V[1].tex.v = R.Bottom;
+			V[2].tex.u = R.Right;	V[2].tex.v = R.Bottom;
+			V[3].tex.u = R.Right;	V[3].tex.v = R.Top;
+		} else {
+			V[0].tex = DefTexCoords[0];
+			V[1].tex = DefTexCoords[1];
+			V[2].tex = DefTexCoords[2];
+			V[3].tex = DefTexCoords[3];
+		}
+
+		if ( NULL != Colors ) {
+			V[0].color = V[1].color = V[2].color = V[3].color = Colors[i];
+		} else {
+			V[0].color = DefColors[0];
+			V[1].color = DefColors[1];
+			V[2].color = DefColors[2];
+			V[3].color = DefColors[3];
+		}
+	}
+}
+
+void BatchPremultiplyColors( eeVertex * Vertex, const Uint32& Count, const bool& Additive ) {
+	Uint32 t;
+
+	for ( Uint32 i = 0; i < Count; i++ ) {
+		eeColorA& C = Vertex[i].color;
+
+		if ( 255 != C.Alpha ) {
+			// c * a / 255 rounded
+			t = C.Red * C.Alpha + 128;		C.Red	= (Uint8)( ( t + ( t >> 8 ) ) >> 8 );
+			t = C.Green * C.Alpha + 128;	C.Green	= (Uint8)( ( t + ( t >> 8 ) ) >> 8 );
+			t = C.Blue * C.Alpha + 128;		C.Blue	= (Uint8)( ( t + ( t >> 8 ) ) >> 8 );
+		}
+
+		if ( Additive )
+			C.Alpha = 0;
+	}
+}
+
+}}}
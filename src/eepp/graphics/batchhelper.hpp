@@ -0,0 +1,36 @@
+#ifndef EE_GRAPHICSBATCHHELPER_HPP
+#define EE_GRAPHICSBATCHHELPER_HPP
+
+#include <eepp/graphics/cbatchrenderer.hpp>
+
+namespace EE { namespace Graphics { namespace Private {
+
+/** @brief An affine 2D transform ( x' = a * x + c * y + tx, y' = b * x + d * y + ty ), the same transform that the batch renderer builds with the matrix stack. */
+struct eeBatchTransform {
+	eeFloat a;
+	eeFloat b;
+	eeFloat c;
+	eeFloat d;
+	eeFloat tx;
+	eeFloat ty;
+};
+
+/** Builds the transform of a batch: translate to Position + Center, rotate ( in degrees ), scale and translate back from the Center. */
+eeBatchTransform BatchTransformCreate( const eeVector2f& Position, const eeVector2f& Center, const eeFloat& Rotation, const eeVector2f& Scale );
+
+/** Applies the transform to the position of the vertexs ( uses SSE2 or NEON when available ) */
+void BatchTransformVertexs( eeVertex * Vertex, const Uint32& Count, const eeBatchTransform& Transform );
+
+/** Emits 4 vertexs per quad, the quads positions are generated 4 at a time with SSE2 or NEON when available.
+*	Every quad is rotated around its center. Angles, TexCoords and Colors are optional, when NULL no rotation is applied and
+*	DefTexCoords and DefColors ( 4 elements, one per vertex ) are used.
+*/
+void BatchQuadsGenerate( eeVertex * Vertex, const Uint32& Count, const eeVector2f * Positions, const eeVector2f * Sizes, const eeFloat * Angles, const eeRectf * TexCoords, const eeColorA * Colors, const eeTexCoord * DefTexCoords, const eeColorA * DefColors );
+
+/** Multiplies the color of the vertexs by its alpha, for the ALPHA_PREMULTIPLIED blend.
+*	If Additive is true the alpha is set to 0, so the premultiplied blend gives the same result than ALPHA_BLENDONE. */
+void BatchPremultiplyColors( eeVertex * Vertex, const Uint32& Count, const bool& Additive );
+
+}}}
+
+#endif
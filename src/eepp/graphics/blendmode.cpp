@@ -15,13 +15,13 @@ void BlendMode::SetMode( const EE_BLEND_MODE& blend, bool force ) {
 			switch (blend) {
 				case ALPHA_NORMAL:
 					if ( GLi->IsExtension( EEGL_EXT_blend_func_separate ) )
-						glBlendFuncSeparateEXT( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA );
+						GLi->BlendFuncSeparate( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA );
 					else
 						GLi->BlendFunc(GL_SRC_ALPHA , GL_ONE_MINUS_SRC_ALPHA);
 					break;
 				case ALPHA_BLENDONE:
 					if ( GLi->IsExtension( EEGL_EXT_blend_func_separate ) )
-						glBlendFuncSeparateEXT( GL_SRC_ALPHA, GL_ONE, GL_ONE, GL_ONE );
+						GLi->BlendFuncSeparate( GL_SRC_ALPHA, GL_ONE, GL_ONE, GL_ONE );
 					else
 						GLi->BlendFunc(GL_SRC_ALPHA , GL_ONE);
 					break;
@@ -42,6 +42,9 @@ void BlendMode::SetMode( const EE_BLEND_MODE& blend, bool force ) {
 				case ALPHA_MULTIPLY:
 					GLi->BlendFunc(GL_DST_COLOR,GL_ZERO);
 					break;
+				case ALPHA_PREMULTIPLIED:
+					GLi->BlendFunc(GL_ONE , GL_ONE_MINUS_SRC_ALPHA);
+					break;
 				case ALPHA_NONE:
 					// Avoid compiler warning
 					break;
@@ -0,0 +1,198 @@
+#include <eepp/graphics/cbatchrecorder.hpp>
+#include <eepp/graphics/cglobalbatchrenderer.hpp>
+#include <algorithm>
+
+namespace EE { namespace Graphics {
+
+// Keeps space for one spare vertex after the last one, the GL3 Core Profile renderer uploads "allocate" bytes from every attribute pointer
+static void ReserveSpareVertex( std::vector<eeVertex>& Vertexs, const Uint32& Count ) {
+	if ( Vertexs.capacity() < Vertexs.size() + Count + 1 ) {
+		Vertexs.reserve( ( Vertexs.size() + Count + 1 ) * 2 );
+	}
+}
+
+cBatchRecorder::cBatchRecorder( const Int32& Order, const eeUint& Prealloc ) :
+	cBatchRenderer( Prealloc ),
+	mOrder( Order )
+{
+	mRecording = true;
+}
+
+cBatchRecorder::~cBatchRecorder() {
+}
+
+void cBatchRecorder::Order( const Int32& order ) {
+	mOrder = order;
+}
+
+const Int32& cBatchRecorder::Order() const {
+	return mOrder;
+}
+
+void cBatchRecorder::Finish() {
+	Flush();
+}
+
+void cBatchRecorder::Clear() {
+	mCommands.clear();
+	mArena.clear();
+}
+
+Uint32 cBatchRecorder::GetCommandsCount() const {
+	return (Uint32)mCommands.size();
+}
+
+Uint32 cBatchRecorder::GetVertexsCount() const {
+	return (Uint32)mArena.size();
+}
+
+void cBatchRecorder::Render( eeVertex * Vertex, const Uint32& NumVertex ) {
+	cCommand Cmd;
+	Cmd.Mode		= mCurrentMode;
+	Cmd.Blend		= mBlend;
+	Cmd.Texture		= mTexture;
+	Cmd.Start		= (Uint32)mArena.size();
+	Cmd.Count		= NumVertex;
+
+	// The baked vertexs are already transformed
+	if ( mBakeTransform ) {
+		Cmd.Rotation	= 0;
+		Cmd.Scale		= eeVector2f::One;
+		Cmd.Position	= eeVector2f( 0, 0 );
+		Cmd.Center		= eeVector2f( 0, 0 );
+	} else {
+		Cmd.Rotation	= mRotation;
+		Cmd.Scale		= mScale;
+		Cmd.Position	= mPosition;
+		Cmd.Center		= mCenter;
+	}
+
+	ReserveSpareVertex( mArena, NumVertex );
+
+	mArena.insert( mArena.end(), Vertex, Vertex + NumVertex );
+
+	if ( !mCommands.empty() && SameState( mCommands.back(), Cmd ) ) {
+		mCommands.back().Count += NumVertex;
+	} else {
+		mCommands.push_back( Cmd );
+	}
+}
+
+bool cBatchRecorder::SameState( const cCommand& a, const cCommand& b ) {
+	// Only the modes with independent primitives can be concatenated
+	if ( DM_QUADS != a.Mode && DM_TRIANGLES != a.Mode && DM_LINES != a.Mode && DM_POINTS != a.Mode )
+		return false;
+
+	return	a.Mode == b.Mode && a.Blend == b.Blend && a.Texture == b.Texture && a.Rotation == b.Rotation &&
+			a.Scale == b.Scale && a.Position == b.Position && a.Center == b.Center;
+}
+
+bool cBatchRecorder::OrderLess( const cBatchRecorder * a, const cBatchRecorder * b ) {
+	return a->mOrder < b->mOrder;
+}
+
+void cBatchRecorder::DrawCommand( const cCommand& Cmd, eeVertex * Vertex, const Uint32& NumVertex ) {
+	mCurrentMode	= Cmd.Mode;
+	mBlend			= Cmd.Blend;
+	mTexture		= Cmd.Texture;
+	mRotation		= Cmd.Rotation;
+	mScale			= Cmd.Scale;
+	mPosition		= Cmd.Position;
+	mCenter			= Cmd.Center;
+
+	cBatchRenderer::Render( Vertex, NumVertex );
+}
+
+void cBatchRecorder::Submit( cBatchRecorder ** Recorders, const Uint32& Count, const bool& ClearRecorders ) {
+	std::vector<cBatchRecorder*> Sorted;
+
+	for ( Uint32 i = 0; i < Count; i++ ) {
+		if ( NULL != Recorders[i] )
+			Sorted.push_back( Recorders[i] );
+	}
+
+	if ( Sorted.empty() )
+		return;
+
+	std::stable_sort( Sorted.begin(), Sorted.end(), OrderLess );
+
+	// The recorded geometry is drawn over the geometry already batched
+	cGlobalBatchRenderer::instance()->Draw();
+
+	// The first recorder draws everything, its state is restored when it's done
+	cBatchRecorder * Drawer			= Sorted[0];
+	EE_DRAW_MODE Mode				= Drawer->mCurrentMode;
+	EE_BLEND_MODE Blend				= Drawer->mBlend;
+	const cTexture * Texture		= Drawer->mTexture;
+	eeFloat Rotation				= Drawer->mRotation;
+	eeVector2f Scale				= Drawer->mScale;
+	eeVector2f Position				= Drawer->mPosition;
+	eeVector2f Center				= Drawer->mCenter;
+	bool Bake						= Drawer->mBakeTransform;
+
+	Drawer->mBakeTransform = false;
+
+	std::vector<eeVertex>& Merged = Drawer->mMerged;
+	const cCommand * Run = NULL;
+	Uint32 RunCount = 0;
+	eeVertex * RunVertex = NULL;
+
+	for ( Uint32 r = 0; r < Sorted.size(); r++ ) {
+		cBatchRecorder * Rec = Sorted[r];
+
+		for ( Uint32 c = 0; c < Rec->mCommands.size(); c++ ) {
+			const cCommand& Cmd = Rec->mCommands[c];
+			eeVertex * Vertex = &Rec->mArena[ Cmd.Start ];
+
+			if ( NULL != Run && SameState( *Run, Cmd ) ) {
+				// Start merging the run in the drawer scratch buffer
+				if ( 1 == RunCount ) {
+					Merged.assign( RunVertex, RunVertex + Run->Count );
+				}
+
+				ReserveSpareVertex( Merged, Cmd.Count );
+
+				Merged.insert( Merged.end(), Vertex, Vertex + Cmd.Count );
+				RunCount++;
+				continue;
+			}
+
+			if ( NULL != Run ) {
+				if ( 1 == RunCount ) {
+					Drawer->DrawCommand( *Run, RunVertex, Run->Count );
+				} else {
+					Drawer->DrawCommand( *Run, &Merged[0], (Uint32)Merged.size() );
+				}
+			}
+
+			Run			= &Cmd;
+			RunCount	= 1;
+			RunVertex	= Vertex;
+		}
+	}
+
+	if ( NULL != Run ) {
+		if ( 1 == RunCount ) {
+			Drawer->DrawCommand( *Run, RunVertex, Run->Count );
+		} else {
+			Drawer->DrawCommand( *Run, &Merged[0], (Uint32)Merged.size() );
+		}
+	}
+
+	Drawer->mCurrentMode	= Mode;
+	Drawer->mBlend			= Blend;
+	Drawer->mTexture		= Texture;
+	Drawer->mRotation		= Rotation;
+	Drawer->mScale			= Scale;
+	Drawer->mPosition		= Position;
+	Drawer->mCenter			= Center;
+	Drawer->mBakeTransform	= Bake;
+
+	if ( ClearRecorders ) {
+		for ( Uint32 r = 0; r < Sorted.size(); r++ ) {
+			Sorted[r]->Clear();
+		}
+	}
+}
+
+}}
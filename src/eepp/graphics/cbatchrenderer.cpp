@@ -3,6 +3,12 @@
 #include <eepp/graphics/ctexturefactory.hpp>
 #include <eepp/graphics/cglobalbatchrenderer.hpp>
 #include <eepp/graphics/renderer/cgl.hpp>
+#include <eepp/graphics/cvertexstreambuffer.hpp>
+#include <eepp/graphics/cquadindexbuffer.hpp>
+#include <eepp/graphics/batchhelper.hpp>
+#include <eepp/graphics/cstaticbatch.hpp>
+#include <eepp/system/cprofiler.hpp>
+#include <algorithm>
 
 namespace EE { namespace Graphics {
 
@@ -14,13 +20,30 @@ cBatchRenderer::cBatchRenderer() :
 	mTexture(NULL),
 	mTF( cTextureFactory::instance() ),
 	mBlend(ALPHA_NORMAL),
+	mRequestedBlend(ALPHA_NORMAL),
+	mAdditive(false),
 	mCurrentMode(DM_QUADS),
 	mRotation(0.0f),
 	mScale(1.0f,1.0f),
 	mPosition(0.0f, 0.0f),
 	mCenter(0.0f, 0.0f),
 	mForceRendering(false),
-	mForceBlendMode(true)
+	mForceBlendMode(true),
+	mDeferred(false),
+	mLayer(0),
+	mFlushesTaken(0),
+	mFlushesAvoided(0),
+	mStreaming(false),
+	mStreamingActive(false),
+	mStream(NULL),
+	mVertexFormat(BVF_FLOAT),
+	mPackedActive(false),
+	mBakeTransform(false),
+	mRecording(false),
+	mCapture(NULL),
+	mMultiTexture(false),
+	mSlotted(false),
+	mSlotsCount(0)
 {
 	AllocVertexs( 1024 );
 	Init();
@@ -34,13 +57,30 @@ cBatchRenderer::cBatchRenderer( const eeUint& Prealloc ) :
 	mTexture(NULL),
 	mTF( cTextureFactory::instance() ),
 	mBlend(ALPHA_NORMAL),
+	mRequestedBlend(ALPHA_NORMAL),
+	mAdditive(false),
 	mCurrentMode(DM_QUADS),
 	mRotation(0.0f),
 	mScale(1.0f,1.0f),
 	mPosition(0.0f, 0.0f),
 	mCenter(0.0f, 0.0f),
 	mForceRendering(false),
-	mForceBlendMode(true)
+	mForceBlendMode(true),
+	mDeferred(false),
+	mLayer(0),
+	mFlushesTaken(0),
+	mFlushesAvoided(0),
+	mStreaming(false),
+	mStreamingActive(false),
+	mStream(NULL),
+	mVertexFormat(BVF_FLOAT),
+	mPackedActive(false),
+	mBakeTransform(false),
+	mRecording(false),
+	mCapture(NULL),
+	mMultiTexture(false),
+	mSlotted(false),
+	mSlotsCount(0)
 {
 	AllocVertexs( Prealloc );
 	Init();
@@ -48,6 +88,7 @@ cBatchRenderer::cBatchRenderer( const eeUint& Prealloc ) :
 
 cBatchRenderer::~cBatchRenderer() {
 	eeSAFE_DELETE_ARRAY( mVertex );
+	eeSAFE_DELETE( mStream );
 }
 
 void cBatchRenderer::Init() {
@@ -59,6 +100,7 @@ void cBatchRenderer::AllocVertexs( const eeUint& size ) {
 	mVertex		= eeNewArray( eeVertex, size );
 	mVertexSize = size;
 	mNumVertex	= 0;
+	mDeferredPrims.clear();
 }
 
 void cBatchRenderer::DrawOpt() {
@@ -71,20 +113,57 @@ void cBatchRenderer::Draw() {
 }
 
 void cBatchRenderer::SetTexture( const cTexture * Tex ) {
-	if ( mTexture != Tex )
+	if ( mTexture != Tex && !IsDeferring() && !IsMultiTexturing() )
 		Flush();
 
 	mTexture = Tex;
+
+	// The blend used depends on the texture
+	if ( ALPHA_PREMULTIPLIED == mBlend || ( NULL != mTexture && mTexture->Premultiplied() ) )
+		SetBlendMode( mRequestedBlend );
 }
 
 void cBatchRenderer::SetBlendMode( const EE_BLEND_MODE& Blend ) {
-	if ( Blend != mBlend )
+	EE_BLEND_MODE Mode = Blend;
+
+	mRequestedBlend	= Blend;
+	mAdditive		= false;
+
+	// The premultiplied textures are drawn with the premultiplied blend, the additive blend is done setting the vertexs alpha to 0
+	if ( NULL != mTexture && mTexture->Premultiplied() && ( ALPHA_NORMAL == Blend || ALPHA_BLENDONE == Blend ) ) {
+		Mode		= ALPHA_PREMULTIPLIED;
+		mAdditive	= ALPHA_BLENDONE == Blend;
+	}
+
+	if ( Mode != mBlend && !IsDeferring() )
 		Flush();
 
-	mBlend = Blend;
+	mBlend = Mode;
 }
 
 void cBatchRenderer::AddVertexs( const eeUint& num ) {
+	if ( ALPHA_PREMULTIPLIED == mBlend ) {
+		Private::BatchPremultiplyColors( &mVertex[ mNumVertex ], num, mAdditive );
+	}
+
+	if ( mBakeTransform && HasTransform() ) {
+		Private::BatchTransformVertexs( &mVertex[ mNumVertex ], num, Private::BatchTransformCreate( mPosition, mCenter, mRotation, mScale ) );
+	}
+
+	if ( IsMultiTexturing() && !SlotVertexs( num ) ) {
+		// Draw them by themselves, with their own texture
+		FlushExcept( num );
+
+		mNumVertex = num;
+
+		Flush();
+
+		return;
+	}
+
+	if ( IsDeferring() )
+		DeferPrimitive( mNumVertex, num );
+
 	mNumVertex += num;
 
 	if ( ( mNumVertex + num ) >= mVertexSize )
@@ -98,17 +177,55 @@ void cBatchRenderer::SetBlendMode( EE_DRAW_MODE Mode, const bool& Force ) {
 	}
 }
 
-void cBatchRenderer::Flush() {	
+void cBatchRenderer::Flush() {
 	if ( mNumVertex == 0 )
 		return;
 
-	if ( cGlobalBatchRenderer::instance() != this )
+	eePROFILE_ZONE( "Batch Flush" );
+
+	// The recording batches don't draw, so they don't need to keep the order with the global batch renderer
+	if ( !mRecording && cGlobalBatchRenderer::instance() != this )
 		cGlobalBatchRenderer::instance()->Draw();
 
+	if ( !mDeferredPrims.empty() ) {
+		DrawDeferred();
+		return;
+	}
+
 	Uint32 NumVertex = mNumVertex;
 	mNumVertex = 0;
 
-	bool CreateMatrix = ( mRotation || mScale != 1.0f || mPosition.x || mPosition.y );
+	if ( mSlotted ) {
+		RenderMultiTexture( mVertex, NumVertex );
+	} else {
+		Render( mVertex, NumVertex );
+	}
+}
+
+void cBatchRenderer::Render( eeVertex * Vertex, const Uint32& NumVertex ) {
+	// A static batch is recording, the vertexs are kept by it instead of drawn
+	if ( NULL != mCapture ) {
+		if ( !mBakeTransform && HasTransform() ) {
+			Private::BatchTransformVertexs( Vertex, NumVertex, Private::BatchTransformCreate( mPosition, mCenter, mRotation, mScale ) );
+		}
+
+		mCapture->Capture( mCurrentMode, mBlend, mTexture, Vertex, NumVertex );
+
+		return;
+	}
+
+	// The quads indexes are 16 bits, so the bigger batches are drawn in chunks
+	if ( DM_QUADS == mCurrentMode && !GLi->QuadsSupported() && NumVertex > Private::cQuadIndexBuffer::MaxVertexs ) {
+		for ( Uint32 i = 0; i < NumVertex; i += Private::cQuadIndexBuffer::MaxVertexs ) {
+			cBatchRenderer::Render( Vertex + i, eemin( NumVertex - i, Private::cQuadIndexBuffer::MaxVertexs ) );
+		}
+
+		return;
+	}
+
+	mFlushesTaken++;
+
+	bool CreateMatrix = !mBakeTransform && HasTransform();
 
 	BlendMode::SetMode( mBlend );
 
@@ -127,22 +244,67 @@ void cBatchRenderer::Flush() {
 		GLi->Translatef( -mCenter.x, -mCenter.y, 0.0f);
 	}
 
-	Uint32 alloc	= sizeof(eeVertex) * NumVertex;
-
 	if ( NULL != mTexture ) {
 		mTF->Bind( mTexture );
-		GLi->TexCoordPointer( 2, GL_FP			, sizeof(eeVertex), reinterpret_cast<char*> ( &mVertex[0] ) + sizeof(eeVector2f)						, alloc		);
 	} else {
 		GLi->Disable( GL_TEXTURE_2D );
 		GLi->DisableClientState( GL_TEXTURE_COORD_ARRAY );
 	}
 
-	GLi->VertexPointer	( 2, GL_FP				, sizeof(eeVertex), reinterpret_cast<char*> ( &mVertex[0] )												, alloc		);
-	GLi->ColorPointer	( 4, GL_UNSIGNED_BYTE	, sizeof(eeVertex), reinterpret_cast<char*> ( &mVertex[0] ) + sizeof(eeVector2f) + sizeof(eeTexCoord)	, alloc		);
+	mPackedActive = BVF_PACKED == mVertexFormat && NULL != mTexture && PackVertexs( Vertex, NumVertex );
+
+	const char * Data;
+	GLsizei Stride;
+	GLenum TexType;
+	Uint32 ColorOffset;
+
+	if ( mPackedActive ) {
+		Data		= reinterpret_cast<const char*> ( &mPackedVertex[0] );
+		Stride		= sizeof(eeVertexPacked);
+		TexType		= GL_UNSIGNED_SHORT;
+		ColorOffset	= sizeof(eeVector2f) + sizeof(Uint16) * 2;
+	} else {
+		Data		= reinterpret_cast<const char*> ( &Vertex[0] );
+		Stride		= sizeof(eeVertex);
+		TexType		= GL_FP;
+		ColorOffset	= sizeof(eeVector2f) + sizeof(eeTexCoord);
+	}
+
+	Uint32 alloc	= Stride * NumVertex;
+
+	Int32 offset = -1;
+
+	if ( mStreaming ) {
+		if ( NULL == mStream ) {
+			mStream = eeNew( Private::cVertexStreamBuffer, () );
+		}
+
+		offset = mStream->Begin( Data, alloc );
+	}
+
+	mStreamingActive = -1 != offset;
+
+	if ( mStreamingActive ) {
+		if ( NULL != mTexture ) {
+			mStream->Pointer( EEGL_TEXTURE_COORD_ARRAY	, 2, TexType			, Stride, offset + sizeof(eeVector2f) );
+		} else {
+			mStream->DisablePointer( EEGL_TEXTURE_COORD_ARRAY );
+		}
+
+		mStream->Pointer( EEGL_VERTEX_ARRAY	, 2, GL_FP			, Stride, offset );
+		mStream->Pointer( EEGL_COLOR_ARRAY	, 4, GL_UNSIGNED_BYTE	, Stride, offset + ColorOffset );
+	} else {
+		if ( NULL != mTexture ) {
+			GLi->TexCoordPointer( 2, TexType		, Stride, Data + sizeof(eeVector2f)	, alloc		);
+		}
+
+		GLi->VertexPointer	( 2, GL_FP				, Stride, Data							, alloc		);
+		GLi->ColorPointer	( 4, GL_UNSIGNED_BYTE	, Stride, Data + ColorOffset			, alloc		);
+	}
 
 	if ( !GLi->QuadsSupported() ) {
 		if ( DM_QUADS == mCurrentMode ) {
-			GLi->DrawArrays( DM_TRIANGLES, 0, NumVertex );
+			Private::cQuadIndexBuffer::instance()->DrawQuads( NumVertex );
 		} else if ( DM_POLYGON == mCurrentMode ) {
 			GLi->DrawArrays( DM_TRIANGLE_FAN, 0, NumVertex );
 		} else {
@@ -152,6 +314,10 @@ void cBatchRenderer::Flush() {
 		GLi->DrawArrays( mCurrentMode, 0, NumVertex );
 	}
 
+	if ( mStreamingActive ) {
+		mStream->End();
+	}
+
 	if ( CreateMatrix ) {
 		GLi->PopMatrix();
 	}
@@ -171,7 +337,7 @@ void cBatchRenderer::BatchQuad( const eeFloat& x, const eeFloat& y, const eeFloa
 }
 
 void cBatchRenderer::BatchQuadEx( eeFloat x, eeFloat y, eeFloat width, eeFloat height, eeFloat angle, eeVector2f scale, eeOriginPoint originPoint ) {
-	if ( mNumVertex + ( GLi->QuadsSupported() ? 3 : 5 ) >= mVertexSize )
+	if ( mNumVertex + 3 >= mVertexSize )
 		return;
 
 	if ( originPoint.OriginType == eeOriginPoint::OriginCenter ) {
@@ -192,233 +358,144 @@ void cBatchRenderer::BatchQuadEx( eeFloat x, eeFloat y, eeFloat width, eeFloat h
 
 	SetBlendMode( DM_QUADS, mForceBlendMode );
 
-	if ( GLi->QuadsSupported() ) {
-		mTVertex 		= &mVertex[ mNumVertex ];
-		mTVertex->pos.x = x;
-		mTVertex->pos.y = y;
-		mTVertex->tex 	= mTexCoord[0];
-		mTVertex->color = mVerColor[0];
-		Rotate(originPoint, &mTVertex->pos, angle);
-
-		mTVertex 		= &mVertex[ mNumVertex + 1 ];
-		mTVertex->pos.x = x;
-		mTVertex->pos.y = y + height;
-		mTVertex->tex 	= mTexCoord[1];
-		mTVertex->color = mVerColor[1];
-		Rotate(originPoint, &mTVertex->pos, angle);
-
-		mTVertex 		= &mVertex[ mNumVertex + 2 ];
-		mTVertex->pos.x = x + width;
-		mTVertex->pos.y = y + height;
-		mTVertex->tex 	= mTexCoord[2];
-		mTVertex->color = mVerColor[2];
-		Rotate(originPoint, &mTVertex->pos, angle);
-
-		mTVertex 		= &mVertex[ mNumVertex + 3 ];
-		mTVertex->pos.x = x + width;
-		mTVertex->pos.y = y;
-		mTVertex->tex 	= mTexCoord[3];
-		mTVertex->color = mVerColor[3];
-		Rotate(originPoint, &mTVertex->pos, angle);
-
-		AddVertexs( 4 );
-	} else {
-		mTVertex 		= &mVertex[ mNumVertex ];
-		mTVertex->pos.x = x;
-		mTVertex->pos.y = y + height;
-		mTVertex->tex 	= mTexCoord[1];
-		mTVertex->color = mVerColor[1];
-		Rotate(originPoint, &mTVertex->pos, angle);
-
-		mTVertex 		= &mVertex[ mNumVertex + 1 ];
-		mTVertex->pos.x = x;
-		mTVertex->pos.y = y;
-		mTVertex->tex 	= mTexCoord[0];
-		mTVertex->color = mVerColor[0];
-		Rotate(originPoint, &mTVertex->pos, angle);
-
-		mTVertex 		= &mVertex[ mNumVertex + 2 ];
-		mTVertex->pos.x = x + width;
-		mTVertex->pos.y = y;
-		mTVertex->tex 	= mTexCoord[3];
-		mTVertex->color = mVerColor[3];
-		Rotate(originPoint, &mTVertex->pos, angle);
+	mTVertex 		= &mVertex[ mNumVertex ];
+	mTVertex->pos.x = x;
+	mTVertex->pos.y = y;
+	mTVertex->tex 	= mTexCoord[0];
+	mTVertex->color = mVerColor[0];
 
-		mTVertex 		= &mVertex[ mNumVertex + 3 ];
-		mTVertex->pos	= mVertex[ mNumVertex ].pos;
-		mTVertex->tex 	= mTexCoord[1];
-		mTVertex->color = mVerColor[1];
+	mTVertex 		= &mVertex[ mNumVertex + 1 ];
+	mTVertex->pos.x = x;
+	mTVertex->pos.y = y + height;
+	mTVertex->tex 	= mTexCoord[1];
+	mTVertex->color = mVerColor[1];
 
-		mTVertex 		= &mVertex[ mNumVertex + 4 ];
-		mTVertex->pos.x = x + width;
-		mTVertex->pos.y = y + height;
-		mTVertex->tex 	= mTexCoord[2];
-		mTVertex->color = mVerColor[2];
-		Rotate(originPoint, &mTVertex->pos, angle);
+	mTVertex 		= &mVertex[ mNumVertex + 2 ];
+	mTVertex->pos.x = x + width;
+	mTVertex->pos.y = y + height;
+	mTVertex->tex 	= mTexCoord[2];
+	mTVertex->color = mVerColor[2];
 
-		mTVertex 		= &mVertex[ mNumVertex + 5 ];
-		mTVertex->pos	= mVertex[ mNumVertex + 2 ].pos;
-		mTVertex->tex 	= mTexCoord[3];
-		mTVertex->color = mVerColor[3];
+	mTVertex 		= &mVertex[ mNumVertex + 3 ];
+	mTVertex->pos.x = x + width;
+	mTVertex->pos.y = y;
+	mTVertex->tex 	= mTexCoord[3];
+	mTVertex->color = mVerColor[3];
 
-		AddVertexs( 6 );
+	if ( 0 != angle ) {
+		Private::BatchTransformVertexs( &mVertex[ mNumVertex ], 4, Private::BatchTransformCreate( eeVector2f( 0, 0 ), originPoint, angle, eeVector2f::One ) );
 	}
+
+	AddVertexs( 4 );
 }
 
 void cBatchRenderer::BatchQuadFree( const eeFloat& x0, const eeFloat& y0, const eeFloat& x1, const eeFloat& y1, const eeFloat& x2, const eeFloat& y2, const eeFloat& x3, const eeFloat& y3 ) {
-	if ( mNumVertex + ( GLi->QuadsSupported() ? 3 : 5 ) >= mVertexSize )
+	if ( mNumVertex + 3 >= mVertexSize )
 		return;
 
 	SetBlendMode( DM_QUADS, mForceBlendMode );
 
-	if ( GLi->QuadsSupported() ) {
-		mTVertex 		= &mVertex[ mNumVertex ];
-		mTVertex->pos.x = x0;
-		mTVertex->pos.y = y0;
-		mTVertex->tex 	= mTexCoord[0];
-		mTVertex->color = mVerColor[0];
-
-		mTVertex 		= &mVertex[ mNumVertex + 1 ];
-		mTVertex->pos.x = x1;
-		mTVertex->pos.y = y1;
-		mTVertex->tex 	= mTexCoord[1];
-		mTVertex->color = mVerColor[1];
-
-		mTVertex 		= &mVertex[ mNumVertex + 2 ];
-		mTVertex->pos.x = x2;
-		mTVertex->pos.y = y2;
-		mTVertex->tex 	= mTexCoord[2];
-		mTVertex->color = mVerColor[2];
-
-		mTVertex 		= &mVertex[ mNumVertex + 3 ];
-		mTVertex->pos.x = x3;
-		mTVertex->pos.y = y3;
-		mTVertex->tex 	= mTexCoord[3];
-		mTVertex->color = mVerColor[3];
-
-		AddVertexs( 4 );
-	} else {
-		mTVertex 		= &mVertex[ mNumVertex ];
-		mTVertex->pos.x = x1;
-		mTVertex->pos.y = y1;
-		mTVertex->tex 	= mTexCoord[1];
-		mTVertex->color = mVerColor[1];
-
-		mTVertex 		= &mVertex[ mNumVertex + 1 ];
-		mTVertex->pos.x = x0;
-		mTVertex->pos.y = y0;
-		mTVertex->tex 	= mTexCoord[0];
-		mTVertex->color = mVerColor[0];
-
-		mTVertex 		= &mVertex[ mNumVertex + 2 ];
-		mTVertex->pos.x = x3;
-		mTVertex->pos.y = y3;
-		mTVertex->tex 	= mTexCoord[3];
-		mTVertex->color = mVerColor[3];
+	mTVertex 		= &mVertex[ mNumVertex ];
+	mTVertex->pos.x = x0;
+	mTVertex->pos.y = y0;
+	mTVertex->tex 	= mTexCoord[0];
+	mTVertex->color = mVerColor[0];
 
-		mTVertex 		= &mVertex[ mNumVertex + 3 ];
-		mTVertex->pos.x = x1;
-		mTVertex->pos.y = y1;
-		mTVertex->tex 	= mTexCoord[1];
-		mTVertex->color = mVerColor[1];
+	mTVertex 		= &mVertex[ mNumVertex + 1 ];
+	mTVertex->pos.x = x1;
+	mTVertex->pos.y = y1;
+	mTVertex->tex 	= mTexCoord[1];
+	mTVertex->color = mVerColor[1];
 
-		mTVertex 		= &mVertex[ mNumVertex + 4 ];
-		mTVertex->pos.x = x2;
-		mTVertex->pos.y = y2;
-		mTVertex->tex 	= mTexCoord[2];
-		mTVertex->color = mVerColor[2];
+	mTVertex 		= &mVertex[ mNumVertex + 2 ];
+	mTVertex->pos.x = x2;
+	mTVertex->pos.y = y2;
+	mTVertex->tex 	= mTexCoord[2];
+	mTVertex->color = mVerColor[2];
 
-		mTVertex 		= &mVertex[ mNumVertex + 5 ];
-		mTVertex->pos.x = x3;
-		mTVertex->pos.y = y3;
-		mTVertex->tex 	= mTexCoord[3];
-		mTVertex->color = mVerColor[3];
+	mTVertex 		= &mVertex[ mNumVertex + 3 ];
+	mTVertex->pos.x = x3;
+	mTVertex->pos.y = y3;
+	mTVertex->tex 	= mTexCoord[3];
+	mTVertex->color = mVerColor[3];
 
-		AddVertexs( 6 );
-	}
+	AddVertexs( 4 );
 }
 
 void cBatchRenderer::BatchQuadFreeEx( const eeFloat& x0, const eeFloat& y0, const eeFloat& x1, const eeFloat& y1, const eeFloat& x2, const eeFloat& y2, const eeFloat& x3, const eeFloat& y3, const eeFloat& Angle, const eeFloat& Scale ) {
-	if ( mNumVertex + ( GLi->QuadsSupported() ? 3 : 5 ) >= mVertexSize )
+	if ( mNumVertex + 3 >= mVertexSize )
 		return;
 
-	eeQuad2f mQ;
-	eeVector2f QCenter;
-	mQ.V[0].x = x0; mQ.V[1].x = x1; mQ.V[2].x = x2; mQ.V[3].x = x3;
-	mQ.V[0].y = y0; mQ.V[1].y = y1; mQ.V[2].y = y2; mQ.V[3].y = y3;
+	SetBlendMode( DM_QUADS, mForceBlendMode );
+
+	mTVertex 		= &mVertex[ mNumVertex ];
+	mTVertex->pos.x = x0;
+	mTVertex->pos.y = y0;
+	mTVertex->tex 	= mTexCoord[0];
+	mTVertex->color = mVerColor[0];
+
+	mTVertex 		= &mVertex[ mNumVertex + 1 ];
+	mTVertex->pos.x = x1;
+	mTVertex->pos.y = y1;
+	mTVertex->tex 	= mTexCoord[1];
+	mTVertex->color = mVerColor[1];
+
+	mTVertex 		= &mVertex[ mNumVertex + 2 ];
+	mTVertex->pos.x = x2;
+	mTVertex->pos.y = y2;
+	mTVertex->tex 	= mTexCoord[2];
+	mTVertex->color = mVerColor[2];
+
+	mTVertex 		= &mVertex[ mNumVertex + 3 ];
+	mTVertex->pos.x = x3;
+	mTVertex->pos.y = y3;
+	mTVertex->tex 	= mTexCoord[3];
+	mTVertex->color = mVerColor[3];
 
 	if ( Angle != 0 ||  Scale != 1.0f ) {
-		QCenter = mQ.GetCenter();
-		mQ.Rotate( Angle, QCenter );
-		mQ.Scale( Scale, QCenter );
+		eeQuad2f mQ( eeVector2f( x0, y0 ), eeVector2f( x1, y1 ), eeVector2f( x2, y2 ), eeVector2f( x3, y3 ) );
+		eeVector2f QCenter = mQ.GetCenter();
+
+		Private::BatchTransformVertexs( &mVertex[ mNumVertex ], 4, Private::BatchTransformCreate( eeVector2f( 0, 0 ), QCenter, Angle, eeVector2f( Scale, Scale ) ) );
 	}
 
+	AddVertexs( 4 );
+}
+
+void cBatchRenderer::BatchQuadArray( const eeVector2f * Positions, const eeVector2f * Sizes, const eeFloat * Angles, const eeRectf * TexCoords, const eeColorA * Colors, const Uint32& Count ) {
+	if ( NULL == Positions || NULL == Sizes )
+		return;
+
 	SetBlendMode( DM_QUADS, mForceBlendMode );
 
-	if ( GLi->QuadsSupported() ) {
-		mTVertex 		= &mVertex[ mNumVertex ];
-		mTVertex->pos.x = mQ[0].x;
-		mTVertex->pos.y = mQ[0].y;
-		mTVertex->tex 	= mTexCoord[0];
-		mTVertex->color = mVerColor[0];
+	Uint32 Done = 0;
 
-		mTVertex 		= &mVertex[ mNumVertex + 1 ];
-		mTVertex->pos.x = mQ[1].x;
-		mTVertex->pos.y = mQ[1].y;
-		mTVertex->tex 	= mTexCoord[1];
-		mTVertex->color = mVerColor[1];
-
-		mTVertex 		= &mVertex[ mNumVertex + 2 ];
-		mTVertex->pos.x = mQ[2].x;
-		mTVertex->pos.y = mQ[2].y;
-		mTVertex->tex 	= mTexCoord[2];
-		mTVertex->color = mVerColor[2];
-
-		mTVertex 		= &mVertex[ mNumVertex + 3 ];
-		mTVertex->pos.x = mQ[3].x;
-		mTVertex->pos.y = mQ[3].y;
-		mTVertex->tex 	= mTexCoord[3];
-		mTVertex->color = mVerColor[3];
-
-		AddVertexs( 4 );
-	} else {
-		mTVertex 		= &mVertex[ mNumVertex ];
-		mTVertex->pos.x = mQ[1].x;
-		mTVertex->pos.y = mQ[1].y;
-		mTVertex->tex 	= mTexCoord[1];
-		mTVertex->color = mVerColor[1];
-
-		mTVertex 		= &mVertex[ mNumVertex + 1 ];
-		mTVertex->pos.x = mQ[0].x;
-		mTVertex->pos.y = mQ[0].y;
-		mTVertex->tex 	= mTexCoord[0];
-		mTVertex->color = mVerColor[0];
+	while ( Done < Count ) {
+		// Keep the same room that BatchQuadEx requires
+		Uint32 Room = mNumVertex + 4 <= mVertexSize ? ( mVertexSize - mNumVertex - 1 ) / 4 : 0;
+
+		if ( 0 == Room ) {
+			if ( 0 == mNumVertex )
+				return;
 
-		mTVertex 		= &mVertex[ mNumVertex + 2 ];
-		mTVertex->pos.x = mQ[3].x;
-		mTVertex->pos.y = mQ[3].y;
-		mTVertex->tex 	= mTexCoord[3];
-		mTVertex->color = mVerColor[3];
+			Flush();
+			continue;
+		}
 
-		mTVertex 		= &mVertex[ mNumVertex + 3 ];
-		mTVertex->pos.x = mQ[1].x;
-		mTVertex->pos.y = mQ[1].y;
-		mTVertex->tex 	= mTexCoord[1];
-		mTVertex->color = mVerColor[1];
+		Uint32 Num = eemin( Count - Done, Room );
 
-		mTVertex 		= &mVertex[ mNumVertex + 4 ];
-		mTVertex->pos.x = mQ[2].x;
-		mTVertex->pos.y = mQ[2].y;
-		mTVertex->tex 	= mTexCoord[2];
-		mTVertex->color = mVerColor[2];
+		Private::BatchQuadsGenerate( &mVertex[ mNumVertex ], Num, Positions + Done, Sizes + Done, NULL != Angles ? Angles + Done : NULL, NULL != TexCoords ? TexCoords + Done : NULL, NULL != Colors ? Colors + Done : NULL, mTexCoord, mVerColor );
 
-		mTVertex 		= &mVertex[ mNumVertex + 5 ];
-		mTVertex->pos.x = mQ[3].x;
-		mTVertex->pos.y = mQ[3].y;
-		mTVertex->tex 	= mTexCoord[3];
-		mTVertex->color = mVerColor[3];
+		if ( IsDeferring() ) {
+			// Every quad is deferred as its own primitive, so the overlap test keeps working per quad
+			for ( Uint32 q = 0; q < Num; q++ ) {
+				AddVertexs( 4 );
+			}
+		} else {
+			AddVertexs( Num * 4 );
+		}
 
-		AddVertexs( 6 );
+		Done += Num;
 	}
 }
 
@@ -763,4 +840,354 @@ const bool& cBatchRenderer::ForceBlendModeChange() const {
 	return mForceBlendMode;
 }
 
+void cBatchRenderer::BatchDeferred( const bool& deferred ) {
+	if ( mDeferred != deferred ) {
+		Flush();
+
+		mDeferred = deferred;
+	}
+}
+
+const bool& cBatchRenderer::BatchDeferred() const {
+	return mDeferred;
+}
+
+const Uint32& cBatchRenderer::FlushesTaken() const {
+	return mFlushesTaken;
+}
+
+const Uint32& cBatchRenderer::FlushesAvoided() const {
+	return mFlushesAvoided;
+}
+
+void cBatchRenderer::BatchStreaming( const bool& streaming ) {
+	Flush();
+
+	mStreaming = streaming;
+}
+
+const bool& cBatchRenderer::BatchStreaming() const {
+	return mStreaming;
+}
+
+const bool& cBatchRenderer::StreamingActive() const {
+	return mStreamingActive;
+}
+
+void cBatchRenderer::BatchVertexFormat( const EE_BATCH_VERTEX_FORMAT& format ) {
+	Flush();
+
+	mVertexFormat = format;
+}
+
+const EE_BATCH_VERTEX_FORMAT& cBatchRenderer::BatchVertexFormat() const {
+	return mVertexFormat;
+}
+
+const bool& cBatchRenderer::PackedActive() const {
+	return mPackedActive;
+}
+
+void cBatchRenderer::BatchBakeTransform( const bool& bake ) {
+	Flush();
+
+	mBakeTransform = bake;
+}
+
+const bool& cBatchRenderer::BatchBakeTransform() const {
+	return mBakeTransform;
+}
+
+void cBatchRenderer::BatchMultiTexture( const bool& multi ) {
+	Flush();
+
+	mMultiTexture = multi;
+}
+
+const bool& cBatchRenderer::BatchMultiTexture() const {
+	return mMultiTexture;
+}
+
+bool cBatchRenderer::IsMultiTexturing() const {
+	return	mMultiTexture && !mRecording && NULL == mCapture && !mDeferred && ( DM_QUADS == mCurrentMode || DM_TRIANGLES == mCurrentMode ) &&
+			GLi->MultiTextureUnits() > 1;
+}
+
+bool cBatchRenderer::SlotVertexs( const eeUint& num ) {
+	eeVertex * V = &mVertex[ mNumVertex ];
+	Uint32 Slot = EE_MAX_TEXTURE_UNITS;
+	eeUint i;
+
+	if ( NULL != mTexture ) {
+		// The shader decodes the slot from u, so u must be in the [-1,3) range
+		for ( i = 0; i < num; i++ ) {
+			if ( V[i].tex.u < -1.f || V[i].tex.u >= 3.f ) {
+				return false;
+			}
+		}
+
+		for ( Slot = 0; Slot < mSlotsCount && mSlots[ Slot ] != mTexture; Slot++ );
+
+		if ( Slot == mSlotsCount ) {
+			// Every unit is taken, draw the batched vertexs and start a new batch with these ones
+			if ( mSlotsCount >= eemin( GLi->MultiTextureUnits(), (Uint32)EE_MAX_TEXTURE_UNITS ) ) {
+				FlushExcept( num );
+
+				V = &mVertex[ mNumVertex ];
+			}
+
+			Slot = mSlotsCount;
+
+			mSlots[ mSlotsCount++ ] = mTexture;
+		}
+	}
+
+	if ( Slot ) {
+		for ( i = 0; i < num; i++ ) {
+			V[i].tex.u += Slot * EE_TEXTURE_SLOT_STRIDE;
+		}
+	}
+
+	mSlotted = true;
+
+	return true;
+}
+
+void cBatchRenderer::FlushExcept( const eeUint& num ) {
+	Uint32 Start = mNumVertex;
+
+	if ( 0 == Start )
+		return;
+
+	Flush();
+
+	std::copy( mVertex + Start, mVertex + Start + num, mVertex );
+}
+
+void cBatchRenderer::RenderMultiTexture( eeVertex * Vertex, const Uint32& NumVertex ) {
+	const cTexture * Texture = mTexture;
+	Uint32 i, v;
+
+	mSlotted = false;
+
+	if ( mSlotsCount > 0 && GLi->MultiTextureShader( true ) ) {
+		for ( i = 1; i < mSlotsCount; i++ ) {
+			mTF->Bind( mSlots[i], i );
+		}
+
+		mTexture = mSlots[0];
+
+		Render( Vertex, NumVertex );
+
+		GLi->MultiTextureShader( false );
+	} else {
+		// The shader can't be used now, decode the slots and draw every run of primitives with the same texture
+		Uint32 PrimSize = DM_QUADS == mCurrentMode ? 4 : 3;
+		Uint32 RunStart = 0;
+		Uint32 RunSlot = 0;
+
+		for ( i = 0; i < NumVertex; i += PrimSize ) {
+			Uint32 Slot = (Uint32)eefloor( ( Vertex[i].tex.u + 1.f ) / EE_TEXTURE_SLOT_STRIDE );
+
+			for ( v = i; v < i + PrimSize && v < NumVertex; v++ ) {
+				Vertex[v].tex.u -= Slot * EE_TEXTURE_SLOT_STRIDE;
+			}
+
+			if ( i > 0 && Slot != RunSlot ) {
+				mTexture = RunSlot < mSlotsCount ? mSlots[ RunSlot ] : NULL;
+
+				Render( Vertex + RunStart, i - RunStart );
+
+				RunStart = i;
+			}
+
+			RunSlot = Slot;
+		}
+
+		if ( NumVertex > RunStart ) {
+			mTexture = RunSlot < mSlotsCount ? mSlots[ RunSlot ] : NULL;
+
+			Render( Vertex + RunStart, NumVertex - RunStart );
+		}
+	}
+
+	mTexture	= Texture;
+	mSlotsCount	= 0;
+}
+
+bool cBatchRenderer::HasTransform() const {
+	return 0 != mRotation || mScale != 1.0f || 0 != mPosition.x || 0 != mPosition.y;
+}
+
+bool cBatchRenderer::PackVertexs( const eeVertex * Vertex, const Uint32& NumVertex ) {
+	// The fixed pipeline can't read normalized integer texture coordinates
+	EEGL_version Ver = GLi->Version();
+
+	if ( GLv_2 == Ver || GLv_ES1 == Ver || GLv_default == Ver ) {
+		return false;
+	}
+
+	// One spare vertex, the GL3 Core Profile renderer uploads "allocate" bytes from every attribute pointer
+	if ( mPackedVertex.size() < NumVertex + 1 ) {
+		mPackedVertex.resize( NumVertex + 1 );
+	}
+
+	eeVertexPacked * Packed = &mPackedVertex[0];
+
+	for ( Uint32 i = 0; i < NumVertex; i++ ) {
+		const eeTexCoord& tex = Vertex[i].tex;
+
+		if ( tex.u < 0.f || tex.u > 1.f || tex.v < 0.f || tex.v > 1.f ) {
+			return false;
+		}
+
+		Packed[i].pos	= Vertex[i].pos;
+		Packed[i].u		= (Uint16)( tex.u * 65535.f + 0.5f );
+		Packed[i].v		= (Uint16)( tex.v * 65535.f + 0.5f );
+		Packed[i].color	= Vertex[i].color;
+	}
+
+	return true;
+}
+
+void cBatchRenderer::ResetFlushStats() {
+	mFlushesTaken	= 0;
+	mFlushesAvoided	= 0;
+}
+
+bool cBatchRenderer::IsDeferring() const {
+	return mDeferred && ( DM_QUADS == mCurrentMode || DM_TRIANGLES == mCurrentMode );
+}
+
+void cBatchRenderer::DeferPrimitive( const Uint32& Start, const Uint32& Count ) {
+	cDeferredPrim Prim;
+	Prim.Layer		= mLayer;
+	Prim.Blend		= mBlend;
+	Prim.Texture	= mTexture;
+	Prim.Start		= Start;
+	Prim.Count		= Count;
+	Prim.Bounds		= eeRectf( mVertex[ Start ].pos.x, mVertex[ Start ].pos.y, mVertex[ Start ].pos.x, mVertex[ Start ].pos.y );
+
+	for ( Uint32 i = Start + 1; i < Start + Count; i++ ) {
+		const eeVector2f& pos = mVertex[i].pos;
+
+		Prim.Bounds.Left	= eemin( Prim.Bounds.Left	, pos.x );
+		Prim.Bounds.Top		= eemin( Prim.Bounds.Top	, pos.y );
+		Prim.Bounds.Right	= eemax( Prim.Bounds.Right	, pos.x );
+		Prim.Bounds.Bottom	= eemax( Prim.Bounds.Bottom	, pos.y );
+	}
+
+	mDeferredPrims.push_back( Prim );
+}
+
+bool cBatchRenderer::DeferredSameState( const cDeferredPrim& a, const cDeferredPrim& b ) {
+	return a.Layer == b.Layer && a.Blend == b.Blend && a.Texture == b.Texture;
+}
+
+static bool DeferredOverlaps( const eeRectf& a, const eeRectf& b ) {
+	// Primitives that only share an edge ( like adjacent tiles ) don't overlap
+	return a.Left < b.Right && b.Left < a.Right && a.Top < b.Bottom && b.Top < a.Bottom;
+}
+
+bool cBatchRenderer::DeferredLayerLess( const cDeferredPrim& a, const cDeferredPrim& b ) {
+	return a.Layer < b.Layer;
+}
+
+void cBatchRenderer::DrawDeferred() {
+	Uint32 NumVertex	= mNumVertex;
+	Uint32 NumPrims		= (Uint32)mDeferredPrims.size();
+	Uint32 StateRuns	= 1;
+	Uint32 i, b;
+
+	mNumVertex = 0;
+
+	// The state changes that the immediate mode would have flushed
+	for ( i = 1; i < NumPrims; i++ ) {
+		if ( !DeferredSameState( mDeferredPrims[ i - 1 ], mDeferredPrims[ i ] ) )
+			StateRuns++;
+	}
+
+	std::stable_sort( mDeferredPrims.begin(), mDeferredPrims.end(), DeferredLayerLess );
+
+	// Every primitive joins the latest batch with the same state that can be reached
+	// without moving the primitive behind a batch that it overlaps.
+	std::vector<cDeferredPrim> Batches;
+	std::vector<Uint32> PrimBatch( NumPrims );
+	Uint32 LayerStart = 0;
+
+	for ( i = 0; i < NumPrims; i++ ) {
+		cDeferredPrim& Prim = mDeferredPrims[i];
+		Uint32 Target = (Uint32)Batches.size();
+
+		if ( i > 0 && Prim.Layer != mDeferredPrims[ i - 1 ].Layer )
+			LayerStart = (Uint32)Batches.size();
+
+		for ( b = (Uint32)Batches.size(); b > LayerStart; b-- ) {
+			cDeferredPrim& Batch = Batches[ b - 1 ];
+
+			if ( DeferredSameState( Batch, Prim ) ) {
+				Target = b - 1;
+				break;
+			}
+
+			if ( DeferredOverlaps( Batch.Bounds, Prim.Bounds ) )
+				break;
+		}
+
+		if ( Target == Batches.size() ) {
+			Batches.push_back( Prim );
+			Batches.back().Count = 0;
+		} else {
+			cDeferredPrim& Batch = Batches[ Target ];
+
+			Batch.Bounds.Left	= eemin( Batch.Bounds.Left	, Prim.Bounds.Left		);
+			Batch.Bounds.Top	= eemin( Batch.Bounds.Top	, Prim.Bounds.Top		);
+			Batch.Bounds.Right	= eemax( Batch.Bounds.Right	, Prim.Bounds.Right		);
+			Batch.Bounds.Bottom	= eemax( Batch.Bounds.Bottom, Prim.Bounds.Bottom	);
+		}
+
+		Batches[ Target ].Count += Prim.Count;
+		PrimBatch[i] = Target;
+	}
+
+	Uint32 Offset = 0;
+
+	for ( b = 0; b < Batches.size(); b++ ) {
+		Batches[b].Start	= Offset;
+		Offset				+= Batches[b].Count;
+		Batches[b].Count	= 0;
+	}
+
+	// One spare vertex, the GL3 Core Profile renderer uploads "allocate" bytes from every attribute pointer
+	if ( mDeferredVertex.size() < NumVertex + 1 )
+		mDeferredVertex.resize( NumVertex + 1 );
+
+	for ( i = 0; i < NumPrims; i++ ) {
+		cDeferredPrim& Prim		= mDeferredPrims[i];
+		cDeferredPrim& Batch	= Batches[ PrimBatch[i] ];
+
+		std::copy( &mVertex[ Prim.Start ], &mVertex[ Prim.Start ] + Prim.Count, &mDeferredVertex[ Batch.Start + Batch.Count ] );
+
+		Batch.Count += Prim.Count;
+	}
+
+	mDeferredPrims.clear();
+
+	const cTexture * CurTexture	= mTexture;
+	EE_BLEND_MODE CurBlend		= mBlend;
+
+	for ( b = 0; b < Batches.size(); b++ ) {
+		mTexture	= Batches[b].Texture;
+		mBlend		= Batches[b].Blend;
+
+		Render( &mDeferredVertex[ Batches[b].Start ], Batches[b].Count );
+	}
+
+	mTexture	= CurTexture;
+	mBlend		= CurBlend;
+
+	if ( StateRuns > Batches.size() )
+		mFlushesAvoided += StateRuns - (Uint32)Batches.size();
+}
+
 }}
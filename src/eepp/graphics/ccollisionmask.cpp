@@ -0,0 +1,116 @@
+#include <eepp/graphics/ccollisionmask.hpp>
+
+namespace EE { namespace Graphics {
+
+// Pixels per word ( Uint64 is 32 bits wide in the platforms without 64 bits integers )
+static const Int32 MASK_WORD_BITS = sizeof(Uint64) * 8;
+
+cCollisionMask::cCollisionMask() :
+	mWidth(0),
+	mHeight(0),
+	mWordsPerRow(0)
+{
+}
+
+cCollisionMask::cCollisionMask( const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels, const Uint32& Pitch, const Uint8& AlphaThreshold ) :
+	mWidth(0),
+	mHeight(0),
+	mWordsPerRow(0)
+{
+	Create( Pixels, Width, Height, Channels, Pitch, AlphaThreshold );
+}
+
+void cCollisionMask::Create( const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels, const Uint32& Pitch, const Uint8& AlphaThreshold ) {
+	mWidth			= Width;
+	mHeight			= Height;
+	mWordsPerRow	= ( Width + MASK_WORD_BITS - 1 ) / MASK_WORD_BITS;
+
+	// The bits after the last pixel of every row are kept at 0
+	mBits.assign( mWordsPerRow * mHeight, 0 );
+
+	if ( NULL == Pixels || 0 == Channels ) {
+		return;
+	}
+
+	bool HasAlpha = 2 == Channels || 4 == Channels;
+
+	for ( Uint32 y = 0; y < mHeight; y++ ) {
+		const Uint8 * Alpha = Pixels + y * Pitch + ( Channels - 1 );
+		Uint64 * Row = &mBits[ y * mWordsPerRow ];
+
+		for ( Uint32 w = 0; w < mWordsPerRow; w++ ) {
+			Uint32 Count = eemin( (Uint32)MASK_WORD_BITS, mWidth - w * MASK_WORD_BITS );
+			Uint64 Word = 0;
+
+			if ( HasAlpha ) {
+				for ( Uint32 b = 0; b < Count; b++, Alpha += Channels ) {
+					if ( *Alpha > AlphaThreshold )
+						Word |= (Uint64)1 << b;
+				}
+			} else {
+				Word = (Int32)Count == MASK_WORD_BITS ? ~(Uint64)0 : ( ( (Uint64)1 << Count ) - 1 );
+			}
+
+			Row[w] = Word;
+		}
+	}
+}
+
+const Uint32& cCollisionMask::Width() const {
+	return mWidth;
+}
+
+const Uint32& cCollisionMask::Height() const {
+	return mHeight;
+}
+
+bool cCollisionMask::IsSolid( const Int32& X, const Int32& Y ) const {
+	if ( X < 0 || Y < 0 || X >= (Int32)mWidth || Y >= (Int32)mHeight )
+		return false;
+
+	return 0 != ( mBits[ Y * mWordsPerRow + X / MASK_WORD_BITS ] & ( (Uint64)1 << ( X % MASK_WORD_BITS ) ) );
+}
+
+Uint64 cCollisionMask::GetBits( const Uint64 * Row, const Int32& X ) const {
+	// The word that contains the pixel X ( X can be negative )
+	Int32 Word	= X >= 0 ? X / MASK_WORD_BITS : -( ( -X + MASK_WORD_BITS - 1 ) / MASK_WORD_BITS );
+	Int32 Shift	= X - Word * MASK_WORD_BITS;
+	Uint64 Lo	= ( Word >= 0 && Word < (Int32)mWordsPerRow ) ? Row[ Word ] : 0;
+
+	if ( 0 == Shift )
+		return Lo;
+
+	Uint64 Hi	= ( Word + 1 >= 0 && Word + 1 < (Int32)mWordsPerRow ) ? Row[ Word + 1 ] : 0;
+
+	return ( Lo >> Shift ) | ( Hi << ( MASK_WORD_BITS - Shift ) );
+}
+
+bool cCollisionMask::Collide( const Int32& X, const Int32& Y, const cCollisionMask& Other, const Int32& OtherX, const Int32& OtherY ) const {
+	Int32 Left		= eemax( X, OtherX );
+	Int32 Right		= eemin( X + (Int32)mWidth, OtherX + (Int32)Other.mWidth );
+	Int32 Top		= eemax( Y, OtherY );
+	Int32 Bottom	= eemin( Y + (Int32)mHeight, OtherY + (Int32)Other.mHeight );
+
+	if ( Left >= Right || Top >= Bottom )
+		return false;
+
+	// The words of this mask that overlap the other mask, the pixel x of this mask is the pixel x + Offset of the other mask.
+	// The pixels of the words outside the overlap are outside the other mask, so they are read as 0.
+	Int32 FirstWord	= ( Left - X ) / MASK_WORD_BITS;
+	Int32 LastWord	= ( Right - X - 1 ) / MASK_WORD_BITS;
+	Int32 Offset	= X - OtherX;
+
+	for ( Int32 y = Top; y < Bottom; y++ ) {
+		const Uint64 * Row		= &mBits[ ( y - Y ) * mWordsPerRow ];
+		const Uint64 * OtherRow	= &Other.mBits[ ( y - OtherY ) * Other.mWordsPerRow ];
+
+		for ( Int32 w = FirstWord; w <= LastWord; w++ ) {
+			if ( Row[w] && ( Row[w] & Other.GetBits( OtherRow, w * MASK_WORD_BITS + Offset ) ) )
+				return true;
+		}
+	}
+
+	return false;
+}
+
+}}
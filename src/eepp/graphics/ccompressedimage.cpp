@@ -0,0 +1,755 @@
+#include <eepp/graphics/ccompressedimage.hpp>
+#include <eepp/graphics/renderer/cgl.hpp>
+#include <eepp/system/ciostreamfile.hpp>
+#include <eepp/helper/SOIL2/src/SOIL2/image_DXT.h>
+
+namespace EE { namespace Graphics {
+
+namespace Private {
+
+static const Uint8 KTX_IDENTIFIER[12]			= { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+static const Uint32 KTX_ENDIANNESS				= 0x04030201;
+static const Uint32 KTX_HEADER_SIZE				= 64;
+
+static const Uint32 FMT_RGB						= 0x1907;
+static const Uint32 FMT_RGBA					= 0x1908;
+static const Uint32 FMT_RGB_S3TC_DXT1			= 0x83F0;
+static const Uint32 FMT_RGBA_S3TC_DXT1			= 0x83F1;
+static const Uint32 FMT_RGBA_S3TC_DXT3			= 0x83F2;
+static const Uint32 FMT_RGBA_S3TC_DXT5			= 0x83F3;
+static const Uint32 FMT_ETC1_RGB8				= 0x8D64;
+static const Uint32 FMT_RGB8_ETC2				= 0x9274;
+static const Uint32 FMT_SRGB8_ETC2				= 0x9275;
+static const Uint32 FMT_RGB8_A1_ETC2			= 0x9276;
+static const Uint32 FMT_SRGB8_A1_ETC2			= 0x9277;
+static const Uint32 FMT_RGBA8_ETC2_EAC			= 0x9278;
+static const Uint32 FMT_SRGB8_ALPHA8_ETC2_EAC	= 0x9279;
+static const Uint32 FMT_RGBA_ASTC_FIRST			= 0x93B0;
+static const Uint32 FMT_RGBA_ASTC_LAST			= 0x93BD;
+static const Uint32 FMT_SRGB8_ASTC_FIRST		= 0x93D0;
+static const Uint32 FMT_SRGB8_ASTC_LAST			= 0x93DD;
+
+/** The header of a KTX 1.1 file after the identifier */
+struct sKTXHeader {
+	Uint32 Endianness;
+	Uint32 GlType;
+	Uint32 GlTypeSize;
+	Uint32 GlFormat;
+	Uint32 GlInternalFormat;
+	Uint32 GlBaseInternalFormat;
+	Uint32 PixelWidth;
+	Uint32 PixelHeight;
+	Uint32 PixelDepth;
+	Uint32 NumberOfArrayElements;
+	Uint32 NumberOfFaces;
+	Uint32 NumberOfMipmapLevels;
+	Uint32 BytesOfKeyValueData;
+};
+
+static const Int32 ETC_MODIFIERS[8][4] = {
+	{ 2, 8, -2, -8 },
+	{ 5, 17, -5, -17 },
+	{ 9, 29, -9, -29 },
+	{ 13, 42, -13, -42 },
+	{ 18, 60, -18, -60 },
+	{ 24, 80, -24, -80 },
+	{ 33, 106, -33, -106 },
+	{ 47, 183, -47, -183 }
+};
+
+static const Int32 ETC_DISTANCES[8] = { 3, 6, 11, 16, 23, 32, 41, 64 };
+
+static const Int32 EAC_MODIFIERS[16][8] = {
+	{ -3, -6, -9, -15, 2, 5, 8, 14 },
+	{ -3, -7, -10, -13, 2, 6, 9, 12 },
+	{ -2, -5, -8, -13, 1, 4, 7, 12 },
+	{ -2, -4, -6, -13, 1, 3, 5, 12 },
+	{ -3, -6, -8, -12, 2, 5, 7, 11 },
+	{ -3, -7, -9, -11, 2, 6, 8, 10 },
+	{ -4, -7, -8, -11, 3, 6, 7, 10 },
+	{ -3, -5, -8, -11, 2, 4, 7, 10 },
+	{ -2, -6, -8, -10, 1, 5, 7, 9 },
+	{ -2, -5, -8, -10, 1, 4, 7, 9 },
+	{ -2, -4, -8, -10, 1, 3, 7, 9 },
+	{ -2, -5, -7, -10, 1, 4, 6, 9 },
+	{ -3, -4, -7, -10, 2, 3, 6, 9 },
+	{ -1, -2, -3, -10, 0, 1, 2, 9 },
+	{ -4, -6, -8, -9, 3, 5, 7, 8 },
+	{ -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+static inline Uint8 Clamp255( const Int32& v ) {
+	return (Uint8)( v < 0 ? 0 : ( v > 255 ? 255 : v ) );
+}
+
+static inline Int32 Extend4( const Int32& v ) {
+	return ( v << 4 ) | v;
+}
+
+static inline Int32 Extend5( const Int32& v ) {
+	return ( v << 3 ) | ( v >> 2 );
+}
+
+static inline Int32 Extend6( const Int32& v ) {
+	return ( v << 2 ) | ( v >> 4 );
+}
+
+static inline Int32 Extend7( const Int32& v ) {
+	return ( v << 1 ) | ( v >> 6 );
+}
+
+static inline void SetPixel( Uint8 * Block, const Int32& x, const Int32& y, const Int32& r, const Int32& g, const Int32& b, const Int32& a ) {
+	Uint8 * p = &Block[ ( y * 4 + x ) * 4 ];
+
+	p[0] = Clamp255( r );
+	p[1] = Clamp255( g );
+	p[2] = Clamp255( b );
+	p[3] = Clamp255( a );
+}
+
+/** Decodes an ETC1 or ETC2 RGB block to a 4x4 RGBA block. The ETC1 blocks are a subset of the ETC2 blocks.
+*	With PunchThrough the differential bit is the opaque bit of the RGB8_A1 format. */
+static void DecodeETC2Block( const Uint8 * Src, Uint8 * Block, const bool& PunchThrough ) {
+	Uint32 hi = ( Src[0] << 24 ) | ( Src[1] << 16 ) | ( Src[2] << 8 ) | Src[3];
+	Uint32 lo = ( Src[4] << 24 ) | ( Src[5] << 16 ) | ( Src[6] << 8 ) | Src[7];
+	bool Diff = 0 != ( hi & 0x2 );
+	bool Opaque = PunchThrough ? Diff : true;
+	Int32 x, y, i, Idx;
+
+	if ( PunchThrough ) {
+		Diff = true;
+	}
+
+	if ( Diff ) {
+		Int32 r = ( hi >> 27 ) & 0x1F;
+		Int32 g = ( hi >> 19 ) & 0x1F;
+		Int32 b = ( hi >> 11 ) & 0x1F;
+		Int32 dr = ( hi >> 24 ) & 0x7;
+		Int32 dg = ( hi >> 16 ) & 0x7;
+		Int32 db = ( hi >> 8 ) & 0x7;
+
+		// Signed 3 bits deltas
+		dr = dr >= 4 ? dr - 8 : dr;
+		dg = dg >= 4 ? dg - 8 : dg;
+		db = db >= 4 ? db - 8 : db;
+
+		if ( r + dr < 0 || r + dr > 31 ) {
+			// T mode
+			Int32 c[4][3];
+			Int32 d = ETC_DISTANCES[ ( ( ( hi >> 2 ) & 0x3 ) << 1 ) | ( hi & 0x1 ) ];
+
+			c[0][0] = Extend4( ( ( ( hi >> 27 ) & 0x3 ) << 2 ) | ( ( hi >> 24 ) & 0x3 ) );
+			c[0][1] = Extend4( ( hi >> 20 ) & 0xF );
+			c[0][2] = Extend4( ( hi >> 16 ) & 0xF );
+			c[2][0] = Extend4( ( hi >> 12 ) & 0xF );
+			c[2][1] = Extend4( ( hi >> 8 ) & 0xF );
+			c[2][2] = Extend4( ( hi >> 4 ) & 0xF );
+
+			for ( i = 0; i < 3; i++ ) {
+				c[1][i] = Clamp255( c[2][i] + d );
+				c[3][i] = Clamp255( c[2][i] - d );
+			}
+
+			for ( x = 0; x < 4; x++ ) {
+				for ( y = 0; y < 4; y++ ) {
+					i	= x * 4 + y;
+					Idx	= ( ( ( lo >> ( 16 + i ) ) & 1 ) << 1 ) | ( ( lo >> i ) & 1 );
+
+					if ( !Opaque && 2 == Idx ) {
+						SetPixel( Block, x, y, 0, 0, 0, 0 );
+					} else {
+						SetPixel( Block, x, y, c[Idx][0], c[Idx][1], c[Idx][2], 255 );
+					}
+				}
+			}
+
+			return;
+		} else if ( g + dg < 0 || g + dg > 31 ) {
+			// H mode
+			Int32 c[4][3];
+			Int32 c0[3], c1[3];
+
+			c0[0] = ( hi >> 27 ) & 0xF;
+			c0[1] = ( ( ( hi >> 24 ) & 0x7 ) << 1 ) | ( ( hi >> 20 ) & 0x1 );
+			c0[2] = ( ( ( hi >> 19 ) & 0x1 ) << 3 ) | ( ( hi >> 15 ) & 0x7 );
+			c1[0] = ( hi >> 11 ) & 0xF;
+			c1[1] = ( hi >> 7 ) & 0xF;
+			c1[2] = ( hi >> 3 ) & 0xF;
+
+			Int32 di = ( ( ( hi >> 2 ) & 0x1 ) << 2 ) | ( ( hi & 0x1 ) << 1 );
+
+			if ( ( ( c0[0] << 8 ) | ( c0[1] << 4 ) | c0[2] ) >= ( ( c1[0] << 8 ) | ( c1[1] << 4 ) | c1[2] ) ) {
+				di |= 1;
+			}
+
+			Int32 d = ETC_DISTANCES[ di ];
+
+			for ( i = 0; i < 3; i++ ) {
+				c[0][i] = Clamp255( Extend4( c0[i] ) + d );
+				c[1][i] = Clamp255( Extend4( c0[i] ) - d );
+				c[2][i] = Clamp255( Extend4( c1[i] ) + d );
+				c[3][i] = Clamp255( Extend4( c1[i] ) - d );
+			}
+
+			for ( x = 0; x < 4; x++ ) {
+				for ( y = 0; y < 4; y++ ) {
+					i	= x * 4 + y;
+					Idx	= ( ( ( lo >> ( 16 + i ) ) & 1 ) << 1 ) | ( ( lo >> i ) & 1 );
+
+					if ( !Opaque && 2 == Idx ) {
+						SetPixel( Block, x, y, 0, 0, 0, 0 );
+					} else {
+						SetPixel( Block, x, y, c[Idx][0], c[Idx][1], c[Idx][2], 255 );
+					}
+				}
+			}
+
+			return;
+		} else if ( b + db < 0 || b + db > 31 ) {
+			// Planar mode
+			Int32 ro = Extend6( ( hi >> 25 ) & 0x3F );
+			Int32 go = Extend7( ( ( ( hi >> 24 ) & 0x1 ) << 6 ) | ( ( hi >> 17 ) & 0x3F ) );
+			Int32 bo = Extend6( ( ( ( hi >> 16 ) & 0x1 ) << 5 ) | ( ( ( hi >> 11 ) & 0x3 ) << 3 ) | ( ( hi >> 7 ) & 0x7 ) );
+			Int32 rh = Extend6( ( ( ( hi >> 2 ) & 0x1F ) << 1 ) | ( hi & 0x1 ) );
+			Int32 gh = Extend7( ( lo >> 25 ) & 0x7F );
+			Int32 bh = Extend6( ( lo >> 19 ) & 0x3F );
+			Int32 rv = Extend6( ( lo >> 13 ) & 0x3F );
+			Int32 gv = Extend7( ( lo >> 6 ) & 0x7F );
+			Int32 bv = Extend6( lo & 0x3F );
+
+			for ( x = 0; x < 4; x++ ) {
+				for ( y = 0; y < 4; y++ ) {
+					SetPixel( Block, x, y,
+						( x * ( rh - ro ) + y * ( rv - ro ) + 4 * ro + 2 ) >> 2,
+						( x * ( gh - go ) + y * ( gv - go ) + 4 * go + 2 ) >> 2,
+						( x * ( bh - bo ) + y * ( bv - bo ) + 4 * bo + 2 ) >> 2,
+						255
+					);
+				}
+			}
+
+			return;
+		}
+	}
+
+	// Individual and differential modes
+	Int32 Base[2][3];
+	Int32 Table[2];
+	bool Flip = 0 != ( hi & 0x1 );
+
+	if ( Diff ) {
+		Int32 r = ( hi >> 27 ) & 0x1F;
+		Int32 g = ( hi >> 19 ) & 0x1F;
+		Int32 b = ( hi >> 11 ) & 0x1F;
+		Int32 dr = ( hi >> 24 ) & 0x7;
+		Int32 dg = ( hi >> 16 ) & 0x7;
+		Int32 db = ( hi >> 8 ) & 0x7;
+
+		dr = dr >= 4 ? dr - 8 : dr;
+		dg = dg >= 4 ? dg - 8 : dg;
+		db = db >= 4 ? db - 8 : db;
+
+		Base[0][0] = Extend5( r );
+		Base[0][1] = Extend5( g );
+		Base[0][2] = Extend5( b );
+		Base[1][0] = Extend5( r + dr );
+		Base[1][1] = Extend5( g + dg );
+		Base[1][2] = Extend5( b + db );
+	} else {
+		Base[0][0] = Extend4( ( hi >> 28 ) & 0xF );
+		Base[1][0] = Extend4( ( hi >> 24 ) & 0xF );
+		Base[0][1] = Extend4( ( hi >> 20 ) & 0xF );
+		Base[1][1] = Extend4( ( hi >> 16 ) & 0xF );
+		Base[0][2] = Extend4( ( hi >> 12 ) & 0xF );
+		Base[1][2] = Extend4( ( hi >> 8 ) & 0xF );
+	}
+
+	Table[0] = ( hi >> 5 ) & 0x7;
+	Table[1] = ( hi >> 2 ) & 0x7;
+
+	for ( x = 0; x < 4; x++ ) {
+		for ( y = 0; y < 4; y++ ) {
+			Int32 Sub = Flip ? ( y >= 2 ) : ( x >= 2 );
+
+			i	= x * 4 + y;
+			Idx	= ( ( ( lo >> ( 16 + i ) ) & 1 ) << 1 ) | ( ( lo >> i ) & 1 );
+
+			Int32 Mod = ETC_MODIFIERS[ Table[Sub] ][ Idx ];
+
+			if ( !Opaque ) {
+				if ( 2 == Idx ) {
+					SetPixel( Block, x, y, 0, 0, 0, 0 );
+					continue;
+				} else if ( 0 == Idx ) {
+					Mod = 0;
+				}
+			}
+
+			SetPixel( Block, x, y, Base[Sub][0] + Mod, Base[Sub][1] + Mod, Base[Sub][2] + Mod, 255 );
+		}
+	}
+}
+
+/** Decodes an EAC alpha block over the alpha of a 4x4 RGBA block */
+static void DecodeEACAlphaBlock( const Uint8 * Src, Uint8 * Block ) {
+	Int32 Base = Src[0];
+	Int32 Mul = Src[1] >> 4;
+	const Int32 * Mods = EAC_MODIFIERS[ Src[1] & 0xF ];
+	Uint64 Bits = 0;
+
+	for ( Int32 i = 2; i < 8; i++ ) {
+		Bits = ( Bits << 8 ) | Src[i];
+	}
+
+	for ( Int32 x = 0; x < 4; x++ ) {
+		for ( Int32 y = 0; y < 4; y++ ) {
+			Int32 Idx = (Int32)( ( Bits >> ( 45 - ( x * 4 + y ) * 3 ) ) & 0x7 );
+
+			Block[ ( y * 4 + x ) * 4 + 3 ] = Clamp255( Base + Mods[ Idx ] * Mul );
+		}
+	}
+}
+
+static void Decode565( const Uint16& c, Int32 * rgb ) {
+	rgb[0] = Extend5( ( c >> 11 ) & 0x1F );
+	rgb[1] = Extend6( ( c >> 5 ) & 0x3F );
+	rgb[2] = Extend5( c & 0x1F );
+}
+
+/** Decodes a DXT color block. The DXT1 blocks can have a three colors mode ( with transparent black if Alpha ), the DXT3 and DXT5 color blocks are always in four colors mode. */
+static void DecodeDXTColorBlock( const Uint8 * Src, Uint8 * Block, const bool& DXT1, const bool& Alpha ) {
+	Uint16 c0 = Src[0] | ( Src[1] << 8 );
+	Uint16 c1 = Src[2] | ( Src[3] << 8 );
+	Uint32 Bits = Src[4] | ( Src[5] << 8 ) | ( Src[6] << 16 ) | ( (Uint32)Src[7] << 24 );
+	Int32 c[4][4];
+	Int32 i;
+
+	Decode565( c0, c[0] );
+	Decode565( c1, c[1] );
+	c[0][3] = c[1][3] = 255;
+
+	if ( !DXT1 || c0 > c1 ) {
+		for ( i = 0; i < 3; i++ ) {
+			c[2][i] = ( 2 * c[0][i] + c[1][i] ) / 3;
+			c[3][i] = ( c[0][i] + 2 * c[1][i] ) / 3;
+		}
+
+		c[2][3] = c[3][3] = 255;
+	} else {
+		for ( i = 0; i < 3; i++ ) {
+			c[2][i] = ( c[0][i] + c[1][i] ) / 2;
+			c[3][i] = 0;
+		}
+
+		c[2][3] = 255;
+		c[3][3] = Alpha ? 0 : 255;
+	}
+
+	for ( i = 0; i < 16; i++ ) {
+		Int32 Idx = ( Bits >> ( i * 2 ) ) & 0x3;
+
+		SetPixel( Block, i % 4, i / 4, c[Idx][0], c[Idx][1], c[Idx][2], c[Idx][3] );
+	}
+}
+
+static void DecodeDXT3AlphaBlock( const Uint8 * Src, Uint8 * Block ) {
+	for ( Int32 i = 0; i < 16; i++ ) {
+		Int32 a = ( Src[ i / 2 ] >> ( ( i & 1 ) * 4 ) ) & 0xF;
+
+		Block[ i * 4 + 3 ] = (Uint8)( ( a << 4 ) | a );
+	}
+}
+
+static void DecodeDXT5AlphaBlock( const Uint8 * Src, Uint8 * Block ) {
+	Int32 a[8];
+	Uint64 Bits = 0;
+	Int32 i;
+
+	a[0] = Src[0];
+	a[1] = Src[1];
+
+	if ( a[0] > a[1] ) {
+		for ( i = 1; i < 7; i++ ) {
+			a[ i + 1 ] = ( ( 7 - i ) * a[0] + i * a[1] ) / 7;
+		}
+	} else {
+		for ( i = 1; i < 5; i++ ) {
+			a[ i + 1 ] = ( ( 5 - i ) * a[0] + i * a[1] ) / 5;
+		}
+
+		a[6] = 0;
+		a[7] = 255;
+	}
+
+	for ( i = 7; i >= 2; i-- ) {
+		Bits = ( Bits << 8 ) | Src[i];
+	}
+
+	for ( i = 0; i < 16; i++ ) {
+		Block[ i * 4 + 3 ] = (Uint8)a[ ( Bits >> ( i * 3 ) ) & 0x7 ];
+	}
+}
+
+}
+
+using namespace Private;
+
+bool cCompressedImage::IsCompressedImage( const Uint8 * Data, const Uint32& Size ) {
+	return NULL != Data && Size >= KTX_HEADER_SIZE && 0 == memcmp( Data, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER) );
+}
+
+bool cCompressedImage::IsCompressedImage( const std::string& Filepath ) {
+	cIOStreamFile fs( Filepath, std::ios::in | std::ios::binary );
+	Uint8 Identifier[ sizeof(KTX_IDENTIFIER) ];
+
+	if ( !fs.IsOpen() || fs.GetSize() < KTX_HEADER_SIZE ) {
+		return false;
+	}
+
+	fs.Read( (char*)Identifier, sizeof(Identifier) );
+
+	return 0 == memcmp( Identifier, KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER) );
+}
+
+bool cCompressedImage::Save( const std::string& Filepath, const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels ) {
+	if ( NULL == Pixels || 0 == Width || 0 == Height || 0 == Channels || Channels > 4 ) {
+		return false;
+	}
+
+	// The even channels count means that the image has alpha
+	bool Alpha = 0 == ( Channels & 1 );
+	int Size = 0;
+	unsigned char * Blocks = Alpha ?	convert_image_to_DXT5( Pixels, Width, Height, Channels, &Size ) :
+										convert_image_to_DXT1( Pixels, Width, Height, Channels, &Size );
+
+	if ( NULL == Blocks ) {
+		return false;
+	}
+
+	cIOStreamFile fs( Filepath, std::ios::out | std::ios::binary );
+
+	if ( !fs.IsOpen() ) {
+		free( Blocks );
+		return false;
+	}
+
+	sKTXHeader Hdr;
+
+	Hdr.Endianness				= KTX_ENDIANNESS;
+	Hdr.GlType					= 0;
+	Hdr.GlTypeSize				= 1;
+	Hdr.GlFormat				= 0;
+	Hdr.GlInternalFormat		= Alpha ? FMT_RGBA_S3TC_DXT5 : FMT_RGB_S3TC_DXT1;
+	Hdr.GlBaseInternalFormat	= Alpha ? FMT_RGBA : FMT_RGB;
+	Hdr.PixelWidth				= Width;
+	Hdr.PixelHeight				= Height;
+	Hdr.PixelDepth				= 0;
+	Hdr.NumberOfArrayElements	= 0;
+	Hdr.NumberOfFaces			= 1;
+	Hdr.NumberOfMipmapLevels	= 1;
+	Hdr.BytesOfKeyValueData		= 0;
+
+	Uint32 ImageSize = (Uint32)Size;
+
+	fs.Write( (const char*)KTX_IDENTIFIER, sizeof(KTX_IDENTIFIER) );
+	fs.Write( (const char*)&Hdr, sizeof(sKTXHeader) );
+	fs.Write( (const char*)&ImageSize, sizeof(Uint32) );
+	fs.Write( (const char*)Blocks, Size );
+
+	free( Blocks );
+
+	return true;
+}
+
+cCompressedImage::cCompressedImage() :
+	mData( NULL ),
+	mSize( 0 ),
+	mWidth( 0 ),
+	mHeight( 0 ),
+	mFormat( 0 )
+{
+}
+
+bool cCompressedImage::LoadFromMemory( const Uint8 * Data, const Uint32& Size ) {
+	mLevelOffset.clear();
+	mLevelSize.clear();
+
+	if ( !IsCompressedImage( Data, Size ) ) {
+		return false;
+	}
+
+	sKTXHeader Hdr;
+
+	memcpy( &Hdr, Data + sizeof(KTX_IDENTIFIER), sizeof(sKTXHeader) );
+
+	// Only 2D compressed textures in the native endianness
+	if ( KTX_ENDIANNESS != Hdr.Endianness || 0 != Hdr.GlType || 0 == Hdr.PixelWidth || 0 == Hdr.PixelHeight ||
+		 Hdr.PixelDepth > 1 || Hdr.NumberOfArrayElements > 1 || Hdr.NumberOfFaces > 1 )
+	{
+		eePRINTL( "cCompressedImage::LoadFromMemory: unsupported KTX container." );
+		return false;
+	}
+
+	mData	= Data;
+	mSize	= Size;
+	mWidth	= Hdr.PixelWidth;
+	mHeight	= Hdr.PixelHeight;
+	mFormat	= Hdr.GlInternalFormat;
+
+	if ( COMPRESSION_UNKNOWN == Type() ) {
+		eePRINTL( "cCompressedImage::LoadFromMemory: unsupported KTX format 0x%x.", mFormat );
+		return false;
+	}
+
+	Uint32 Levels = eemax( Hdr.NumberOfMipmapLevels, (Uint32)1 );
+
+	// The bounds are compared with subtractions, so a malformed file can't wrap the offsets
+	if ( Hdr.BytesOfKeyValueData > Size - KTX_HEADER_SIZE ) {
+		eePRINTL( "cCompressedImage::LoadFromMemory: truncated KTX container." );
+		return false;
+	}
+
+	Uint32 Offset = KTX_HEADER_SIZE + Hdr.BytesOfKeyValueData;
+
+	for ( Uint32 i = 0; i < Levels; i++ ) {
+		if ( Offset > Size || Size - Offset < sizeof(Uint32) ) {
+			break;
+		}
+
+		Uint32 LevelSize;
+
+		memcpy( &LevelSize, Data + Offset, sizeof(Uint32) );
+
+		Offset += sizeof(Uint32);
+
+		if ( LevelSize > Size - Offset ) {
+			break;
+		}
+
+		mLevelOffset.push_back( Offset );
+		mLevelSize.push_back( LevelSize );
+
+		// The levels are aligned to 4 bytes ( the padding of the last level can be missing )
+		Uint32 Padding = ( 4 - ( LevelSize & 3 ) ) & 3;
+
+		Offset += LevelSize;
+		Offset = Padding > Size - Offset ? Size : Offset + Padding;
+	}
+
+	// A file with less levels than declared is rejected
+	if ( mLevelOffset.size() != Levels ) {
+		eePRINTL( "cCompressedImage::LoadFromMemory: truncated KTX container." );
+
+		mLevelOffset.clear();
+		mLevelSize.clear();
+
+		return false;
+	}
+
+	return true;
+}
+
+const Uint32& cCompressedImage::Width() const {
+	return mWidth;
+}
+
+const Uint32& cCompressedImage::Height() const {
+	return mHeight;
+}
+
+const Uint32& cCompressedImage::InternalFormat() const {
+	return mFormat;
+}
+
+cCompressedImage::CompressionType cCompressedImage::Type() const {
+	switch ( mFormat ) {
+		case FMT_RGB_S3TC_DXT1:
+		case FMT_RGBA_S3TC_DXT1:
+		case FMT_RGBA_S3TC_DXT3:
+		case FMT_RGBA_S3TC_DXT5:
+			return COMPRESSION_S3TC;
+		case FMT_ETC1_RGB8:
+			return COMPRESSION_ETC1;
+		case FMT_RGB8_ETC2:
+		case FMT_SRGB8_ETC2:
+		case FMT_RGB8_A1_ETC2:
+		case FMT_SRGB8_A1_ETC2:
+		case FMT_RGBA8_ETC2_EAC:
+		case FMT_SRGB8_ALPHA8_ETC2_EAC:
+			return COMPRESSION_ETC2;
+	}
+
+	if ( ( mFormat >= FMT_RGBA_ASTC_FIRST && mFormat <= FMT_RGBA_ASTC_LAST ) || ( mFormat >= FMT_SRGB8_ASTC_FIRST && mFormat <= FMT_SRGB8_ASTC_LAST ) ) {
+		return COMPRESSION_ASTC;
+	}
+
+	return COMPRESSION_UNKNOWN;
+}
+
+Uint32 cCompressedImage::LevelsCount() const {
+	return mLevelOffset.size();
+}
+
+Uint32 cCompressedImage::Channels() const {
+	return ( FMT_RGB_S3TC_DXT1 == mFormat || FMT_ETC1_RGB8 == mFormat || FMT_RGB8_ETC2 == mFormat || FMT_SRGB8_ETC2 == mFormat ) ? 3 : 4;
+}
+
+Uint32 cCompressedImage::DataSize() const {
+	Uint32 Size = 0;
+
+	for ( Uint32 i = 0; i < mLevelSize.size(); i++ ) {
+		Size += mLevelSize[i];
+	}
+
+	return Size;
+}
+
+bool cCompressedImage::IsSupported() const {
+	switch ( Type() ) {
+		case COMPRESSION_S3TC:
+			return GLi->IsExtension( EEGL_EXT_texture_compression_s3tc );
+		case COMPRESSION_ETC1:
+			// ETC1 blocks are valid ETC2 blocks
+			return GLi->IsExtension( EEGL_OES_compressed_ETC1_RGB8_texture ) || GLi->IsExtension( EEGL_ARB_ES3_compatibility );
+		case COMPRESSION_ETC2:
+			return GLi->IsExtension( EEGL_ARB_ES3_compatibility );
+		case COMPRESSION_ASTC:
+			return GLi->IsExtension( EEGL_KHR_texture_compression_astc_ldr );
+		default:
+			break;
+	}
+
+	return false;
+}
+
+bool cCompressedImage::CanDecompress() const {
+	CompressionType Family = Type();
+
+	return COMPRESSION_S3TC == Family || COMPRESSION_ETC1 == Family || COMPRESSION_ETC2 == Family;
+}
+
+bool cCompressedImage::CanMipmap() const {
+	if ( LevelsCount() < 2 ) {
+		return false;
+	}
+
+	#ifndef EE_GLES
+	// GL_TEXTURE_MAX_LEVEL makes the partial chains complete
+	return true;
+	#else
+	Uint32 Last = LevelsCount() - 1;
+
+	return ( mWidth >> Last ) <= 1 && ( mHeight >> Last ) <= 1;
+	#endif
+}
+
+Uint32 cCompressedImage::Upload( const bool& Mipmaps, const EE_CLAMP_MODE& ClampMode ) const {
+	if ( !LevelsCount() || !IsSupported() ) {
+		return 0;
+	}
+
+	Uint32 Format = mFormat;
+
+	if ( FMT_ETC1_RGB8 == Format && !GLi->IsExtension( EEGL_OES_compressed_ETC1_RGB8_texture ) ) {
+		Format = FMT_RGB8_ETC2;
+	}
+
+	Uint32 Levels = Mipmaps && CanMipmap() ? LevelsCount() : 1;
+	GLuint TexId = 0;
+
+	while ( GL_NO_ERROR != glGetError() );
+
+	glGenTextures( 1, &TexId );
+	glBindTexture( GL_TEXTURE_2D, TexId );
+
+	for ( Uint32 i = 0; i < Levels; i++ ) {
+		glCompressedTexImage2D( GL_TEXTURE_2D, i, Format, eemax( mWidth >> i, (Uint32)1 ), eemax( mHeight >> i, (Uint32)1 ), 0, mLevelSize[i], mData + mLevelOffset[i] );
+	}
+
+	GLint Wrap = CLAMP_REPEAT == ClampMode ? GL_REPEAT : GL_CLAMP_TO_EDGE;
+
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, Wrap );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, Wrap );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, Levels > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR );
+
+	#ifndef EE_GLES
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, Levels - 1 );
+	#endif
+
+	if ( GL_NO_ERROR != glGetError() ) {
+		glDeleteTextures( 1, &TexId );
+		return 0;
+	}
+
+	return TexId;
+}
+
+Uint8 * cCompressedImage::Decompress( const Uint32& Level ) const {
+	if ( Level >= LevelsCount() || !CanDecompress() ) {
+		return NULL;
+	}
+
+	Uint32 Width		= eemax( mWidth >> Level, (Uint32)1 );
+	Uint32 Height		= eemax( mHeight >> Level, (Uint32)1 );
+	Uint32 BlocksX		= ( Width + 3 ) / 4;
+	Uint32 BlocksY		= ( Height + 3 ) / 4;
+	bool Alpha16		= FMT_RGBA_S3TC_DXT3 == mFormat || FMT_RGBA_S3TC_DXT5 == mFormat || FMT_RGBA8_ETC2_EAC == mFormat || FMT_SRGB8_ALPHA8_ETC2_EAC == mFormat;
+	Uint32 BlockSize	= Alpha16 ? 16 : 8;
+
+	if ( BlocksX * BlocksY * BlockSize > mLevelSize[ Level ] ) {
+		return NULL;
+	}
+
+	Uint8 * Pixels		= (Uint8*)malloc( Width * Height * 4 );
+	const Uint8 * Src	= mData + mLevelOffset[ Level ];
+
+	if ( NULL == Pixels ) {
+		return NULL;
+	}
+	Uint8 Block[ 4 * 4 * 4 ];
+
+	for ( Uint32 by = 0; by < BlocksY; by++ ) {
+		for ( Uint32 bx = 0; bx < BlocksX; bx++ ) {
+			switch ( mFormat ) {
+				case FMT_RGB_S3TC_DXT1:
+				case FMT_RGBA_S3TC_DXT1:
+					DecodeDXTColorBlock( Src, Block, true, FMT_RGBA_S3TC_DXT1 == mFormat );
+					break;
+				case FMT_RGBA_S3TC_DXT3:
+					DecodeDXTColorBlock( Src + 8, Block, false, false );
+					DecodeDXT3AlphaBlock( Src, Block );
+					break;
+				case FMT_RGBA_S3TC_DXT5:
+					DecodeDXTColorBlock( Src + 8, Block, false, false );
+					DecodeDXT5AlphaBlock( Src, Block );
+					break;
+				case FMT_RGB8_A1_ETC2:
+				case FMT_SRGB8_A1_ETC2:
+					DecodeETC2Block( Src, Block, true );
+					break;
+				case FMT_RGBA8_ETC2_EAC:
+				case FMT_SRGB8_ALPHA8_ETC2_EAC:
+					DecodeETC2Block( Src + 8, Block, false );
+					DecodeEACAlphaBlock( Src, Block );
+					break;
+				default:
+					DecodeETC2Block( Src, Block, false );
+					break;
+			}
+
+			// Copy the block clipped to the level size
+			for ( Uint32 y = 0; y < 4 && by * 4 + y < Height; y++ ) {
+				Uint32 Cols = eemin( (Uint32)4, Width - bx * 4 );
+
+				memcpy( &Pixels[ ( ( by * 4 + y ) * Width + bx * 4 ) * 4 ], &Block[ y * 16 ], Cols * 4 );
+			}
+
+			Src += BlockSize;
+		}
+	}
+
+	return Pixels;
+}
+
+}}
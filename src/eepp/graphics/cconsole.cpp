@@ -5,6 +5,7 @@
 #include <eepp/window/cengine.hpp>
 #include <eepp/window/ccursormanager.hpp>
 #include <eepp/window/cwindow.hpp>
+#include <eepp/system/cprofiler.hpp>
 #include <algorithm>
 #include <cstdarg>
 
@@ -604,6 +605,7 @@ void cConsole::CreateDefaultCommands() {
 	AddCommand( "showfps", cb::Make1( this, &cConsole::CmdShowFps) );
 	AddCommand( "gettexturememory", cb::Make1( this, &cConsole::CmdGetTextureMemory) );
 	AddCommand( "hide", cb::Make1( this, &cConsole::CmdHideConsole ) );
+	AddCommand( "profiler", cb::Make1( this, &cConsole::CmdProfiler ) );
 }
 
 void cConsole::CmdClear	() {
@@ -642,6 +644,49 @@ void cConsole::CmdGetTextureMemory ( const std::vector < String >& params ) {
 	PrivPushText( "Total texture memory used: " + FileSystem::SizeToString( cTextureFactory::instance()->MemorySize() ) );
 }
 
+void cConsole::CmdProfiler( const std::vector < String >& params ) {
+	if ( params.size() >= 2 ) {
+		cProfiler * Profiler = cProfiler::instance();
+
+		if ( "on" == params[1] || "off" == params[1] ) {
+			Profiler->Enabled( "on" == params[1] );
+			PrivPushText( "profiler " + params[1] );
+			return;
+		} else if ( "dump" == params[1] ) {
+			Int32 Frames = 10;
+
+			if ( params.size() >= 3 && ( !String::FromString<Int32>( Frames, params[2] ) || Frames <= 0 ) ) {
+				PrivPushText( "Invalid frames count." );
+				return;
+			}
+
+			std::vector < String > tvec = String::Split( String( Profiler->GetReport( Frames ) ) );
+
+			for ( eeUint i = 0; i < tvec.size(); i++ )
+				PrivPushText( tvec[i] );
+
+			return;
+		} else if ( "trace" == params[1] && params.size() >= 3 ) {
+			Int32 Frames = 0;
+
+			if ( params.size() >= 4 && ( !String::FromString<Int32>( Frames, params[3] ) || Frames < 0 ) ) {
+				PrivPushText( "Invalid frames count." );
+				return;
+			}
+
+			if ( Profiler->ExportChromeTrace( params[2].ToUtf8(), Frames ) ) {
+				PrivPushText( "Chrome trace saved to " + params[2] );
+			} else {
+				PrivPushText( "Couldn't save the Chrome trace to " + params[2] );
+			}
+
+			return;
+		}
+	}
+
+	PrivPushText( "Usage: profiler on|off, profiler dump [frames], profiler trace filepath [frames]" );
+}
+
 void cConsole::CmdCmdList ( const std::vector < String >& params ) {
 	std::map < String, ConsoleCallback >::iterator itr;
 	for (itr = mCallbacks.begin(); itr != mCallbacks.end(); itr++) {
@@ -1,16 +1,200 @@
 #include <eepp/graphics/cglobaltextureatlas.hpp>
 #include <eepp/graphics/ctextureatlasmanager.hpp>
+#include <eepp/graphics/ctextureatlaspage.hpp>
+#include <eepp/graphics/ctexturefactory.hpp>
+#include <eepp/graphics/ctexture.hpp>
+#include <eepp/graphics/cimage.hpp>
 
 namespace EE { namespace Graphics {
 
+cAtlasPageStats::cAtlasPageStats() :
+	Pages( 0 ),
+	SubTextures( 0 ),
+	TotalArea( 0 ),
+	UsedArea( 0 ),
+	FreeRects( 0 ),
+	LargestFreeArea( 0 ),
+	Occupancy( 0 ),
+	Fragmentation( 0 )
+{
+}
+
 SINGLETON_DECLARE_IMPLEMENTATION(cGlobalTextureAtlas)
 
 cGlobalTextureAtlas::cGlobalTextureAtlas() :
-	cTextureAtlas( "global" )
+	cTextureAtlas( "global" ),
+	mPageWidth( 1024 ),
+	mPageHeight( 1024 ),
+	mMaxSize( 256 ),
+	mPixelBorder( 1 ),
+	mRuntimeAtlasing( false )
 {
 }
 
 cGlobalTextureAtlas::~cGlobalTextureAtlas() {
+	for ( Uint32 i = 0; i < mPages.size(); i++ ) {
+		eeSAFE_DELETE( mPages[i] );
+	}
+}
+
+void cGlobalTextureAtlas::RuntimeAtlasing( const bool& enable ) {
+	mRuntimeAtlasing = enable;
+}
+
+const bool& cGlobalTextureAtlas::RuntimeAtlasing() const {
+	return mRuntimeAtlasing;
+}
+
+void cGlobalTextureAtlas::RuntimeAtlasOptions( const Uint32& PageWidth, const Uint32& PageHeight, const Uint32& MaxSize, const Uint32& PixelBorder ) {
+	if ( !mPages.size() ) {
+		mPageWidth		= cTextureFactory::instance()->GetValidTextureSize( PageWidth );
+		mPageHeight		= cTextureFactory::instance()->GetValidTextureSize( PageHeight );
+		mPixelBorder	= PixelBorder;
+	}
+
+	mMaxSize = eemin( MaxSize, eemin( mPageWidth, mPageHeight ) - mPixelBorder );
+}
+
+bool cGlobalTextureAtlas::CanPack( cImage * Img ) const {
+	return mRuntimeAtlasing && NULL != Img && NULL != Img->GetPixels() && Img->Width() > 0 && Img->Height() > 0 && Img->Width() <= mMaxSize && Img->Height() <= mMaxSize;
+}
+
+cSubTexture * cGlobalTextureAtlas::Pack( cImage * Img, const std::string& Name ) {
+	if ( !CanPack( Img ) ) {
+		return NULL;
+	}
+
+	Private::cTextureAtlasPage * Page = NULL;
+	eeRecti Rect;
+
+	// Try the newest pages first, the old ones are usually full
+	for ( Int32 i = (Int32)mPages.size() - 1; i >= 0; i-- ) {
+		Rect = mPages[i]->Insert( Img );
+
+		if ( Rect.Size().Width() > 0 ) {
+			Page = mPages[i];
+			break;
+		}
+	}
+
+	if ( NULL == Page ) {
+		Page = eeNew( Private::cTextureAtlasPage, ( mPageWidth, mPageHeight, mPixelBorder ) );
+
+		Rect = Page->Insert( Img );
+
+		if ( Rect.Size().Width() <= 0 ) {
+			eeSAFE_DELETE( Page );
+			return NULL;
+		}
+
+		mPages.push_back( Page );
+		mTextures.push_back( Page->GetTexture() );
+	}
+
+	return Add( Page->GetTextureId(), Rect, Name );
+}
+
+cSubTexture * cGlobalTextureAtlas::Pack( const std::string& Filepath, const std::string& Name ) {
+	std::string SubTextureName( Name.size() ? Name : FileSystem::FileRemoveExtension( FileSystem::FileNameFromPath( Filepath ) ) );
+
+	if ( mRuntimeAtlasing ) {
+		cImage Img( Filepath );
+
+		cSubTexture * SubTexture = Pack( &Img, SubTextureName );
+
+		if ( NULL != SubTexture ) {
+			return SubTexture;
+		}
+	}
+
+	Uint32 TexId = cTextureFactory::instance()->Load( Filepath );
+
+	if ( 0 == TexId ) {
+		return NULL;
+	}
+
+	return Add( TexId, SubTextureName );
+}
+
+cSubTexture * cGlobalTextureAtlas::Pack( const Uint32& TexId, const std::string& Name, const bool& RemoveTexture ) {
+	cTexture * Tex = cTextureFactory::instance()->GetTexture( TexId );
+
+	if ( NULL == Tex ) {
+		return NULL;
+	}
+
+	std::string SubTextureName( Name.size() ? Name : FileSystem::FileRemoveExtension( FileSystem::FileNameFromPath( Tex->Filepath() ) ) );
+
+	if ( mRuntimeAtlasing && Tex->Width() <= mMaxSize && Tex->Height() <= mMaxSize ) {
+		bool HadLocalCopy = Tex->LocalCopy();
+
+		// Downloads the texture pixels if there isn't a local copy
+		Tex->GetPixelsPtr();
+
+		cSubTexture * SubTexture = Pack( Tex, SubTextureName );
+
+		if ( NULL != SubTexture ) {
+			// The texture could have been scaled on load, so it keeps the original image size
+			SubTexture->DestSize( eeSizef( (eeFloat)Tex->ImgWidth(), (eeFloat)Tex->ImgHeight() ) );
+
+			if ( RemoveTexture ) {
+				cTextureFactory::instance()->Remove( TexId );
+			} else if ( !HadLocalCopy ) {
+				Tex->ClearCache();
+			}
+
+			return SubTexture;
+		}
+
+		if ( !HadLocalCopy ) {
+			Tex->ClearCache();
+		}
+	}
+
+	return Add( TexId, SubTextureName );
+}
+
+Uint32 cGlobalTextureAtlas::GetPagesCount() const {
+	return mPages.size();
+}
+
+cTexture * cGlobalTextureAtlas::GetPage( const Uint32& Index ) const {
+	eeASSERT( Index < mPages.size() );
+	return mPages[ Index ]->GetTexture();
+}
+
+void cGlobalTextureAtlas::AddPageStats( cAtlasPageStats& Stats, Private::cTextureAtlasPage * Page ) const {
+	Stats.Pages++;
+	Stats.SubTextures		+= Page->Count();
+	Stats.TotalArea			+= Page->Width() * Page->Height();
+	Stats.UsedArea			+= Page->UsedArea();
+	Stats.FreeRects			+= Page->FreeNodesCount();
+	Stats.LargestFreeArea	= eemax( Stats.LargestFreeArea, Page->LargestFreeArea() );
+
+	Uint32 FreeArea = Stats.TotalArea - Stats.UsedArea;
+
+	Stats.Occupancy			= (eeFloat)Stats.UsedArea / (eeFloat)Stats.TotalArea;
+	Stats.Fragmentation		= FreeArea > 0 ? 1.f - (eeFloat)Stats.LargestFreeArea / (eeFloat)FreeArea : 0.f;
+}
+
+cAtlasPageStats cGlobalTextureAtlas::GetPageStats( const Uint32& Index ) const {
+	eeASSERT( Index < mPages.size() );
+
+	cAtlasPageStats Stats;
+
+	AddPageStats( Stats, mPages[ Index ] );
+
+	return Stats;
+}
+
+cAtlasPageStats cGlobalTextureAtlas::GetPagesStats() const {
+	cAtlasPageStats Stats;
+
+	for ( Uint32 i = 0; i < mPages.size(); i++ ) {
+		AddPageStats( Stats, mPages[i] );
+	}
+
+	return Stats;
 }
 
 }}
@@ -0,0 +1,100 @@
+#include <eepp/graphics/cgputimer.hpp>
+#include <eepp/graphics/renderer/cgl.hpp>
+#include <eepp/system/cprofiler.hpp>
+
+namespace EE { namespace Graphics { namespace Private {
+
+SINGLETON_DECLARE_IMPLEMENTATION(cGpuTimer)
+
+cGpuTimer::cGpuTimer() :
+	mCurrent( 0 ),
+	mActive( false ),
+	mCreated( false )
+{
+	for ( Uint32 i = 0; i < QUERIES_COUNT; i++ ) {
+		mQueries[i]	= 0;
+		mFrames[i]	= 0;
+		mPending[i]	= false;
+	}
+}
+
+cGpuTimer::~cGpuTimer() {
+	#ifdef EE_GLEW_AVAILABLE
+	if ( mCreated ) {
+		glDeleteQueries( QUERIES_COUNT, mQueries );
+	}
+	#endif
+}
+
+bool cGpuTimer::IsSupported() {
+	#ifdef EE_GLEW_AVAILABLE
+	return NULL != GLi && GLv_NULL != GLi->Version() && GLi->IsExtension( EEGL_ARB_timer_query );
+	#else
+	return false;
+	#endif
+}
+
+void cGpuTimer::ReadResults() {
+	#ifdef EE_GLEW_AVAILABLE
+	for ( Uint32 i = 0; i < QUERIES_COUNT; i++ ) {
+		if ( mPending[i] ) {
+			GLint available = 0;
+
+			glGetQueryObjectiv( mQueries[i], GL_QUERY_RESULT_AVAILABLE, &available );
+
+			if ( available ) {
+				GLuint64 ns = 0;
+
+				glGetQueryObjectui64v( mQueries[i], GL_QUERY_RESULT, &ns );
+
+				cProfiler::instance()->GpuFrameTime( mFrames[i], Microseconds( (Int64)( ns / 1000 ) ) );
+
+				mPending[i] = false;
+			}
+		}
+	}
+	#endif
+}
+
+void cGpuTimer::FrameEnd() {
+	#ifdef EE_GLEW_AVAILABLE
+	if ( mActive ) {
+		glEndQuery( GL_TIME_ELAPSED );
+
+		mPending[ mCurrent ]	= true;
+		mActive					= false;
+	}
+	#endif
+}
+
+void cGpuTimer::FrameMark( const Uint32& Frame ) {
+	#ifdef EE_GLEW_AVAILABLE
+	if ( !IsSupported() ) {
+		return;
+	}
+
+	if ( !mCreated ) {
+		glGenQueries( QUERIES_COUNT, mQueries );
+		mCreated = true;
+	}
+
+	FrameEnd();
+
+	ReadResults();
+
+	Uint32 Next = ( mCurrent + 1 ) % QUERIES_COUNT;
+
+	// If the oldest query is still pending this frame is not measured, instead of waiting for the GPU
+	if ( mPending[ Next ] ) {
+		return;
+	}
+
+	mCurrent		= Next;
+	mFrames[ Next ]	= Frame;
+	mActive			= true;
+
+	glBeginQuery( GL_TIME_ELAPSED, mQueries[ Next ] );
+	#endif
+}
+
+}}}
@@ -0,0 +1,45 @@
+#ifndef EE_GRAPHICSCGPUTIMER_HPP
+#define EE_GRAPHICSCGPUTIMER_HPP
+
+#include <eepp/graphics/base.hpp>
+#include <eepp/graphics/opengl.hpp>
+
+namespace EE { namespace Graphics { namespace Private {
+
+/** @brief Measures the GPU time of every frame with timer queries, and reports it to the profiler.
+*	The query results are read some frames later ( when they are available ), so reading them never stalls the pipeline.
+*/
+class cGpuTimer {
+	SINGLETON_DECLARE_HEADERS(cGpuTimer)
+
+	public:
+		~cGpuTimer();
+
+		/** @return If the timer queries are supported by the current renderer */
+		static bool IsSupported();
+
+		/** Ends the query of the current frame ( if any ), starts the query for the new frame and reports the finished queries results to the profiler.
+		*	@param Frame The profiler frame number of the new frame
+		*/
+		void FrameMark( const Uint32& Frame );
+
+		/** Ends the query of the current frame. It must be called before the buffers are swapped. */
+		void FrameEnd();
+	protected:
+		enum { QUERIES_COUNT = 4 };
+
+		GLuint	mQueries[ QUERIES_COUNT ];
+		Uint32	mFrames[ QUERIES_COUNT ];
+		bool	mPending[ QUERIES_COUNT ];
+		Uint32	mCurrent;
+		bool	mActive;
+		bool	mCreated;
+
+		cGpuTimer();
+
+		void ReadResults();
+};
+
+}}}
+
+#endif
@@ -1,4 +1,8 @@
 #include <eepp/graphics/cimage.hpp>
+#include <eepp/graphics/ccompressedimage.hpp>
+#include <eepp/graphics/cimagesaver.hpp>
+#include <eepp/graphics/cpngencoder.hpp>
+#include <eepp/graphics/pixelhelper.hpp>
 #include <eepp/system/filesystem.hpp>
 #include <eepp/system/clog.hpp>
 #include <eepp/system/cpack.hpp>
@@ -160,6 +164,16 @@ void cImage::JpegQuality( Uint32 level ) {
 	sJpegQuality = level;
 }
 
+Int32 cImage::sPngCompressionLevel = 6;
+
+Int32 cImage::PngCompressionLevel() {
+	return sPngCompressionLevel;
+}
+
+void cImage::PngCompressionLevel( Int32 level ) {
+	sPngCompressionLevel = eemin( eemax( level, 0 ), 9 );
+}
+
 std::string cImage::SaveTypeToExtension( const Int32& Format ) {
 	switch( Format ) {
 		case SAVE_TYPE_TGA: return "tga";
@@ -167,6 +181,7 @@ std::string cImage::SaveTypeToExtension( const Int32& Format ) {
 		case SAVE_TYPE_PNG: return "png";
 		case SAVE_TYPE_DDS: return "dds";
 		case SAVE_TYPE_JPG: return "jpg";
+		case SAVE_TYPE_KTX: return "ktx";
 		case SAVE_TYPE_UNKNOWN:
 		default:
 			break;
@@ -183,6 +198,7 @@ EE_SAVE_TYPE cImage::ExtensionToSaveType( const std::string& Extension ) {
 	else if ( Extension == "png" )	saveType = SAVE_TYPE_PNG;
 	else if ( Extension == "dds" )	saveType = SAVE_TYPE_DDS;
 	else if ( Extension == "jpg" || Extension == "jpeg" ) saveType = SAVE_TYPE_JPG;
+	else if ( Extension == "ktx" )	saveType = SAVE_TYPE_KTX;
 
 	return saveType;
 }
@@ -468,7 +484,11 @@ bool cImage::SaveToFile( const std::string& filepath, const EE_SAVE_TYPE& Format
 		FileSystem::MakeDir( fpath );
 
 	if ( NULL != mPixels && 0 != mWidth && 0 != mHeight && 0 != mChannels ) {
-		if ( SAVE_TYPE_JPG != Format ) {
+		if ( SAVE_TYPE_KTX == Format ) {
+			Res = cCompressedImage::Save( filepath, GetPixelsPtr(), mWidth, mHeight, mChannels );
+		} else if ( SAVE_TYPE_PNG == Format ) {
+			Res = Private::cPngEncoder::Save( filepath, GetPixelsPtr(), mWidth, mHeight, mChannels, PngCompressionLevel() );
+		} else if ( SAVE_TYPE_JPG != Format ) {
 			Res = 0 != ( SOIL_save_image ( filepath.c_str(), Format, (Int32)mWidth, (Int32)mHeight, mChannels, GetPixelsPtr() ) );
 		} else {
 			jpge::params params;
@@ -480,41 +500,17 @@ bool cImage::SaveToFile( const std::string& filepath, const EE_SAVE_TYPE& Format
 	return Res;
 }
 
-void cImage::ReplaceColor( const eeColorA& ColorKey, const eeColorA& NewColor ) {
-	eeUint Pos = 0;
+void cImage::SaveToFileAsync( const std::string& filepath, const EE_SAVE_TYPE& Format ) {
+	if ( NULL != mPixels && 0 != mWidth && 0 != mHeight && 0 != mChannels ) {
+		cImageSaver::instance()->Save( eeNew( cImage, ( GetPixelsPtr(), mWidth, mHeight, mChannels ) ), filepath, Format );
+	}
+}
 
+void cImage::ReplaceColor( const eeColorA& ColorKey, const eeColorA& NewColor ) {
 	if ( NULL == mPixels )
 		return;
 
-	eeUint size = mWidth * mHeight;
-
-	for ( eeUint i = 0; i < size; i++ ) {
-		Pos = i * mChannels;
-
-		if ( 4 == mChannels ) {
-			if ( mPixels[ Pos ] == ColorKey.R() && mPixels[ Pos + 1 ] == ColorKey.G() && mPixels[ Pos + 2 ] == ColorKey.B() && mPixels[ Pos + 3 ] == ColorKey.A() ) {
-				mPixels[ Pos ] 		= NewColor.R();
-				mPixels[ Pos + 1 ]	= NewColor.G();
-				mPixels[ Pos + 2 ]	= NewColor.B();
-				mPixels[ Pos + 3 ]	= NewColor.A();
-			}
-		} else if ( 3 == mChannels ) {
-			if ( mPixels[ Pos ] == ColorKey.R() && mPixels[ Pos + 1 ] == ColorKey.G() && mPixels[ Pos + 2 ] == ColorKey.B() ) {
-				mPixels[ Pos ] 		= NewColor.R();
-				mPixels[ Pos + 1 ]	= NewColor.G();
-				mPixels[ Pos + 2 ]	= NewColor.B();
-			}
-		} else if ( 2 == mChannels ) {
-			if ( mPixels[ Pos ] == ColorKey.R() && mPixels[ Pos + 1 ] == ColorKey.G() ) {
-				mPixels[ Pos ] 		= NewColor.R();
-				mPixels[ Pos + 1 ]	= NewColor.G();
-			}
-		} else if ( 1 == mChannels ) {
-			if ( mPixels[ Pos ] == ColorKey.R() ) {
-				mPixels[ Pos ] 		= NewColor.R();
-			}
-		}
-	}
+	Private::PixelsReplaceColor( mPixels, mWidth * mHeight, mChannels, ColorKey, NewColor );
 }
 
 void cImage::CreateMaskFromColor( const eeColorA& ColorKey, Uint8 Alpha ) {
@@ -529,21 +525,7 @@ void cImage::FillWithColor( const eeColorA& Color ) {
 	if ( NULL == mPixels )
 		return;
 
-	eeUint z;
-	eeUint size = mWidth * mHeight;
-
-	for ( eeUint i = 0; i < size; i += mChannels ) {
-		for ( z = 0; z < mChannels; z++ ) {
-			if ( 0 == z )
-				mPixels[ i + z ] = Color.R();
-			else if ( 1 == z )
-				mPixels[ i + z ] = Color.G();
-			else if ( 2 == z )
-				mPixels[ i + z ] = Color.B();
-			else if ( 3 == z )
-				mPixels[ i + z ] = Color.A();
-		}
-	}
+	Private::PixelsFill( mPixels, mWidth * mHeight, mChannels, Color );
 }
 
 void cImage::CopyImage( cImage * image, const Uint32& x, const Uint32& y ) {
@@ -551,20 +533,12 @@ void cImage::CopyImage( cImage * image, const Uint32& x, const Uint32& y ) {
 		eeUint dWidth 	= image->Width();
 		eeUint dHeight 	= image->Height();
 
-		if ( mChannels != image->Channels() ) {
-			for ( eeUint ty = 0; ty < dHeight; ty++ ) {
-				for ( eeUint tx = 0; tx < dWidth; tx++ ) {
-					SetPixel( x + tx, y + ty, image->GetPixel( tx, ty ) );
-				}
-			}
-		} else {
-			// Copy per row
-			for ( eeUint ty = 0; ty < dHeight; ty++ ) {
-				Uint8 *			pDst	= &mPixels[ ( x + ( ( ty + y ) * mWidth ) ) * mChannels ];
-				const Uint8 *	pSrc	= &( ( image->GetPixelsPtr() )[ ( ty * dWidth ) * mChannels  ] );
+		// Copy per row, converting the channels if needed
+		for ( eeUint ty = 0; ty < dHeight; ty++ ) {
+			Uint8 *			pDst	= &mPixels[ ( x + ( ( ty + y ) * mWidth ) ) * mChannels ];
+			const Uint8 *	pSrc	= &( ( image->GetPixelsPtr() )[ ( ty * dWidth ) * image->Channels() ] );
 
-				memcpy( pDst, pSrc, mChannels * dWidth );
-			}
+			Private::PixelsConvert( pDst, mChannels, pSrc, image->Channels(), dWidth );
 		}
 	}
 }
@@ -594,6 +568,36 @@ void cImage::Scale( const eeFloat& scale , EE_RESAMPLER_FILTER filter ) {
 	Resize( new_width, new_height, filter );
 }
 
+cImage * cImage::CreateMipmap( EE_RESAMPLER_FILTER filter ) {
+	if ( NULL == mPixels || ( mWidth <= 1 && mHeight <= 1 ) ) {
+		return NULL;
+	}
+
+	Uint32 Width	= eemax( (Uint32)mWidth / 2, (Uint32)1 );
+	Uint32 Height	= eemax( (Uint32)mHeight / 2, (Uint32)1 );
+
+	unsigned char * resampled = resample_image( mPixels, mWidth, mHeight, mChannels, Width, Height, filter );
+
+	if ( NULL == resampled ) {
+		return NULL;
+	}
+
+	return eeNew( cImage, ( resampled, Width, Height, mChannels ) );
+}
+
+std::vector<cImage*> cImage::CreateMipmaps( EE_RESAMPLER_FILTER filter ) {
+	std::vector<cImage*> Mipmaps;
+	cImage * Level = CreateMipmap( filter );
+
+	while ( NULL != Level ) {
+		Mipmaps.push_back( Level );
+
+		Level = Level->CreateMipmap( filter );
+	}
+
+	return Mipmaps;
+}
+
 cImage * cImage::Thumbnail( const Uint32& maxWidth, const Uint32& maxHeight, EE_RESAMPLER_FILTER filter ) {
 	if ( NULL != mPixels ) {
 		eeFloat iScaleX 	= ( (eeFloat)maxWidth / (eeFloat)mWidth );
@@ -632,19 +636,42 @@ cImage * cImage::Crop( eeRecti rect ) {
 
 void cImage::Flip() {
 	if ( NULL != mPixels ) {
-		cImage tImg( mHeight, mWidth, mChannels );
+		Uint8 * Rotated = eeNewArray( Uint8, mWidth * mHeight * mChannels );
 
-		for ( eeUint y = 0; y < mHeight; y++ )
-			for ( eeUint x = 0; x < mWidth; x++ )
-				tImg.SetPixel( y, x, GetPixel( x, mHeight - 1 - y ) );
+		Private::PixelsRotate( Rotated, mPixels, mWidth, mHeight, mChannels );
 
-		ClearCache();
+		// The pixels not owned by the image are kept, the rotated pixels are owned by the image
+		if ( !mAvoidFree )
+			ClearCache();
 
-		mPixels = tImg.GetPixels();
-		mWidth 	= tImg.Width();
-		mHeight = tImg.Height();
+		eeUint Width	= mWidth;
 
-		tImg.AvoidFreeImage( true );
+		mPixels			= Rotated;
+		mWidth			= mHeight;
+		mHeight			= Width;
+		mSize			= mWidth * mHeight * mChannels;
+		mAvoidFree		= false;
+		mLoadedFromStbi	= false;
+	}
+}
+
+void cImage::FlipVertical() {
+	if ( NULL != mPixels ) {
+		Private::PixelsFlipRows( mPixels, mWidth * mChannels, mHeight );
+	}
+}
+
+void cImage::PremultiplyAlpha() {
+	if ( NULL != mPixels ) {
+		Private::PixelsPremultiplyAlpha( mPixels, mWidth * mHeight, mChannels );
+	}
+}
+
+void cImage::SwizzleChannels( const Uint8& R, const Uint8& G, const Uint8& B, const Uint8& A ) {
+	if ( NULL != mPixels && mChannels > 1 ) {
+		Uint8 Map[4] = { R, G, B, A };
+
+		Private::PixelsSwizzle( mPixels, mWidth * mHeight, mChannels, Map );
 	}
 }
 
@@ -656,13 +683,29 @@ void cImage::Blit( cImage * image, const Uint32& x, const Uint32& y ) {
 	if ( NULL != image && NULL != image->GetPixelsPtr() && x < mWidth && y < mHeight ) {
 		eeUint dh = eemin( mHeight	, y	+ image->Height() );
 		eeUint dw = eemin( mWidth	, x	+ image->Width() );
+		eeUint w = dw - x;
+		eeUint sChannels = image->Channels();
+		const Uint8 * Src = image->GetPixelsPtr();
+
+		if ( 0 == w )
+			return;
+
+		if ( 4 == mChannels && 4 == sChannels ) {
+			for ( eeUint ty = y; ty < dh; ty++ ) {
+				Private::PixelsBlend( &mPixels[ ( x + ty * mWidth ) * 4 ], &Src[ ( ty - y ) * image->Width() * 4 ], w );
+			}
+		} else {
+			// The rows are blended as RGBA, the missing channels are set to 255
+			std::vector<Uint8> SrcRow( w * 4 );
+			std::vector<Uint8> DstRow( w * 4 );
 
-		for ( eeUint ty = y; ty < dh; ty++ ) {
-			for ( eeUint tx = x; tx < dw; tx++ ) {
-				eeColorA ts( image->GetPixel( tx - x, ty - y ) );
-				eeColorA td( GetPixel( tx, ty ) );
+			for ( eeUint ty = y; ty < dh; ty++ ) {
+				Uint8 * pDst = &mPixels[ ( x + ty * mWidth ) * mChannels ];
 
-				SetPixel( tx, ty, Color::Blend( ts, td ) );
+				Private::PixelsConvert( &SrcRow[0], 4, &Src[ ( ty - y ) * image->Width() * sChannels ], sChannels, w );
+				Private::PixelsConvert( &DstRow[0], 4, pDst, mChannels, w );
+				Private::PixelsBlend( &DstRow[0], &SrcRow[0], w );
+				Private::PixelsConvert( pDst, mChannels, &DstRow[0], 4, w );
 			}
 		}
 	}
@@ -0,0 +1,127 @@
+#include <eepp/graphics/cimagesaver.hpp>
+#include <eepp/graphics/cimage.hpp>
+#include <eepp/system/cthread.hpp>
+#include <eepp/system/clock.hpp>
+
+namespace EE { namespace Graphics {
+
+class cImageSaver::cSaveJob : public cThread {
+	public:
+		cSaveJob( cImage * Img, const std::string& Filepath, const EE_SAVE_TYPE& Format ) :
+			mImg( Img ),
+			mFilepath( Filepath ),
+			mFormat( Format ),
+			mRunning( true )
+		{
+		}
+
+		~cSaveJob() {
+			eeSAFE_DELETE( mImg );
+		}
+
+		bool IsRunning() const {
+			return mRunning;
+		}
+	protected:
+		cImage *		mImg;
+		std::string		mFilepath;
+		EE_SAVE_TYPE	mFormat;
+		volatile bool	mRunning;
+
+		virtual void Run() {
+			if ( !mImg->SaveToFile( mFilepath, mFormat ) ) {
+				cLog::instance()->Write( "Failed to save image: " + mFilepath );
+			}
+
+			mRunning = false;
+		}
+};
+
+SINGLETON_DECLARE_IMPLEMENTATION(cImageSaver)
+
+cImageSaver::cImageSaver()
+{
+}
+
+cImageSaver::~cImageSaver() {
+	Wait();
+}
+
+void cImageSaver::Save( cImage * Img, const std::string& Filepath, const EE_SAVE_TYPE& Format ) {
+	if ( NULL == Img ) {
+		return;
+	}
+
+	RemoveFinished( false );
+
+	// Every image is encoded in its own thread, the number of images saved at the same time is limited to the number of CPUs
+	if ( GetPendingCount() >= (Uint32)eemax( Sys::GetCPUCount(), 1 ) ) {
+		cSaveJob * Oldest;
+
+		{
+			cLock l( mMutex );
+			Oldest = mJobs.front();
+			mJobs.pop_front();
+		}
+
+		Oldest->Wait();
+
+		eeSAFE_DELETE( Oldest );
+	}
+
+	cSaveJob * Job = eeNew( cSaveJob, ( Img, Filepath, Format ) );
+
+	{
+		cLock l( mMutex );
+		mJobs.push_back( Job );
+	}
+
+	Job->Launch();
+}
+
+Uint32 cImageSaver::GetPendingCount() {
+	cLock l( mMutex );
+
+	Uint32 Count = 0;
+
+	for ( std::list<cSaveJob*>::iterator it = mJobs.begin(); it != mJobs.end(); it++ ) {
+		if ( (*it)->IsRunning() ) {
+			Count++;
+		}
+	}
+
+	return Count;
+}
+
+void cImageSaver::Wait() {
+	RemoveFinished( true );
+}
+
+void cImageSaver::RemoveFinished( const bool& Wait ) {
+	std::list<cSaveJob*> Remove;
+
+	{
+		cLock l( mMutex );
+
+		std::list<cSaveJob*>::iterator it = mJobs.begin();
+
+		while ( it != mJobs.end() ) {
+			if ( Wait || !(*it)->IsRunning() ) {
+				Remove.push_back( *it );
+
+				it = mJobs.erase( it );
+			} else {
+				it++;
+			}
+		}
+	}
+
+	for ( std::list<cSaveJob*>::iterator it = Remove.begin(); it != Remove.end(); it++ ) {
+		// The thread could still be returning from Run, waiting it doesn't block
+		(*it)->Wait();
+
+		eeSAFE_DELETE( *it );
+	}
+}
+
+}}
@@ -0,0 +1,297 @@
+#include <eepp/graphics/cpngencoder.hpp>
+#include <eepp/system/cthread.hpp>
+#include <eepp/system/ciostreamfile.hpp>
+#include <eepp/helper/zlib/zlib.h>
+
+namespace EE { namespace Graphics { namespace Private {
+
+/** The rows of the image filtered and compressed by a thread */
+class cPngStripe {
+	public:
+		cPngStripe() :
+			Pixels( NULL ),
+			Width( 0 ),
+			Channels( 0 ),
+			First( 0 ),
+			Last( 0 ),
+			Level( 0 ),
+			Final( false ),
+			Adler( 0 ),
+			RawSize( 0 ),
+			Ok( false )
+		{
+		}
+
+		void Run();
+
+		const Uint8 *		Pixels;
+		Uint32				Width;
+		Uint32				Channels;
+		Uint32				First;
+		Uint32				Last;
+		Int32				Level;
+		bool				Final;
+		std::vector<Uint8>	Out;
+		uLong				Adler;
+		Uint32				RawSize;
+		bool				Ok;
+};
+
+static inline Uint8 Paeth( const Int32& a, const Int32& b, const Int32& c ) {
+	Int32 p		= a + b - c;
+	Int32 pa	= eeabs( p - a );
+	Int32 pb	= eeabs( p - b );
+	Int32 pc	= eeabs( p - c );
+
+	if ( pa <= pb && pa <= pc )
+		return (Uint8)a;
+
+	if ( pb <= pc )
+		return (Uint8)b;
+
+	return (Uint8)c;
+}
+
+static inline Uint8 FilterByte( const Uint32& Filter, const Uint8 * Row, const Uint8 * Prev, const Uint32& i, const Uint32& Bpp ) {
+	Int32 a = i >= Bpp ? Row[ i - Bpp ] : 0;
+	Int32 b = Prev[i];
+	Int32 c = i >= Bpp ? Prev[ i - Bpp ] : 0;
+
+	switch ( Filter ) {
+		case 1: return (Uint8)( Row[i] - a );
+		case 2: return (Uint8)( Row[i] - b );
+		case 3: return (Uint8)( Row[i] - ( ( a + b ) >> 1 ) );
+		case 4: return (Uint8)( Row[i] - Paeth( a, b, c ) );
+		default: return Row[i];
+	}
+}
+
+/** Filters a row with the filter that gives the minimum sum of absolute differences ( the heuristic recommended by the PNG specification ) */
+static void FilterRow( Uint8 * Dst, const Uint8 * Row, const Uint8 * Prev, const Uint32& RowSize, const Uint32& Bpp, const Int32& Level ) {
+	Uint32 Best = 0;
+
+	// The stored level only copies the data, the filters are useless
+	if ( 0 != Level ) {
+		Uint32 BestSum = 0xFFFFFFFF;
+
+		for ( Uint32 f = 0; f < 5; f++ ) {
+			Uint32 Sum = 0;
+
+			for ( Uint32 i = 0; i < RowSize && Sum < BestSum; i++ ) {
+				Sum += eeabs( (Int32)(Int8)FilterByte( f, Row, Prev, i, Bpp ) );
+			}
+
+			if ( Sum < BestSum ) {
+				BestSum	= Sum;
+				Best	= f;
+			}
+		}
+	}
+
+	Dst[0] = (Uint8)Best;
+
+	for ( Uint32 i = 0; i < RowSize; i++ ) {
+		Dst[ i + 1 ] = FilterByte( Best, Row, Prev, i, Bpp );
+	}
+}
+
+void cPngStripe::Run() {
+	Uint32 RowSize = Width * Channels;
+	std::vector<Uint8> Zero( RowSize, 0 );
+	std::vector<Uint8> Filtered( ( Last - First ) * ( RowSize + 1 ) );
+
+	// The filters use the previous row of the image, so the stripes don't depend on the other stripes
+	for ( Uint32 y = First; y < Last; y++ ) {
+		const Uint8 * Row	= Pixels + y * RowSize;
+		const Uint8 * Prev	= 0 != y ? Row - RowSize : &Zero[0];
+
+		FilterRow( &Filtered[ ( y - First ) * ( RowSize + 1 ) ], Row, Prev, RowSize, Channels, Level );
+	}
+
+	RawSize	= Filtered.size();
+	Adler	= adler32( adler32( 0L, Z_NULL, 0 ), &Filtered[0], RawSize );
+
+	z_stream Stream;
+	memset( &Stream, 0, sizeof(z_stream) );
+
+	// Raw deflate, the zlib header and checksum are written once for all the stripes
+	if ( Z_OK != deflateInit2( &Stream, Level, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY ) ) {
+		Ok = false;
+		return;
+	}
+
+	Int32 Flush		= Final ? Z_FINISH : Z_SYNC_FLUSH;
+	Uint32 Written	= 0;
+	Int32 Res;
+
+	Out.resize( deflateBound( &Stream, RawSize ) + 16 );
+
+	Stream.next_in	= &Filtered[0];
+	Stream.avail_in	= RawSize;
+
+	while ( true ) {
+		if ( Written == Out.size() ) {
+			Out.resize( Out.size() * 2 );
+		}
+
+		Stream.next_out		= &Out[ Written ];
+		Stream.avail_out	= Out.size() - Written;
+
+		Res		= deflate( &Stream, Flush );
+		Written	= Out.size() - Stream.avail_out;
+
+		if ( Z_STREAM_END == Res || Z_STREAM_ERROR == Res || ( Z_BUF_ERROR == Res && 0 != Stream.avail_out ) ) {
+			break;
+		}
+
+		// The sync flush is complete when deflate doesn't fill the output buffer
+		if ( Z_SYNC_FLUSH == Flush && 0 != Stream.avail_out ) {
+			break;
+		}
+	}
+
+	deflateEnd( &Stream );
+
+	Out.resize( Written );
+
+	Ok = Final ? Z_STREAM_END == Res : Z_OK == Res;
+}
+
+static void WriteUint32( std::vector<Uint8>& Data, const Uint32& Value ) {
+	Data.push_back( (Uint8)( Value >> 24 ) );
+	Data.push_back( (Uint8)( Value >> 16 ) );
+	Data.push_back( (Uint8)( Value >> 8 ) );
+	Data.push_back( (Uint8)( Value ) );
+}
+
+static void BeginChunk( std::vector<Uint8>& Data, const char * Type, const Uint32& Size ) {
+	WriteUint32( Data, Size );
+
+	Data.insert( Data.end(), Type, Type + 4 );
+}
+
+static void EndChunk( std::vector<Uint8>& Data, const Uint32& Size ) {
+	// The CRC covers the chunk type and the chunk data
+	Uint32 Start = Data.size() - Size - 4;
+
+	WriteUint32( Data, crc32( crc32( 0L, Z_NULL, 0 ), &Data[ Start ], Size + 4 ) );
+}
+
+bool cPngEncoder::Encode( std::vector<Uint8>& Data, const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels, const Int32& Level, const Uint32& Threads ) {
+	if ( NULL == Pixels || 0 == Width || 0 == Height || Channels < 1 || Channels > 4 ) {
+		return false;
+	}
+
+	Uint32 RowSize	= Width * Channels;
+	Int32 ZLevel	= eemin( eemax( Level, 0 ), 9 );
+	Uint32 Count	= 0 != Threads ? Threads : (Uint32)eemax( Sys::GetCPUCount(), 1 );
+	Uint32 i;
+
+	// Every stripe compresses at least 256 KB, the small images are compressed in the calling thread
+	Count = eemin( Count, eemax( ( Height * RowSize ) / ( 256 * 1024 ), (Uint32)1 ) );
+	Count = eemin( Count, Height );
+
+	std::vector<cPngStripe> Stripes( Count );
+	Uint32 Rows = Height / Count;
+
+	for ( i = 0; i < Count; i++ ) {
+		cPngStripe& Stripe = Stripes[i];
+
+		Stripe.Pixels	= Pixels;
+		Stripe.Width	= Width;
+		Stripe.Channels	= Channels;
+		Stripe.First	= i * Rows;
+		Stripe.Last		= i == Count - 1 ? Height : ( i + 1 ) * Rows;
+		Stripe.Level	= ZLevel;
+		Stripe.Final	= i == Count - 1;
+	}
+
+	std::vector<cThread*> Workers;
+
+	for ( i = 1; i < Count; i++ ) {
+		Workers.push_back( eeNew( cThread, ( &cPngStripe::Run, &Stripes[i] ) ) );
+		Workers.back()->Launch();
+	}
+
+	Stripes[0].Run();
+
+	for ( i = 0; i < Workers.size(); i++ ) {
+		Workers[i]->Wait();
+
+		eeSAFE_DELETE( Workers[i] );
+	}
+
+	Uint32 IdatSize = 2 + 4;
+	uLong Adler		= Stripes[0].Adler;
+
+	for ( i = 0; i < Count; i++ ) {
+		if ( !Stripes[i].Ok ) {
+			return false;
+		}
+
+		IdatSize += Stripes[i].Out.size();
+
+		if ( 0 != i ) {
+			Adler = adler32_combine( Adler, Stripes[i].Adler, Stripes[i].RawSize );
+		}
+	}
+
+	static const Uint8 Signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	static const Uint8 ColorTypes[] = { 0, 4, 2, 6 };
+
+	Data.clear();
+	Data.reserve( 8 + 25 + 12 + IdatSize + 12 );
+	Data.insert( Data.end(), Signature, Signature + 8 );
+
+	BeginChunk( Data, "IHDR", 13 );
+	WriteUint32( Data, Width );
+	WriteUint32( Data, Height );
+	Data.push_back( 8 );							// Bit depth
+	Data.push_back( ColorTypes[ Channels - 1 ] );	// Color type
+	Data.push_back( 0 );							// Compression method
+	Data.push_back( 0 );							// Filter method
+	Data.push_back( 0 );							// Interlace method
+	EndChunk( Data, 13 );
+
+	// The zlib header indicates the compression level used
+	Uint8 Cmf = 0x78;
+	Uint8 Flg = ( ZLevel < 2 ? 0 : ( ZLevel < 6 ? 1 : ( 6 == ZLevel ? 2 : 3 ) ) ) << 6;
+
+	Flg += 31 - ( ( Cmf * 256 + Flg ) % 31 );
+
+	BeginChunk( Data, "IDAT", IdatSize );
+	Data.push_back( Cmf );
+	Data.push_back( Flg );
+
+	for ( i = 0; i < Count; i++ ) {
+		Data.insert( Data.end(), Stripes[i].Out.begin(), Stripes[i].Out.end() );
+	}
+
+	WriteUint32( Data, (Uint32)Adler );
+	EndChunk( Data, IdatSize );
+
+	BeginChunk( Data, "IEND", 0 );
+	EndChunk( Data, 0 );
+
+	return true;
+}
+
+bool cPngEncoder::Save( const std::string& Filepath, const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels, const Int32& Level, const Uint32& Threads ) {
+	std::vector<Uint8> Data;
+
+	if ( !Encode( Data, Pixels, Width, Height, Channels, Level, Threads ) ) {
+		return false;
+	}
+
+	cIOStreamFile fs( Filepath, std::ios::out | std::ios::binary );
+
+	if ( !fs.IsOpen() ) {
+		return false;
+	}
+
+	fs.Write( reinterpret_cast<const char*> (&Data[0]), Data.size() );
+
+	return true;
+}
+
+}}}
@@ -0,0 +1,26 @@
+#ifndef EE_GRAPHICSPRIVATECPNGENCODER_HPP
+#define EE_GRAPHICSPRIVATECPNGENCODER_HPP
+
+#include <eepp/graphics/base.hpp>
+
+namespace EE { namespace Graphics { namespace Private {
+
+/** @brief Encodes PNG images with zlib.
+*	The big images are split in horizontal stripes that are filtered and compressed in parallel. Every stripe is an independent raw deflate stream ended
+*	with a sync flush ( so it ends byte aligned and without the final block ), the stripes are concatenated in a single zlib stream and their
+*	Adler-32 checksums are combined. The compression ratio is almost the same than compressing the image in one piece.
+*/
+class cPngEncoder {
+	public:
+		/** Encodes the pixels as a PNG file in memory.
+		*	@param Level The zlib compression level ( 0 to 9 ). The levels 1 to 3 are much faster and usually compress slightly worse.
+		*	@param Threads The maximum number of threads used to compress the image ( 0 uses one thread per CPU ) */
+		static bool Encode( std::vector<Uint8>& Data, const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels, const Int32& Level, const Uint32& Threads = 0 );
+
+		/** Encodes the pixels and saves the PNG file */
+		static bool Save( const std::string& Filepath, const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels, const Int32& Level, const Uint32& Threads = 0 );
+};
+
+}}}
+
+#endif
@@ -0,0 +1,86 @@
+#include <eepp/graphics/cquadindexbuffer.hpp>
+#include <eepp/graphics/renderer/cgl.hpp>
+
+namespace EE { namespace Graphics { namespace Private {
+
+SINGLETON_DECLARE_IMPLEMENTATION(cQuadIndexBuffer)
+
+const Uint32 cQuadIndexBuffer::MaxVertexs;
+
+cQuadIndexBuffer::cQuadIndexBuffer() :
+	mBuffer( 0 ),
+	mQuads( 0 ),
+	mUseBuffer( GLv_NULL != GLi->Version() && GLi->IsExtension( EEGL_ARB_vertex_buffer_object ) )
+{
+}
+
+cQuadIndexBuffer::~cQuadIndexBuffer() {
+	if ( 0 != mBuffer ) {
+		glDeleteBuffersARB( 1, &mBuffer );
+	}
+}
+
+void cQuadIndexBuffer::Grow( const Uint32& Quads ) {
+	Uint32 NewQuads = eemax( mQuads, (Uint32)256 );
+
+	while ( NewQuads < Quads ) {
+		NewQuads <<= 1;
+	}
+
+	NewQuads = eemin( NewQuads, MaxVertexs / 4 );
+
+	mIndexes.resize( NewQuads * 6 );
+
+	for ( Uint32 i = mQuads; i < NewQuads; i++ ) {
+		Uint16 v = (Uint16)( i * 4 );
+		Uint16 * idx = &mIndexes[ i * 6 ];
+
+		idx[0] = v + 1;
+		idx[1] = v;
+		idx[2] = v + 3;
+		idx[3] = v + 1;
+		idx[4] = v + 2;
+		idx[5] = v + 3;
+	}
+
+	mQuads = NewQuads;
+
+	if ( mUseBuffer ) {
+		if ( 0 == mBuffer ) {
+			glGenBuffersARB( 1, &mBuffer );
+
+			mUseBuffer = 0 != mBuffer;
+		}
+
+		if ( mUseBuffer ) {
+			glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER, mBuffer );
+			glBufferDataARB( GL_ELEMENT_ARRAY_BUFFER, mIndexes.size() * sizeof(Uint16), &mIndexes[0], GL_STATIC_DRAW );
+			glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER, 0 );
+		}
+	}
+}
+
+void cQuadIndexBuffer::DrawQuads( const Uint32& NumVertex ) {
+	Uint32 Quads = eemin( NumVertex, MaxVertexs ) / 4;
+
+	if ( 0 == Quads ) {
+		return;
+	}
+
+	if ( Quads > mQuads ) {
+		Grow( Quads );
+	}
+
+	if ( mUseBuffer ) {
+		// The element buffer binding is part of the vertex array object state, so it's bound every time
+		glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER, mBuffer );
+
+		GLi->DrawElements( GL_TRIANGLES, Quads * 6, GL_UNSIGNED_SHORT, NULL );
+
+		glBindBufferARB( GL_ELEMENT_ARRAY_BUFFER, 0 );
+	} else {
+		GLi->DrawElements( GL_TRIANGLES, Quads * 6, GL_UNSIGNED_SHORT, &mIndexes[0] );
+	}
+}
+
+}}}
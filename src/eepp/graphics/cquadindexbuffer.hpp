@@ -0,0 +1,38 @@
+#ifndef EE_GRAPHICSCQUADINDEXBUFFER_HPP
+#define EE_GRAPHICSCQUADINDEXBUFFER_HPP
+
+#include <eepp/graphics/base.hpp>
+#include <eepp/graphics/opengl.hpp>
+
+namespace EE { namespace Graphics { namespace Private {
+
+/** @brief The static index buffer shared by the batch renderers to draw quads when the renderer doesn't support them.
+*	Quads are kept as 4 vertexs and every quad is drawn as two triangles indexing them ( 0 1 3, 1 2 3 ), instead of duplicating two vertexs per quad.
+*/
+class cQuadIndexBuffer {
+	SINGLETON_DECLARE_HEADERS(cQuadIndexBuffer)
+
+	public:
+		/** The maximum number of vertexs that can be drawn in one call ( the indexes are 16 bits ) */
+		static const Uint32 MaxVertexs = 65536;
+
+		~cQuadIndexBuffer();
+
+		/** Draws the quads of the current vertex arrays as triangles.
+		*	@param NumVertex The number of vertexs to draw ( 4 per quad ), it can't be greater than MaxVertexs.
+		*/
+		void DrawQuads( const Uint32& NumVertex );
+	protected:
+		GLuint				mBuffer;
+		Uint32				mQuads;
+		bool				mUseBuffer;
+		std::vector<Uint16>	mIndexes;
+
+		cQuadIndexBuffer();
+
+		void Grow( const Uint32& Quads );
+};
+
+}}}
+
+#endif
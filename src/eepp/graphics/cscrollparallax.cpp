@@ -5,14 +5,17 @@ namespace EE { namespace Graphics {
 cScrollParallax::cScrollParallax() :
 	mSubTexture( NULL ),
 	mBlend( ALPHA_NORMAL ),
-	mColor( 255, 255, 255, 255 )
+	mColor( 255, 255, 255, 255 ),
+	mVersion( 0 )
 {
 }
 
 cScrollParallax::~cScrollParallax()
 {}
 
-cScrollParallax::cScrollParallax( cSubTexture * SubTexture, const eeVector2f& Position, const eeSizef& Size, const eeVector2f& Speed, const eeColorA& Color, const EE_BLEND_MODE& Blend ) {
+cScrollParallax::cScrollParallax( cSubTexture * SubTexture, const eeVector2f& Position, const eeSizef& Size, const eeVector2f& Speed, const eeColorA& Color, const EE_BLEND_MODE& Blend ) :
+	mVersion( 0 )
+{
 	Create( SubTexture, Position, Size, Speed, Color, Blend );
 }
 
@@ -22,6 +25,7 @@ cSubTexture * cScrollParallax::SubTexture() const {
 
 void cScrollParallax::SubTexture( cSubTexture * subTexture ) {
 	mSubTexture = subTexture;
+	mVersion++;
 
 	SetSubTexture();
 }
@@ -48,6 +52,7 @@ bool cScrollParallax::Create( cSubTexture * SubTexture, const eeVector2f& Positi
 	mSpeed		= Speed;
 	mColor		= Color;
 	mBlend		= Blend;
+	mVersion++;
 
 	SetAABB();
 	SetSubTexture();
@@ -57,6 +62,7 @@ bool cScrollParallax::Create( cSubTexture * SubTexture, const eeVector2f& Positi
 
 void cScrollParallax::Size( const eeSizef& size ) {
 	mSize = size;
+	mVersion++;
 
 	SetSubTexture();
 	SetAABB();
@@ -68,6 +74,7 @@ void cScrollParallax::Position( const eeVector2f& Pos ) {
 	mInitPos = Pos;
 
 	mPos = Pos + Diff;
+	mVersion++;
 
 	SetAABB();
 }
@@ -150,10 +157,15 @@ void cScrollParallax::Draw() {
 
 void cScrollParallax::Speed( const eeVector2f& speed ) {
 	mSpeed = speed;
+	mVersion++;
 }
 
 const eeVector2f& cScrollParallax::Speed() const {
 	return mSpeed;
 }
 
+const Uint32& cScrollParallax::Version() const {
+	return mVersion;
+}
+
 }}
@@ -0,0 +1,243 @@
+#include <eepp/graphics/cstaticbatch.hpp>
+#include <eepp/graphics/cglobalbatchrenderer.hpp>
+#include <eepp/graphics/cvertexbuffer.hpp>
+#include <eepp/graphics/ctexturefactory.hpp>
+#include <eepp/graphics/ctexture.hpp>
+#include <eepp/graphics/renderer/cgl.hpp>
+
+namespace EE { namespace Graphics {
+
+cStaticBatch::cStaticBatch() :
+	mSource( NULL ),
+	mVertexsCount( 0 ),
+	mSourceVersion( 0 ),
+	mRecording( false ),
+	mValid( false )
+{
+}
+
+cStaticBatch::~cStaticBatch() {
+	if ( mRecording && NULL != mSource ) {
+		mSource->mCapture = NULL;
+	}
+
+	Release();
+}
+
+void cStaticBatch::Begin( const Uint32& SourceVersion, cBatchRenderer * Source ) {
+	if ( mRecording ) {
+		End();
+	}
+
+	Release();
+
+	mSource			= NULL != Source ? Source : cGlobalBatchRenderer::instance();
+	mSourceVersion	= SourceVersion;
+	mRecording		= true;
+
+	// Draws anything batched before, it doesn't belong to the static batch
+	mSource->Draw();
+	mSource->mCapture = this;
+}
+
+void cStaticBatch::End() {
+	if ( !mRecording ) {
+		return;
+	}
+
+	mSource->Draw();
+	mSource->mCapture = NULL;
+	mSource = NULL;
+
+	mRecording = false;
+
+	Build();
+}
+
+const bool& cStaticBatch::IsRecording() const {
+	return mRecording;
+}
+
+void cStaticBatch::Invalidate() {
+	Release();
+}
+
+bool cStaticBatch::IsValid() const {
+	return mValid;
+}
+
+bool cStaticBatch::IsValid( const Uint32& SourceVersion ) const {
+	return mValid && mSourceVersion == SourceVersion;
+}
+
+const Uint32& cStaticBatch::SourceVersion() const {
+	return mSourceVersion;
+}
+
+Uint32 cStaticBatch::GetCommandsCount() const {
+	return mCommands.size();
+}
+
+Uint32 cStaticBatch::GetVertexsCount() const {
+	return mVertexsCount;
+}
+
+bool cStaticBatch::CanMerge( const EE_DRAW_MODE& Mode ) {
+	return DM_QUADS == Mode || DM_TRIANGLES == Mode || DM_LINES == Mode || DM_POINTS == Mode;
+}
+
+void cStaticBatch::Capture( const EE_DRAW_MODE& Mode, const EE_BLEND_MODE& Blend, const cTexture * Texture, const eeVertex * Vertex, const Uint32& NumVertex ) {
+	if ( 0 == NumVertex ) {
+		return;
+	}
+
+	Uint32 TexId = NULL != Texture ? Texture->Id() : 0;
+
+	if ( mCommands.size() ) {
+		cCommand& Last = mCommands.back();
+
+		if ( Last.Mode == Mode && Last.Blend == Blend && Last.TexId == TexId && CanMerge( Mode ) ) {
+			mVertexs.insert( mVertexs.end(), Vertex, Vertex + NumVertex );
+			Last.Count += NumVertex;
+			return;
+		}
+	}
+
+	cCommand Cmd;
+	Cmd.Mode	= Mode;
+	Cmd.Blend	= Blend;
+	Cmd.TexId	= TexId;
+	Cmd.Start	= mVertexs.size();
+	Cmd.Count	= NumVertex;
+	Cmd.Buffer	= NULL;
+
+	mVertexs.insert( mVertexs.end(), Vertex, Vertex + NumVertex );
+	mCommands.push_back( Cmd );
+}
+
+void cStaticBatch::Build() {
+	for ( Uint32 i = 0; i < mCommands.size(); i++ ) {
+		cCommand& Cmd = mCommands[i];
+		EE_DRAW_MODE Mode = Cmd.Mode;
+		Uint32 Flags = 0 != Cmd.TexId ? VERTEX_FLAGS_DEFAULT : VERTEX_FLAGS_PRIMITIVE;
+		bool QuadIndices = false;
+
+		// The renderers without quads draw them as indexed triangles, the same way the batch renderer does
+		if ( !GLi->QuadsSupported() ) {
+			if ( DM_QUADS == Mode ) {
+				Mode		= DM_TRIANGLES;
+				QuadIndices	= true;
+				Flags		|= VERTEX_FLAG_GET( VERTEX_FLAG_USE_INDICES );
+			} else if ( DM_POLYGON == Mode ) {
+				Mode		= DM_TRIANGLE_FAN;
+			}
+		}
+
+		cVertexBuffer * Buffer = cVertexBuffer::New( Flags, Mode, Cmd.Count, QuadIndices ? Cmd.Count / 4 * 6 : 0, VBO_USAGE_TYPE_STATIC );
+		const eeVertex * Vertex = &mVertexs[ Cmd.Start ];
+
+		for ( Uint32 v = 0; v < Cmd.Count; v++ ) {
+			Buffer->AddVertex( Vertex[v].pos );
+
+			if ( 0 != Cmd.TexId ) {
+				Buffer->AddVertexCoord( eeVector2f( Vertex[v].tex.u, Vertex[v].tex.v ) );
+			}
+
+			Buffer->AddColor( Vertex[v].color );
+		}
+
+		if ( QuadIndices ) {
+			for ( Uint32 q = 0; q < Cmd.Count / 4; q++ ) {
+				Uint32 idx = q * 4;
+
+				Buffer->AddIndex( idx + 1 );
+				Buffer->AddIndex( idx );
+				Buffer->AddIndex( idx + 3 );
+				Buffer->AddIndex( idx + 1 );
+				Buffer->AddIndex( idx + 2 );
+				Buffer->AddIndex( idx + 3 );
+			}
+		}
+
+		Buffer->Compile();
+
+		Cmd.Buffer = Buffer;
+	}
+
+	mVertexsCount = mVertexs.size();
+
+	// The vertex buffers keep their own copy of the geometry
+	std::vector<eeVertex>().swap( mVertexs );
+
+	mValid = true;
+}
+
+void cStaticBatch::Release() {
+	for ( Uint32 i = 0; i < mCommands.size(); i++ ) {
+		eeSAFE_DELETE( mCommands[i].Buffer );
+	}
+
+	mCommands.clear();
+	mVertexs.clear();
+
+	mVertexsCount	= 0;
+	mValid			= false;
+}
+
+void cStaticBatch::Draw() {
+	Draw( eeVector2f( 0, 0 ) );
+}
+
+void cStaticBatch::Draw( const eeVector2f& Offset ) {
+	if ( !mValid || mRecording ) {
+		return;
+	}
+
+	// Keeps the draw order with the geometry already batched
+	cGlobalBatchRenderer::instance()->Draw();
+
+	cTextureFactory * TF = cTextureFactory::instance();
+	bool Translate = 0 != Offset.x || 0 != Offset.y;
+
+	if ( Translate ) {
+		GLi->PushMatrix();
+		GLi->Translatef( Offset.x, Offset.y, 0.0f );
+	}
+
+	for ( Uint32 i = 0; i < mCommands.size(); i++ ) {
+		cCommand& Cmd = mCommands[i];
+		cTexture * Tex = NULL;
+
+		if ( 0 != Cmd.TexId ) {
+			Tex = TF->GetTexture( Cmd.TexId );
+
+			// The texture was removed after the recording
+			if ( NULL == Tex ) {
+				continue;
+			}
+
+			TF->Bind( Tex );
+		}
+
+		BlendMode::SetMode( Cmd.Blend );
+
+		if ( DM_POINTS == Cmd.Mode && NULL != Tex ) {
+			GLi->Enable( GL_POINT_SPRITE );
+			GLi->PointSize( (GLfloat)Tex->Width() );
+		}
+
+		Cmd.Buffer->Bind();
+		Cmd.Buffer->Draw();
+		Cmd.Buffer->Unbind();
+
+		if ( DM_POINTS == Cmd.Mode && NULL != Tex ) {
+			GLi->Disable( GL_POINT_SPRITE );
+		}
+	}
+
+	if ( Translate ) {
+		GLi->PopMatrix();
+	}
+}
+
+}}
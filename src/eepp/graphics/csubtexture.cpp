@@ -4,6 +4,9 @@
 #include <eepp/helper/SOIL2/src/SOIL2/SOIL2.h>
 #include <eepp/helper/jpeg-compressor/jpge.h>
 #include <eepp/graphics/ctexturesaver.hpp>
+#include <eepp/graphics/ccompressedimage.hpp>
+#include <eepp/graphics/cpngencoder.hpp>
+#include <eepp/graphics/pixelhelper.hpp>
 using namespace EE::Graphics::Private;
 
 namespace EE { namespace Graphics {
@@ -11,6 +14,7 @@ namespace EE { namespace Graphics {
 cSubTexture::cSubTexture() :
 	mPixels(NULL),
 	mAlpha(NULL),
+	mCollisionMask(NULL),
 	mId(0),
 	mTexId(0),
 	mTexture(NULL),
@@ -24,6 +28,7 @@ cSubTexture::cSubTexture() :
 cSubTexture::cSubTexture( const Uint32& TexId, const std::string& Name ) :
 	mPixels(NULL),
 	mAlpha(NULL),
+	mCollisionMask(NULL),
 	mName( Name ),
 	mId( String::Hash( mName ) ),
 	mTexId( TexId ),
@@ -38,6 +43,7 @@ cSubTexture::cSubTexture( const Uint32& TexId, const std::string& Name ) :
 cSubTexture::cSubTexture( const Uint32& TexId, const eeRecti& SrcRect, const std::string& Name ) :
 	mPixels(NULL),
 	mAlpha(NULL),
+	mCollisionMask(NULL),
 	mName( Name ),
 	mId( String::Hash( mName ) ),
 	mTexId( TexId ),
@@ -52,6 +58,7 @@ cSubTexture::cSubTexture( const Uint32& TexId, const eeRecti& SrcRect, const std
 cSubTexture::cSubTexture( const Uint32& TexId, const eeRecti& SrcRect, const eeSizef& DestSize, const std::string& Name ) :
 	mPixels(NULL),
 	mAlpha(NULL),
+	mCollisionMask(NULL),
 	mName( Name ),
 	mId( String::Hash( mName ) ),
 	mTexId( TexId ),
@@ -66,6 +73,7 @@ cSubTexture::cSubTexture( const Uint32& TexId, const eeRecti& SrcRect, const eeS
 cSubTexture::cSubTexture( const Uint32& TexId, const eeRecti& SrcRect, const eeSizef& DestSize, const eeVector2i &Offset, const std::string& Name ) :
 	mPixels(NULL),
 	mAlpha(NULL),
+	mCollisionMask(NULL),
 	mName( Name ),
 	mId( String::Hash( mName ) ),
 	mTexId( TexId ),
@@ -106,6 +114,8 @@ const Uint32& cSubTexture::Texture() {
 void cSubTexture::Texture( const Uint32& TexId ) {
 	mTexId		= TexId;
 	mTexture	= cTextureFactory::instance()->GetTexture( TexId );
+
+	eeSAFE_DELETE( mCollisionMask );
 }
 
 const eeRecti& cSubTexture::SrcRect() const {
@@ -120,6 +130,9 @@ void cSubTexture::SrcRect( const eeRecti& Rect ) {
 
 	if ( NULL != mAlpha )
 		CacheAlphaMask();
+
+	// The collision mask is created again when needed
+	eeSAFE_DELETE( mCollisionMask );
 }
 
 const eeSizef& cSubTexture::DestSize() const {
@@ -160,10 +173,13 @@ cTexture * cSubTexture::GetTexture() {
 void cSubTexture::ReplaceColor( eeColorA ColorKey, eeColorA NewColor ) {
 	mTexture->Lock();
 
-	for ( eeInt y = mSrcRect.Top; y < mSrcRect.Bottom; y++ ) {
-		for ( eeInt x = mSrcRect.Left; x < mSrcRect.Right; x++ ) {
-			if ( mTexture->GetPixel( x, y ) == ColorKey )
-				mTexture->SetPixel( x, y, NewColor );
+	Uint8 * Pixels		= mTexture->GetPixels();
+	Uint32 Channels		= mTexture->Channels();
+	Uint32 Width		= mTexture->Width();
+
+	if ( NULL != Pixels ) {
+		for ( eeInt y = mSrcRect.Top; y < mSrcRect.Bottom; y++ ) {
+			Private::PixelsReplaceColor( Pixels + ( y * Width + mSrcRect.Left ) * Channels, mSrcRect.Right - mSrcRect.Left, Channels, ColorKey, NewColor );
 		}
 	}
 
@@ -239,6 +255,42 @@ void cSubTexture::CacheColors() {
 	mTexture->Unlock();
 }
 
+void cSubTexture::CacheCollisionMask( const Uint8& AlphaThreshold ) {
+	if ( NULL == mTexture )
+		return;
+
+	// The texture atlas locks the texture once for all its SubTextures
+	bool Locked = !mTexture->LocalCopy();
+
+	if ( Locked )
+		mTexture->Lock();
+
+	eeSAFE_DELETE( mCollisionMask );
+
+	const Uint8 * Pixels	= mTexture->GetPixels();
+	Uint32 Channels			= mTexture->Channels();
+	Int32 Left				= eemax( mSrcRect.Left, 0 );
+	Int32 Top				= eemax( mSrcRect.Top, 0 );
+	Int32 Right				= eemin( mSrcRect.Right, (Int32)mTexture->Width() );
+	Int32 Bottom			= eemin( mSrcRect.Bottom, (Int32)mTexture->Height() );
+
+	if ( NULL != Pixels && Right > Left && Bottom > Top ) {
+		mCollisionMask = eeNew( cCollisionMask, ( Pixels + ( Top * mTexture->Width() + Left ) * Channels, Right - Left, Bottom - Top, Channels, mTexture->Width() * Channels, AlphaThreshold ) );
+	} else {
+		mCollisionMask = eeNew( cCollisionMask, () );
+	}
+
+	if ( Locked )
+		mTexture->Unlock();
+}
+
+const cCollisionMask * cSubTexture::GetCollisionMask() {
+	if ( NULL == mCollisionMask )
+		CacheCollisionMask();
+
+	return mCollisionMask;
+}
+
 Uint8 cSubTexture::GetAlphaAt( const Int32& X, const Int32& Y ) {
 	if ( mTexture->LocalCopy() )
 		return mTexture->GetPixel( mSrcRect.Left + X, mSrcRect.Right + Y ).A();
@@ -295,6 +347,7 @@ void cSubTexture::SetColorAt( const Int32& X, const Int32& Y, const eeColorA& Co
 void cSubTexture::ClearCache() {
 	eeSAFE_DELETE_ARRAY( mPixels );
 	eeSAFE_DELETE_ARRAY( mAlpha );
+	eeSAFE_DELETE( mCollisionMask );
 }
 
 Uint8 * cSubTexture::Lock() {
@@ -354,7 +407,11 @@ bool cSubTexture::SaveToFile(const std::string& filepath, const EE_SAVE_TYPE& Fo
 	Lock();
 
 	if ( NULL != mTexture ) {
-		if ( SAVE_TYPE_JPG != Format ) {
+		if ( SAVE_TYPE_KTX == Format ) {
+			Res = cCompressedImage::Save( filepath, GetPixelsPtr(), RealSize().Width(), RealSize().Height(), mTexture->Channels() );
+		} else if ( SAVE_TYPE_PNG == Format ) {
+			Res = cPngEncoder::Save( filepath, GetPixelsPtr(), RealSize().Width(), RealSize().Height(), mTexture->Channels(), cImage::PngCompressionLevel() );
+		} else if ( SAVE_TYPE_JPG != Format ) {
 			Res = 0 != ( SOIL_save_image ( filepath.c_str(), Format, RealSize().Width(), RealSize().Height(), mTexture->Channels(), GetPixelsPtr() ) );
 		} else {
 			jpge::params params;
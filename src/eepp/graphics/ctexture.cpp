@@ -57,7 +57,7 @@ cTexture::~cTexture() {
 void cTexture::DeleteTexture() {
 	if ( mTexture ) {
 		GLuint Texture = static_cast<GLuint>(mTexture);
-		glDeleteTextures(1, &Texture);
+		GLi->DeleteTextures( 1, &Texture );
 
 		mTexture = 0;
 		mFlags = 0;
@@ -297,6 +297,35 @@ void cTexture::Flip() {
 	mImgHeight 	= mHeight;
 }
 
+void cTexture::FlipVertical() {
+	Lock();
+
+	cImage::FlipVertical();
+
+	Unlock( false, true );
+}
+
+void cTexture::PremultiplyAlpha() {
+	if ( Premultiplied() || ( 2 != mChannels && 4 != mChannels ) )
+		return;
+
+	Lock();
+
+	cImage::PremultiplyAlpha();
+
+	Unlock( false, true );
+
+	Premultiplied( true );
+}
+
+void cTexture::SwizzleChannels( const Uint8& R, const Uint8& G, const Uint8& B, const Uint8& A ) {
+	Lock();
+
+	cImage::SwizzleChannels( R, G, B, A );
+
+	Unlock( false, true );
+}
+
 bool cTexture::LocalCopy() {
 	return ( mPixels != NULL );
 }
@@ -423,6 +452,17 @@ bool cTexture::Grabed() const {
 	return 0 != ( mFlags & TEX_FLAG_GRABED );
 }
 
+void cTexture::Premultiplied( const bool& isPremultiplied ) {
+	if ( isPremultiplied )
+		mFlags |= TEX_FLAG_PREMULTIPLIED;
+	else
+		mFlags &= ~TEX_FLAG_PREMULTIPLIED;
+}
+
+bool cTexture::Premultiplied() const {
+	return 0 != ( mFlags & TEX_FLAG_PREMULTIPLIED );
+}
+
 bool cTexture::IsCompressed() const {
 	return 0 != ( mFlags & TEX_FLAG_COMPRESSED );
 }
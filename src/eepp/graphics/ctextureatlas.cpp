@@ -69,4 +69,24 @@ Uint32 cTextureAtlas::GetTexturesCount() {
 	return mTextures.size();
 }
 
+void cTextureAtlas::CacheCollisionMasks( const Uint8& AlphaThreshold ) {
+	std::vector<cTexture*> Locked;
+
+	for ( Uint32 i = 0; i < mTextures.size(); i++ ) {
+		if ( NULL != mTextures[i] && !mTextures[i]->LocalCopy() ) {
+			mTextures[i]->Lock();
+
+			Locked.push_back( mTextures[i] );
+		}
+	}
+
+	for ( std::list<cSubTexture*>::iterator it = mResources.begin(); it != mResources.end(); it++ ) {
+		(*it)->CacheCollisionMask( AlphaThreshold );
+	}
+
+	for ( Uint32 i = 0; i < Locked.size(); i++ ) {
+		Locked[i]->Unlock();
+	}
+}
+
 }}
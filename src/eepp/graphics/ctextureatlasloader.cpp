@@ -193,9 +193,14 @@ void cTextureAtlasLoader::CreateSubTextures() {
 
 		cTexture * tTex 			= cTextureFactory::instance()->GetByName( path );
 
-		if ( NULL != tTex )
+		if ( NULL != tTex ) {
 			mTexuresLoaded.push_back( tTex );
 
+			// The pages were saved with premultiplied alpha by the texture packer
+			if ( mTexGrHdr.Flags & HDR_TEXTURE_ATLAS_PREMULTIPLIED_ALPHA )
+				tTex->Premultiplied( true );
+		}
+
 		// Create the Texture Atlas with the name of the real texture, not the Childs ( example load 1.png and not 1_ch1.png )
 		if ( 0 == z ) {
 			if ( mTexGrHdr.Flags & HDR_TEXTURE_ATLAS_REMOVE_EXTENSION )
@@ -435,11 +440,12 @@ bool cTextureAtlasLoader::UpdateTextureAtlas( std::string TextureAtlasPath, std:
 		if ( 2 == NeedUpdate ) {
 			cTexturePacker tp( mTexGrHdr.Width, mTexGrHdr.Height, 0 != ( mTexGrHdr.Flags & HDR_TEXTURE_ATLAS_POW_OF_TWO ), mTexGrHdr.PixelBorder, mTexGrHdr.Flags & HDR_TEXTURE_ATLAS_ALLOW_FLIPPING );
 
-			tp.AddTexturesPath( ImagesPath );
+			tp.SetPremultipliedAlpha( 0 != ( mTexGrHdr.Flags & HDR_TEXTURE_ATLAS_PREMULTIPLIED_ALPHA ) );
 
-			tp.PackTextures();
+			tp.AddTexturesPath( ImagesPath );
 
-			tp.Save( tapath, (EE_SAVE_TYPE)mTexGrHdr.Format );
+			// Reuses the current layout, only the new and modified images are placed and copied again
+			tp.SaveIncremental( tapath, (EE_SAVE_TYPE)mTexGrHdr.Format );
 		} else if ( 1 == NeedUpdate ) {
 			std::string etapath = FileSystem::FileRemoveExtension( tapath ) + EE_TEXTURE_ATLAS_EXTENSION;
 
@@ -0,0 +1,141 @@
+#include <eepp/graphics/ctextureatlaspage.hpp>
+#include <eepp/graphics/ctexturepackernode.hpp>
+#include <eepp/graphics/ctexturefactory.hpp>
+#include <eepp/graphics/ctexture.hpp>
+
+namespace EE { namespace Graphics { namespace Private {
+
+cTextureAtlasPage::cTextureAtlasPage( const Uint32& Width, const Uint32& Height, const Uint32& PixelBorder ) :
+	mTexId( 0 ),
+	mTexture( NULL ),
+	mWidth( Width ),
+	mHeight( Height ),
+	mPixelBorder( PixelBorder ),
+	mCount( 0 ),
+	mUsedArea( 0 ),
+	mFreeList( NULL )
+{
+	// The local copy is kept so the page can be reloaded if the context is lost
+	mTexId		= cTextureFactory::instance()->CreateEmptyTexture( mWidth, mHeight, 4, eeColorA( 0, 0, 0, 0 ), false, CLAMP_TO_EDGE, false, true );
+	mTexture	= cTextureFactory::instance()->GetTexture( mTexId );
+
+	NewFree( 0, 0, mWidth, mHeight );
+}
+
+cTextureAtlasPage::~cTextureAtlasPage() {
+	// The page texture is owned by the texture factory
+	TexturePackerReleaseFreeList( &mFreeList );
+}
+
+cTexture * cTextureAtlasPage::GetTexture() const {
+	return mTexture;
+}
+
+const Uint32& cTextureAtlasPage::GetTextureId() const {
+	return mTexId;
+}
+
+const Uint32& cTextureAtlasPage::Width() const {
+	return mWidth;
+}
+
+const Uint32& cTextureAtlasPage::Height() const {
+	return mHeight;
+}
+
+const Uint32& cTextureAtlasPage::Count() const {
+	return mCount;
+}
+
+const Uint32& cTextureAtlasPage::UsedArea() const {
+	return mUsedArea;
+}
+
+Uint32 cTextureAtlasPage::FreeNodesCount() const {
+	Uint32 count = 0;
+	cTexturePackerNode * node = mFreeList;
+
+	while ( NULL != node ) {
+		count++;
+		node = node->GetNext();
+	}
+
+	return count;
+}
+
+Uint32 cTextureAtlasPage::LargestFreeArea() const {
+	Uint32 area = 0;
+	cTexturePackerNode * node = mFreeList;
+
+	while ( NULL != node ) {
+		area = eemax( area, (Uint32)( node->Width() * node->Height() ) );
+		node = node->GetNext();
+	}
+
+	return area;
+}
+
+void cTextureAtlasPage::NewFree( Int32 x, Int32 y, Int32 width, Int32 height ) {
+	if ( width <= 0 || height <= 0 ) {
+		return;
+	}
+
+	TexturePackerNewFree( &mFreeList, x, y, width, height );
+}
+
+eeRecti cTextureAtlasPage::Insert( cImage * Img ) {
+	if ( NULL == mTexture || NULL == Img || NULL == Img->GetPixels() ) {
+		return eeRecti();
+	}
+
+	Int32 w = Img->Width() + mPixelBorder;
+	Int32 h = Img->Height() + mPixelBorder;
+	Int32 edgeCount;
+	cTexturePackerNode * prevBestFit;
+	cTexturePackerNode * bestFit = TexturePackerGetBestFit( mFreeList, w, h, false, &prevBestFit, &edgeCount );
+
+	if ( NULL == bestFit ) {
+		return eeRecti();
+	}
+
+	Int32 x = bestFit->X();
+	Int32 y = bestFit->Y();
+
+	if ( 2 == edgeCount ) {
+		TexturePackerRemoveNode( &mFreeList, prevBestFit, bestFit );
+	} else if ( w == bestFit->Width() ) {
+		bestFit->Y		( bestFit->Y() 		+ h );
+		bestFit->Height	( bestFit->Height() - h );
+	} else if ( h == bestFit->Height() ) {
+		bestFit->X		( bestFit->X() 		+ w );
+		bestFit->Width	( bestFit->Width() 	- w );
+	} else {
+		NewFree( bestFit->X(), bestFit->Y() + h, bestFit->Width(), bestFit->Height() - h );
+
+		bestFit->X		( bestFit->X() 		+ w );
+		bestFit->Width	( bestFit->Width() 	- w );
+		bestFit->Height	( h );
+	}
+
+	while ( TexturePackerMergeNodes( &mFreeList ) );
+
+	// Keep the local copy updated, and upload only the region of the new image
+	mTexture->cImage::CopyImage( Img, x, y );
+
+	if ( 4 == Img->Channels() ) {
+		mTexture->Update( Img, x, y );
+	} else {
+		cImage Tmp( Img->Width(), Img->Height(), 4 );
+
+		Tmp.CopyImage( Img );
+
+		mTexture->Update( &Tmp, x, y );
+	}
+
+	mCount++;
+	mUsedArea += w * h;
+
+	return eeRecti( x, y, x + Img->Width(), y + Img->Height() );
+}
+
+}}}
@@ -0,0 +1,64 @@
+#ifndef EE_GRAPHICSPRIVATECTEXTUREATLASPAGE
+#define EE_GRAPHICSPRIVATECTEXTUREATLASPAGE
+
+#include <eepp/graphics/base.hpp>
+
+namespace EE { namespace Graphics {
+class cTexture;
+class cImage;
+
+namespace Private {
+
+class cTexturePackerNode;
+
+/** @brief A texture page of the runtime atlas.
+*	The free space of the page is kept as a list of cTexturePackerNode, and the images are placed with the same best fit heuristic used by cTexturePacker
+*	( prefer the free node that shares more edges with the image, otherwise the top-left most one ).
+*/
+class cTextureAtlasPage {
+	public:
+		cTextureAtlasPage( const Uint32& Width, const Uint32& Height, const Uint32& PixelBorder );
+
+		~cTextureAtlasPage();
+
+		/** Copies the image into the page.
+		*	@return The texture region where the image was placed, or an empty rect if the image doesn't fit. */
+		eeRecti Insert( cImage * Img );
+
+		/** @return The page texture */
+		cTexture * GetTexture() const;
+
+		/** @return The page texture id */
+		const Uint32& GetTextureId() const;
+
+		const Uint32& Width() const;
+
+		const Uint32& Height() const;
+
+		/** @return The number of images inserted */
+		const Uint32& Count() const;
+
+		/** @return The area used by the images ( including the pixel border ) */
+		const Uint32& UsedArea() const;
+
+		/** @return The number of free nodes */
+		Uint32 FreeNodesCount() const;
+
+		/** @return The area of the largest free node */
+		Uint32 LargestFreeArea() const;
+	protected:
+		Uint32					mTexId;
+		cTexture *				mTexture;
+		Uint32					mWidth;
+		Uint32					mHeight;
+		Uint32					mPixelBorder;
+		Uint32					mCount;
+		Uint32					mUsedArea;
+		cTexturePackerNode *	mFreeList;
+
+		void					NewFree( Int32 x, Int32 y, Int32 width, Int32 height );
+};
+
+}}}
+
+#endif
@@ -0,0 +1,164 @@
+#include <eepp/graphics/ctexturecache.hpp>
+#include <eepp/graphics/cimage.hpp>
+#include <eepp/system/cmappedfile.hpp>
+#include <eepp/system/ciostreamfile.hpp>
+#include <eepp/system/cthread.hpp>
+#include <cstdio>
+
+namespace EE { namespace Graphics {
+
+#define EE_TEXTURE_CACHE_VERSION		( 2 )
+#define EE_TEXTURE_CACHE_DATA_OFFSET	( 64 )
+#define EE_TEXTURE_CACHE_EXTENSION		"eetc"
+
+SINGLETON_DECLARE_IMPLEMENTATION(cTextureCache)
+
+cTextureCache::cTextureCache() :
+	mEnabled( false ),
+	mCachePath( Sys::GetTempPath() + "eepp_texture_cache" )
+{
+	FileSystem::DirPathAddSlashAtEnd( mCachePath );
+}
+
+cTextureCache::~cTextureCache() {
+}
+
+void cTextureCache::Enabled( const bool& enabled ) {
+	mEnabled = enabled;
+}
+
+const bool& cTextureCache::Enabled() const {
+	return mEnabled;
+}
+
+void cTextureCache::CachePath( const std::string& path ) {
+	mCachePath = path;
+
+	FileSystem::DirPathAddSlashAtEnd( mCachePath );
+}
+
+const std::string& cTextureCache::CachePath() const {
+	return mCachePath;
+}
+
+void cTextureCache::Clear() {
+	std::vector<std::string> Files = FileSystem::FilesGetInPath( mCachePath );
+
+	for ( Uint32 i = 0; i < Files.size(); i++ ) {
+		if ( EE_TEXTURE_CACHE_EXTENSION == FileSystem::FileExtension( Files[i] ) ) {
+			FileSystem::FileRemove( mCachePath + Files[i] );
+		}
+	}
+}
+
+Uint32 cTextureCache::GetLevelsSize( const Uint32& Width, const Uint32& Height, const Uint32& Channels, const Uint32& Levels ) {
+	Uint32 Size = 0;
+
+	for ( Uint32 i = 0; i < Levels; i++ ) {
+		Size += eemax( Width >> i, (Uint32)1 ) * eemax( Height >> i, (Uint32)1 ) * Channels;
+	}
+
+	return Size;
+}
+
+std::string cTextureCache::GetEntryPath( const std::string& Source, const Uint32& Options ) const {
+	return mCachePath + String::StrFormated( "%08x%08x.%s", String::Hash( Source ), Options, EE_TEXTURE_CACHE_EXTENSION );
+}
+
+cMappedFile * cTextureCache::Open( const std::string& Source, const Uint32& SourceDate, const Uint32& Options, int * Width, int * Height, int * Channels, const Uint8 ** Pixels, Uint32 * Levels ) {
+	std::string Path( GetEntryPath( Source, Options ) );
+
+	if ( !mEnabled || !FileSystem::FileExists( Path ) ) {
+		return NULL;
+	}
+
+	cMappedFile * File = eeNew( cMappedFile, ( Path ) );
+
+	if ( File->IsOpen() && File->GetSize() >= EE_TEXTURE_CACHE_DATA_OFFSET ) {
+		const sCacheHdr * Hdr = reinterpret_cast<const sCacheHdr*>( File->GetData() );
+
+		if ( EE_TEXTURE_CACHE_MAGIC == Hdr->Magic &&
+			 EE_TEXTURE_CACHE_VERSION == Hdr->Version &&
+			 String::Hash( Source ) == Hdr->SourceHash &&
+			 SourceDate == Hdr->SourceDate &&
+			 Options == Hdr->Options &&
+			 Hdr->Levels > 0 && Hdr->Levels <= 32 &&
+			 Hdr->DataSize == GetLevelsSize( Hdr->Width, Hdr->Height, Hdr->Channels, Hdr->Levels ) &&
+			 (Uint64)Hdr->DataOffset + Hdr->DataSize <= File->GetSize() )
+		{
+			*Width		= Hdr->Width;
+			*Height		= Hdr->Height;
+			*Channels	= Hdr->Channels;
+			*Pixels		= File->GetData() + Hdr->DataOffset;
+			*Levels		= Hdr->Levels;
+
+			return File;
+		}
+	}
+
+	eeSAFE_DELETE( File );
+
+	return NULL;
+}
+
+bool cTextureCache::Store( const std::string& Source, const Uint32& SourceDate, const Uint32& Options, const Uint8 * Pixels, const Uint32& Width, const Uint32& Height, const Uint32& Channels, const std::vector<cImage*> * Mipmaps ) {
+	if ( !mEnabled || NULL == Pixels || 0 == Width || 0 == Height || 0 == Channels ) {
+		return false;
+	}
+
+	if ( !FileSystem::IsDirectory( mCachePath ) ) {
+		FileSystem::MakeDir( mCachePath );
+	}
+
+	std::string Path( GetEntryPath( Source, Options ) );
+
+	// Writes to a temporary file first, so a partially written entry is never mapped ( the same image could be loaded by another thread )
+	std::string TmpPath( Path + String::StrFormated( ".%u.tmp", cThread::GetCurrentThreadId() ) );
+
+	sCacheHdr Hdr;
+	char Header[ EE_TEXTURE_CACHE_DATA_OFFSET ];
+
+	Hdr.Magic		= EE_TEXTURE_CACHE_MAGIC;
+	Hdr.Version		= EE_TEXTURE_CACHE_VERSION;
+	Hdr.SourceHash	= String::Hash( Source );
+	Hdr.SourceDate	= SourceDate;
+	Hdr.Options		= Options;
+	Hdr.Width		= Width;
+	Hdr.Height		= Height;
+	Hdr.Channels	= Channels;
+	Hdr.DataOffset	= EE_TEXTURE_CACHE_DATA_OFFSET;
+	Hdr.Levels		= 1 + ( NULL != Mipmaps ? Mipmaps->size() : 0 );
+	Hdr.DataSize	= GetLevelsSize( Width, Height, Channels, Hdr.Levels );
+
+	// The header is padded, so the pixels are aligned in the mapping
+	memset( Header, 0, sizeof(Header) );
+	memcpy( Header, &Hdr, sizeof(sCacheHdr) );
+
+	{
+		cIOStreamFile fs( TmpPath, std::ios::out | std::ios::binary );
+
+		if ( !fs.IsOpen() ) {
+			return false;
+		}
+
+		fs.Write( Header, sizeof(Header) );
+		fs.Write( (const char*)Pixels, Width * Height * Channels );
+
+		for ( Uint32 i = 1; i < Hdr.Levels; i++ ) {
+			cImage * Level = (*Mipmaps)[ i - 1 ];
+
+			fs.Write( (const char*)Level->GetPixels(), Level->Width() * Level->Height() * Level->Channels() );
+		}
+	}
+
+	FileSystem::FileRemove( Path );
+
+	if ( 0 != rename( TmpPath.c_str(), Path.c_str() ) ) {
+		FileSystem::FileRemove( TmpPath );
+		return false;
+	}
+
+	return true;
+}
+
+}}
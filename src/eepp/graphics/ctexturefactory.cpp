@@ -2,6 +2,8 @@
 #include <eepp/graphics/ctextureloader.hpp>
 #include <eepp/graphics/renderer/cgl.hpp>
 #include <eepp/graphics/ctexture.hpp>
+#include <eepp/graphics/ccompressedimage.hpp>
+#include <eepp/graphics/cpngencoder.hpp>
 #include <eepp/helper/SOIL2/src/SOIL2/stb_image.h>
 #include <eepp/helper/SOIL2/src/SOIL2/SOIL2.h>
 #include <eepp/helper/jpeg-compressor/jpge.h>
@@ -18,7 +20,7 @@ cTextureFactory::cTextureFactory() :
 	mTextures.clear();
 	mTextures.push_back( NULL );
 
-	memset( &mCurrentTexture[0], 0, EE_MAX_TEXTURE_UNITS );
+	memset( &mCurrentTexture[0], 0, sizeof( mCurrentTexture ) );
 }
 
 cTextureFactory::~cTextureFactory() {
@@ -244,7 +246,11 @@ eeUint cTextureFactory::GetValidTextureSize( const eeUint& Size ) {
 bool cTextureFactory::SaveImage( const std::string& filepath, const EE_SAVE_TYPE& Format, const eeUint& Width, const eeUint& Height, const eeUint& Channels, const unsigned char* data ) {
 	bool Res;
 
-	if ( SAVE_TYPE_JPG != Format ) {
+	if ( SAVE_TYPE_KTX == Format ) {
+		Res = cCompressedImage::Save( filepath, data, Width, Height, Channels );
+	} else if ( SAVE_TYPE_PNG == Format ) {
+		Res = Private::cPngEncoder::Save( filepath, data, Width, Height, Channels, cImage::PngCompressionLevel() );
+	} else if ( SAVE_TYPE_JPG != Format ) {
 		Res = 0 != SOIL_save_image ( filepath.c_str(), Format, Width, Height, Channels, data );
 	} else {
 		jpge::params params;
@@ -1,6 +1,10 @@
 #include <eepp/graphics/ctextureloader.hpp>
 #include <eepp/graphics/ctexture.hpp>
 #include <eepp/graphics/ctexturefactory.hpp>
+#include <eepp/graphics/ccompressedimage.hpp>
+#include <eepp/graphics/ctexturecache.hpp>
+#include <eepp/graphics/cimage.hpp>
+#include <eepp/system/cmappedfile.hpp>
 #include <eepp/graphics/renderer/cgl.hpp>
 #include <eepp/system/ciostreamfile.hpp>
 #include <eepp/helper/SOIL2/src/SOIL2/stb_image.h>
@@ -15,6 +19,9 @@ using namespace EE::Window;
 #define TEX_LT_PIXELS	(4)
 #define TEX_LT_STREAM	(5)
 
+// The KTX containers are not recognized by stb_image, the image type is out of the STBI types range
+#define TEX_IMG_KTX		(0x4B5458)
+
 namespace EE { namespace Graphics {
 
 namespace IOCb
@@ -84,7 +91,13 @@ cTextureLoader::cTextureLoader( cIOStream& Stream,
 	mTexLoaded(false),
 	mDirectUpload(false),
 	mImgType(STBI_unknown),
-	mIsCompressed(0)
+	mIsCompressed(0),
+	mColorKeyApplied(false),
+	mCacheFile(NULL),
+	mCpuMipmaps(false),
+	mMipmapFilter(RESAMPLER_BOX),
+	mPremultiplyAlpha(false),
+	mAlphaPremultiplied(false)
 {
 }
 
@@ -115,7 +128,13 @@ cTextureLoader::cTextureLoader( const std::string& Filepath,
 	mTexLoaded(false),
 	mDirectUpload(false),
 	mImgType(STBI_unknown),
-	mIsCompressed(0)
+	mIsCompressed(0),
+	mColorKeyApplied(false),
+	mCacheFile(NULL),
+	mCpuMipmaps(false),
+	mMipmapFilter(RESAMPLER_BOX),
+	mPremultiplyAlpha(false),
+	mAlphaPremultiplied(false)
 {
 }
 
@@ -147,7 +166,13 @@ cTextureLoader::cTextureLoader( const unsigned char * ImagePtr,
 	mTexLoaded(false),
 	mDirectUpload(false),
 	mImgType(STBI_unknown),
-	mIsCompressed(0)
+	mIsCompressed(0),
+	mColorKeyApplied(false),
+	mCacheFile(NULL),
+	mCpuMipmaps(false),
+	mMipmapFilter(RESAMPLER_BOX),
+	mPremultiplyAlpha(false),
+	mAlphaPremultiplied(false)
 {
 }
 
@@ -179,7 +204,13 @@ cTextureLoader::cTextureLoader( cPack * Pack,
 	mTexLoaded(false),
 	mDirectUpload(false),
 	mImgType(STBI_unknown),
-	mIsCompressed(0)
+	mIsCompressed(0),
+	mColorKeyApplied(false),
+	mCacheFile(NULL),
+	mCpuMipmaps(false),
+	mMipmapFilter(RESAMPLER_BOX),
+	mPremultiplyAlpha(false),
+	mAlphaPremultiplied(false)
 {
 }
 
@@ -214,13 +245,27 @@ cTextureLoader::cTextureLoader( const unsigned char * Pixels,
 	mTexLoaded(false),
 	mDirectUpload(false),
 	mImgType(STBI_unknown),
-	mIsCompressed(0)
+	mIsCompressed(0),
+	mColorKeyApplied(false),
+	mCacheFile(NULL),
+	mCpuMipmaps(false),
+	mMipmapFilter(RESAMPLER_BOX),
+	mPremultiplyAlpha(false),
+	mAlphaPremultiplied(false)
 {
 }
 
 cTextureLoader::~cTextureLoader() {
 	eeSAFE_DELETE( mColorKey );
 
+	ReleaseMipmaps();
+
+	if ( NULL != mCacheFile ) {
+		// The pixels belong to the mapped cache file
+		mPixels = NULL;
+		eeSAFE_DELETE( mCacheFile );
+	}
+
 	if ( TEX_LT_PIXELS != mLoadType )
 		eeSAFE_FREE( mPixels );
 }
@@ -230,14 +275,26 @@ void cTextureLoader::Start() {
 
 	mTE.Restart();
 
-	if ( TEX_LT_PATH == mLoadType )
-		LoadFromPath();
-	else if ( TEX_LT_MEM == mLoadType )
-		LoadFromMemory();
-	else if ( TEX_LT_PACK == mLoadType )
-		LoadFromPack();
-	else if ( TEX_LT_STREAM == mLoadType )
-		LoadFromStream();
+	if ( !LoadFromCache() ) {
+		if ( TEX_LT_PATH == mLoadType )
+			LoadFromPath();
+		else if ( TEX_LT_MEM == mLoadType )
+			LoadFromMemory();
+		else if ( TEX_LT_PACK == mLoadType )
+			LoadFromPack();
+		else if ( TEX_LT_STREAM == mLoadType )
+			LoadFromStream();
+
+		// The color key is applied in the loader thread, so the cache keeps the final pixels
+		ApplyColorKey();
+
+		// The mipmaps are generated from the premultiplied pixels
+		ApplyPremultiplyAlpha();
+
+		GenerateMipmaps();
+
+		StoreInCache();
+	}
 
 	mTexLoaded = true;
 
@@ -246,6 +303,183 @@ void cTextureLoader::Start() {
 	}
 }
 
+bool cTextureLoader::GetCacheSource( std::string& Source, Uint32& SourceDate ) {
+	if ( !cTextureCache::ExistsSingleton() || !cTextureCache::instance()->Enabled() ) {
+		return false;
+	}
+
+	cPack * Pack = NULL;
+
+	if ( TEX_LT_PATH == mLoadType ) {
+		if ( FileSystem::FileExists( mFilepath ) ) {
+			Source		= mFilepath;
+			SourceDate	= FileSystem::FileGetModificationDate( mFilepath );
+			return true;
+		}
+
+		if ( cPackManager::instance()->FallbackToPacks() ) {
+			std::string Path( mFilepath );
+			Pack = cPackManager::instance()->Exists( Path );
+		}
+	} else if ( TEX_LT_PACK == mLoadType ) {
+		Pack = mPack;
+	}
+
+	// The files inside a pack are outdated when the pack is modified
+	if ( NULL != Pack ) {
+		Source		= Pack->GetPackPath() + ":" + mFilepath;
+		SourceDate	= FileSystem::FileGetModificationDate( Pack->GetPackPath() );
+		return true;
+	}
+
+	return false;
+}
+
+Uint32 cTextureLoader::GetCacheOptions() {
+	Uint32 Options = NULL != mColorKey ? ( 0x1000000 | ( mColorKey->R() << 16 ) | ( mColorKey->G() << 8 ) | mColorKey->B() ) : 0;
+
+	if ( mMipmap && mCpuMipmaps ) {
+		Options |= 0x2000000 | ( ( (Uint32)mMipmapFilter & 0x1F ) << 26 );
+	}
+
+	if ( mPremultiplyAlpha ) {
+		Options |= 0x80000000;
+	}
+
+	return Options;
+}
+
+bool cTextureLoader::LoadFromCache() {
+	std::string Source;
+	Uint32 SourceDate;
+
+	if ( !GetCacheSource( Source, SourceDate ) ) {
+		return false;
+	}
+
+	const Uint8 * Pixels = NULL;
+	Uint32 Levels = 0;
+
+	mCacheFile = cTextureCache::instance()->Open( Source, SourceDate, GetCacheOptions(), &mImgWidth, &mImgHeight, &mChannels, &Pixels, &Levels );
+
+	if ( NULL == mCacheFile ) {
+		return false;
+	}
+
+	// The mapped pixels are only read, the uploader copies them
+	mPixels				= const_cast<Uint8*>( Pixels );
+	mImgType			= STBI_unknown;
+	mColorKeyApplied	= true;
+	mAlphaPremultiplied	= mPremultiplyAlpha && ( 2 == mChannels || 4 == mChannels );
+
+	Uint8 * Level = mPixels + mImgWidth * mImgHeight * mChannels;
+
+	for ( Uint32 i = 1; i < Levels; i++ ) {
+		Uint32 Width	= eemax( (Uint32)mImgWidth >> i, (Uint32)1 );
+		Uint32 Height	= eemax( (Uint32)mImgHeight >> i, (Uint32)1 );
+		cImage * Img	= eeNew( cImage, ( Level, Width, Height, mChannels ) );
+
+		Img->AvoidFreeImage( true );
+
+		mMipmaps.push_back( Img );
+
+		Level += Width * Height * mChannels;
+	}
+
+	return true;
+}
+
+void cTextureLoader::StoreInCache() {
+	std::string Source;
+	Uint32 SourceDate;
+
+	// The compressed textures are already uploaded directly
+	if ( NULL == mPixels || mDirectUpload || !GetCacheSource( Source, SourceDate ) ) {
+		return;
+	}
+
+	cTextureCache::instance()->Store( Source, SourceDate, GetCacheOptions(), mPixels, mImgWidth, mImgHeight, mChannels, &mMipmaps );
+}
+
+void cTextureLoader::SetMipmapFilter( const EE_RESAMPLER_FILTER& filter ) {
+	mCpuMipmaps		= true;
+	mMipmapFilter	= filter;
+}
+
+void cTextureLoader::GenerateMipmaps() {
+	// The CPU mipmaps are only uploaded for RGB and RGBA textures that are uploaded without changes ( not resized to power of two nor compressed )
+	if ( !mMipmap || !mCpuMipmaps || NULL == mPixels || mDirectUpload || mCompressTexture || mChannels < 3 ||
+		 ( !GLi->IsExtension( EEGL_ARB_texture_non_power_of_two ) && ( !Math::IsPow2( mImgWidth ) || !Math::IsPow2( mImgHeight ) ) ) )
+	{
+		return;
+	}
+
+	cImage Img( mPixels, mImgWidth, mImgHeight, mChannels );
+
+	Img.AvoidFreeImage( true );
+
+	mMipmaps = Img.CreateMipmaps( mMipmapFilter );
+}
+
+void cTextureLoader::UploadMipmaps() {
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+
+	for ( Uint32 i = 0; i < mMipmaps.size(); i++ ) {
+		cImage * Level = mMipmaps[i];
+		GLenum Format = 4 == Level->Channels() ? GL_RGBA : GL_RGB;
+
+		glTexImage2D( GL_TEXTURE_2D, i + 1, Format, Level->Width(), Level->Height(), 0, Format, GL_UNSIGNED_BYTE, Level->GetPixels() );
+	}
+
+	glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+
+	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
+}
+
+void cTextureLoader::ReleaseMipmaps() {
+	for ( Uint32 i = 0; i < mMipmaps.size(); i++ ) {
+		eeSAFE_DELETE( mMipmaps[i] );
+	}
+
+	mMipmaps.clear();
+}
+
+void cTextureLoader::ApplyColorKey() {
+	if ( NULL == mColorKey || NULL == mPixels || mDirectUpload || mColorKeyApplied ) {
+		return;
+	}
+
+	mChannels = STBI_rgb_alpha;
+
+	cImage * tImg = eeNew ( cImage, ( mPixels, mImgWidth, mImgHeight, mChannels ) );
+
+	tImg->CreateMaskFromColor( eeColorA( mColorKey->R(), mColorKey->G(), mColorKey->B(), 255 ), 0 );
+
+	tImg->AvoidFreeImage( true  );
+
+	eeSAFE_DELETE( tImg );
+
+	mColorKeyApplied = true;
+}
+
+void cTextureLoader::SetPremultiplyAlpha( const bool& premultiply ) {
+	mPremultiplyAlpha = premultiply;
+}
+
+void cTextureLoader::ApplyPremultiplyAlpha() {
+	if ( !mPremultiplyAlpha || NULL == mPixels || mDirectUpload || mAlphaPremultiplied || ( 2 != mChannels && 4 != mChannels ) ) {
+		return;
+	}
+
+	cImage tImg( mPixels, mImgWidth, mImgHeight, mChannels );
+
+	tImg.AvoidFreeImage( true );
+
+	tImg.PremultiplyAlpha();
+
+	mAlphaPremultiplied = true;
+}
+
 void cTextureLoader::LoadFile() {
 	cIOStreamFile fs( mFilepath , std::ios::in | std::ios::binary );
 
@@ -258,7 +492,10 @@ void cTextureLoader::LoadFromPath() {
 	if ( FileSystem::FileExists( mFilepath ) ) {
 		mImgType = stbi_test( mFilepath.c_str() );
 
-		if ( STBI_dds == mImgType && GLi->IsExtension( EEGL_EXT_texture_compression_s3tc ) ) {
+		if ( cCompressedImage::IsCompressedImage( mFilepath ) ) {
+			LoadFile();
+			LoadCompressedImage();
+		} else if ( STBI_dds == mImgType && GLi->IsExtension( EEGL_EXT_texture_compression_s3tc ) ) {
 			LoadFile();
 			mDirectUpload = true;
 			stbi_dds_info_from_memory( mPixels, mSize, &mImgWidth, &mImgHeight, &mChannels, &mIsCompressed );
@@ -318,7 +555,11 @@ void cTextureLoader::LoadFromPack() {
 void cTextureLoader::LoadFromMemory() {
 	mImgType = stbi_test_from_memory( mImagePtr, mSize );
 
-	if ( STBI_dds == mImgType && GLi->IsExtension( EEGL_EXT_texture_compression_s3tc ) ) {
+	if ( cCompressedImage::IsCompressedImage( mImagePtr, mSize ) ) {
+		mPixels = (Uint8*) eeMalloc( mSize );
+		memcpy( mPixels, mImagePtr, mSize );
+		LoadCompressedImage();
+	} else if ( STBI_dds == mImgType && GLi->IsExtension( EEGL_EXT_texture_compression_s3tc ) ) {
 		mPixels = (Uint8*) eeMalloc( mSize );
 		memcpy( mPixels, mImagePtr, mSize );
 		stbi_dds_info_from_memory( mPixels, mSize, &mImgWidth, &mImgHeight, &mChannels, &mIsCompressed );
@@ -363,7 +604,23 @@ void cTextureLoader::LoadFromStream() {
 
 		mImgType = stbi_test_from_callbacks( &callbacks, mStream );
 
-		if ( STBI_dds == mImgType && GLi->IsExtension( EEGL_EXT_texture_compression_s3tc ) ) {
+		Uint8 Identifier[ 64 ];
+		bool IsKTX = false;
+
+		mStream->Seek( 0 );
+
+		if ( mSize >= sizeof(Identifier) ) {
+			mStream->Read( (char*)Identifier, sizeof(Identifier) );
+			IsKTX = cCompressedImage::IsCompressedImage( Identifier, sizeof(Identifier) );
+			mStream->Seek( 0 );
+		}
+
+		if ( IsKTX ) {
+			mPixels	= (Uint8*) eeMalloc( mSize );
+			mStream->Read( reinterpret_cast<char*> ( mPixels ), mSize );
+			mStream->Seek( 0 );
+			LoadCompressedImage();
+		} else if ( STBI_dds == mImgType && GLi->IsExtension( EEGL_EXT_texture_compression_s3tc ) ) {
 			mSize	= mStream->GetSize();
 			mPixels	= (Uint8*) eeMalloc( mSize );
 			mStream->Seek( 0 );
@@ -410,6 +667,39 @@ void cTextureLoader::LoadFromStream() {
 	}
 }
 
+void cTextureLoader::LoadCompressedImage() {
+	cCompressedImage Img;
+
+	if ( !Img.LoadFromMemory( mPixels, mSize ) ) {
+		eeFree( mPixels );
+		mPixels = NULL;
+		return;
+	}
+
+	mImgType	= TEX_IMG_KTX;
+	mImgWidth	= Img.Width();
+	mImgHeight	= Img.Height();
+	mChannels	= Img.Channels();
+
+	if ( Img.IsSupported() ) {
+		// The container is kept as is, the blocks are uploaded directly
+		mIsCompressed = mDirectUpload = true;
+		return;
+	}
+
+	// Software fallback, the blocks are decompressed to RGBA
+	Uint8 * Pixels = Img.Decompress();
+
+	eeFree( mPixels );
+
+	mPixels		= Pixels;
+	mChannels	= STBI_rgb_alpha;
+
+	if ( NULL == mPixels ) {
+		eePRINTL( "The compressed texture format 0x%x is not supported by the GPU and can't be decompressed.", Img.InternalFormat() );
+	}
+}
+
 void cTextureLoader::LoadFromPixels() {
 	if ( !mLoaded && mTexLoaded ) {
 		Uint32 tTexId = 0;
@@ -424,11 +714,11 @@ void cTextureLoader::LoadFromPixels() {
 			flags = ( mCompressTexture ) ? ( flags | SOIL_FLAG_COMPRESS_TO_DXT ) : flags;
 
 			bool ForceGLThreaded = cThread::GetCurrentThreadId() != cEngine::instance()->GetMainThreadId();
+			bool GLThreaded = ( mThreaded || ForceGLThreaded ) &&
+							  ( ForceGLThreaded || cEngine::instance()->IsSharedGLContextEnabled() ) &&
+							  cEngine::instance()->GetCurrentWindow()->IsThreadedGLContext();
 
-			if ( ( mThreaded || ForceGLThreaded ) &&
-				 ( ForceGLThreaded || cEngine::instance()->IsSharedGLContextEnabled() ) &&
-				 cEngine::instance()->GetCurrentWindow()->IsThreadedGLContext() )
-			{
+			if ( GLThreaded ) {
 				cEngine::instance()->GetCurrentWindow()->SetGLContextThread();
 			}
 
@@ -442,37 +732,58 @@ void cTextureLoader::LoadFromPixels() {
 					tTexId = SOIL_direct_load_PVR_from_memory( mPixels, mSize, SOIL_CREATE_NEW_ID, flags, 0 );
 				} else if ( STBI_pkm == mImgType ) {
 					tTexId = SOIL_direct_load_ETC1_from_memory( mPixels, mSize, SOIL_CREATE_NEW_ID, flags );
+				} else if ( TEX_IMG_KTX == mImgType ) {
+					cCompressedImage Img;
+
+					if ( Img.LoadFromMemory( mPixels, mSize ) ) {
+						// The mipmaps of the compressed textures can't be generated, only the levels in the container are used
+						mMipmap	= mMipmap && Img.CanMipmap();
+						tTexId	= Img.Upload( mMipmap, mClampMode );
+						mSize	= Img.DataSize();
+					}
 				}
 			} else {
-				if ( NULL != mColorKey ) {
-					mChannels = STBI_rgb_alpha;
-
-					cImage * tImg = eeNew ( cImage, ( mPixels, mImgWidth, mImgHeight, mChannels ) );
+				ApplyColorKey();
 
-					tImg->CreateMaskFromColor( eeColorA( mColorKey->R(), mColorKey->G(), mColorKey->B(), 255 ), 0 );
+				ApplyPremultiplyAlpha();
 
-					tImg->AvoidFreeImage( true  );
-
-					eeSAFE_DELETE( tImg );
+				// The mip chain generated in the loader thread replaces the driver mipmaps
+				if ( mMipmaps.size() ) {
+					flags &= ~( SOIL_FLAG_MIPMAPS | SOIL_FLAG_GL_MIPMAPS );
 				}
 
 				tTexId = SOIL_create_OGL_texture( mPixels, &width, &height, mChannels, SOIL_CREATE_NEW_ID, flags );
+
+				if ( tTexId && mMipmaps.size() ) {
+					glBindTexture( GL_TEXTURE_2D, tTexId );
+
+					UploadMipmaps();
+				}
 			}
 
-			GLi->BindTexture( GL_TEXTURE_2D, PreviousTexture );
+			if ( ForceGLThreaded || GLThreaded ) {
+				// The state shadowed by cGL belongs to the main thread context, it can't be touched from here
+				glBindTexture( GL_TEXTURE_2D, PreviousTexture );
+
+				if ( GLThreaded ) {
+					cEngine::instance()->GetCurrentWindow()->UnsetGLContextThread();
+				}
+
+				GLi->InvalidateStateCacheDeferred();
+			} else {
+				// SOIL binds the new texture without cGL knowing it
+				GLi->InvalidateStateCache();
 
-			if ( ( mThreaded || ForceGLThreaded ) &&
-				 ( ForceGLThreaded || cEngine::instance()->IsSharedGLContextEnabled() ) &&
-				 cEngine::instance()->GetCurrentWindow()->IsThreadedGLContext() )
-			{
-				cEngine::instance()->GetCurrentWindow()->UnsetGLContextThread();
+				GLi->BindTexture( GL_TEXTURE_2D, PreviousTexture );
 			}
 
 			if ( tTexId ) {
 				mWidth	= width;
 				mHeight	= height;
 
-				if ( ( ( STBI_dds == mImgType && mIsCompressed ) || mCompressTexture ) && mSize > 128 ) {
+				if ( TEX_IMG_KTX == mImgType && mDirectUpload ) {
+					// The size of the blocks was already set on upload
+				} else if ( ( ( STBI_dds == mImgType && mIsCompressed ) || mCompressTexture ) && mSize > 128 ) {
 					mSize -= 128;	// Remove the DDS header size
 				} else if ( STBI_pvr == mImgType && mIsCompressed && mSize > 52 ) {
 					mSize -= 52;	// Remove the PVR header size
@@ -495,12 +806,21 @@ void cTextureLoader::LoadFromPixels() {
 
 				mTexId = cTextureFactory::instance()->PushTexture( mFilepath, tTexId, width, height, mImgWidth, mImgHeight, mMipmap, mChannels, mClampMode, mCompressTexture || mIsCompressed, mLocalCopy, mSize );
 
+				if ( mAlphaPremultiplied ) {
+					cTextureFactory::instance()->GetTexture( mTexId )->Premultiplied( true );
+				}
+
 				eePRINTL( "Texture %s loaded in %4.3f ms.", mFilepath.c_str(), mTE.Elapsed().AsMilliseconds() );
 			} else {
 				eePRINTL( "Failed to create texture. Reason: %s", SOIL_last_result() );
 			}
 
-			if ( TEX_LT_PIXELS != mLoadType ) {
+			// The mapped mipmaps must be released before the cache file
+			ReleaseMipmaps();
+
+			if ( NULL != mCacheFile ) {
+				eeSAFE_DELETE( mCacheFile );
+			} else if ( TEX_LT_PIXELS != mLoadType ) {
 				if ( mDirectUpload ) {
 					eeFree( mPixels );
 				} else if ( NULL != mPixels ) {
@@ -531,6 +851,11 @@ void cTextureLoader::Update() {
 	}
 }
 
+bool cTextureLoader::IsWaitingUpdate() {
+	// With a shared GL context the texture is uploaded by the loader thread
+	return mTexLoaded && !mLoaded && !( cEngine::instance()->IsSharedGLContextEnabled() && cEngine::instance()->GetCurrentWindow()->IsThreadedGLContext() );
+}
+
 const Uint32& cTextureLoader::Id() const {
 	return mTexId;
 }
@@ -574,6 +899,10 @@ void cTextureLoader::Reset() {
 	mDirectUpload		= false;
 	mImgType			= STBI_unknown;
 	mIsCompressed		= 0;
+	mColorKeyApplied	= false;
+	mAlphaPremultiplied	= false;
+
+	ReleaseMipmaps();
 }
 
 }}
@@ -3,12 +3,56 @@
 #include <eepp/system/ciostreamfile.hpp>
 #include <eepp/graphics/ctexturepackernode.hpp>
 #include <eepp/graphics/ctexturepackertex.hpp>
+#include <eepp/graphics/pixelhelper.hpp>
 #include <eepp/helper/SOIL2/src/SOIL2/stb_image.h>
+#include <eepp/system/cthread.hpp>
+#include <eepp/system/cmutex.hpp>
+#include <eepp/system/clock.hpp>
 #include <algorithm>
+#include <map>
 
 namespace EE { namespace Graphics {
 
-cTexturePacker::cTexturePacker( const Uint32& MaxWidth, const Uint32& MaxHeight, const bool& ForcePowOfTwo, const Uint32& PixelBorder, const bool& AllowFlipping ) :
+namespace Private {
+
+/** Saves the pages of a texture atlas, every thread takes the next page not saved. */
+class cTexturePackerSaveJob {
+	public:
+		cTexturePackerSaveJob( const std::vector<cTexturePacker*>& pages ) :
+			Pages( pages ),
+			Next( 0 )
+		{
+		}
+
+		void Run() {
+			while ( true ) {
+				cTexturePacker * Page = NULL;
+
+				{
+					cLock l( Mutex );
+
+					if ( Next < Pages.size() ) {
+						Page = Pages[ Next ];
+						Next++;
+					}
+				}
+
+				if ( NULL == Page ) {
+					break;
+				}
+
+				Page->SavePage();
+			}
+		}
+
+		std::vector<cTexturePacker*>	Pages;
+		Uint32							Next;
+		cMutex							Mutex;
+};
+
+}
+
+cTexturePacker::cTexturePacker( const Uint32& MaxWidth, const Uint32& MaxHeight, const bool& ForcePowOfTwo, const Uint32& PixelBorder, const bool& AllowFlipping, const PackMethod& Method ) :
 	mLongestEdge(0),
 	mTotalArea(0),
 	mFreeList(NULL),
@@ -22,9 +66,16 @@ cTexturePacker::cTexturePacker( const Uint32& MaxWidth, const Uint32& MaxHeight,
 	mParent(NULL),
 	mPlacedCount(0),
 	mForcePowOfTwo(true),
-	mPixelBorder(0)
+	mPixelBorder(0),
+	mSaveExtensions(false),
+	mFormat(SAVE_TYPE_PNG),
+	mMethod(PackFreeList),
+	mUsedArea(0),
+	mIncremental(false),
+	mDirty(false),
+	mPremultiplied(false)
 {
-	SetOptions( MaxWidth, MaxHeight, ForcePowOfTwo, PixelBorder, AllowFlipping );
+	SetOptions( MaxWidth, MaxHeight, ForcePowOfTwo, PixelBorder, AllowFlipping, Method );
 }
 
 cTexturePacker::cTexturePacker() :
@@ -41,7 +92,14 @@ cTexturePacker::cTexturePacker() :
 	mParent(NULL),
 	mPlacedCount(0),
 	mForcePowOfTwo(true),
-	mPixelBorder(0)
+	mPixelBorder(0),
+	mSaveExtensions(false),
+	mFormat(SAVE_TYPE_PNG),
+	mMethod(PackFreeList),
+	mUsedArea(0),
+	mIncremental(false),
+	mDirty(false),
+	mPremultiplied(false)
 {
 }
 
@@ -53,6 +111,7 @@ cTexturePacker::~cTexturePacker()
 void cTexturePacker::Close() {
 	mLongestEdge 	= 0;
 	mTotalArea 		= 0;
+	mUsedArea		= 0;
 
 	std::list<cTexturePackerTex*>::iterator it;
 
@@ -62,23 +121,14 @@ void cTexturePacker::Close() {
 
 	mTextures.clear();
 
-	if ( NULL != mFreeList ) {
-		cTexturePackerNode * next = mFreeList;
-		cTexturePackerNode * kill = NULL;
-
-		while ( NULL != next ) {
-			kill = next;
-
-			next = next->GetNext();
+	TexturePackerReleaseFreeList( &mFreeList );
 
-			eeSAFE_DELETE( kill );
-		}
-	}
+	mFreeRects.clear();
 
 	eeSAFE_DELETE( mChild );
 }
 
-void cTexturePacker::SetOptions( const Uint32& MaxWidth, const Uint32& MaxHeight, const bool& ForcePowOfTwo, const Uint32& PixelBorder, const bool& AllowFlipping ) {
+void cTexturePacker::SetOptions( const Uint32& MaxWidth, const Uint32& MaxHeight, const bool& ForcePowOfTwo, const Uint32& PixelBorder, const bool& AllowFlipping, const PackMethod& Method ) {
 	if ( !mTextures.size() ) { // only can change the dimensions before adding any texture
 		mWidth 	= MaxWidth;
 		mHeight = MaxHeight;
@@ -92,45 +142,12 @@ void cTexturePacker::SetOptions( const Uint32& MaxWidth, const Uint32& MaxHeight
 		mForcePowOfTwo 	= ForcePowOfTwo;
 		mAllowFlipping 	= AllowFlipping;
 		mPixelBorder	= PixelBorder;
+		mMethod			= Method;
 	}
 }
 
 void cTexturePacker::NewFree( Int32 x, Int32 y, Int32 width, Int32 height ) {
-	cTexturePackerNode * node = eeNew( cTexturePackerNode, ( x, y, width, height ) );
-	node->SetNext( mFreeList );
-	mFreeList = node;
-}
-
-bool cTexturePacker::MergeNodes() {
-	cTexturePackerNode *f = mFreeList;
-
-	while ( f ) {
-		cTexturePackerNode * prev 	= NULL;
-		cTexturePackerNode * c 		= mFreeList;
-
-		while ( c ) {
-			if ( f != c ) {
-				if ( f->Merge( *c ) ) {
-					eeASSERT( prev );
-
-					if ( NULL != prev ) {
-						prev->SetNext( c->GetNext() );
-					}
-
-					eeSAFE_DELETE( c );
-
-					return true;
-				}
-			}
-
-			prev 	= c;
-			c 		= c->GetNext();
-		}
-
-		f = f->GetNext();
-	}
-
-	return false;
+	TexturePackerNewFree( &mFreeList, x, y, width, height );
 }
 
 void cTexturePacker::Validate() {
@@ -196,55 +213,6 @@ void cTexturePacker::AddBorderToTextures( const Int32& BorderSize ) {
 	}
 }
 
-cTexturePackerNode *	cTexturePacker::GetBestFit( cTexturePackerTex * t, cTexturePackerNode ** prevBestFit, Int32 * EdgeCount ) {
-	Int32 leastY 							= 0x7FFFFFFF;
-	Int32 leastX 							= 0x7FFFFFFF;
-	cTexturePackerNode * previousBestFit 	= NULL;
-	cTexturePackerNode * bestFit 			= NULL;
-	cTexturePackerNode * previous 			= NULL;
-	cTexturePackerNode * search 				= mFreeList;
-	Int32 edgeCount 						= 0;
-
-	// Walk the singly linked list of free nodes
-	// see if it will fit into any currently free space
-	while ( search ) {
-		Int32 ec;
-
-		// see if the texture will fit into this slot, and if so how many edges does it share.
-		if ( search->Fits( t->Width(), t->Height(), ec, mAllowFlipping ) ) {
-
-			if ( ec == 2 ) {
-				previousBestFit 	= previous; // record the pointer previous to this one (used to patch the linked list)
-				bestFit 			= search; 	// record the best fit.
-				edgeCount 			= ec;
-
-				break;
-			}
-
-			if ( search->Y() < leastY ) {
-				leastY 				= search->Y();
-				leastX 				= search->X();
-				previousBestFit 	= previous;
-				bestFit 			= search;
-				edgeCount 			= ec;
-			} else if ( search->Y() == leastY && search->X() < leastX ) {
-				leastX 				= search->X();
-				previousBestFit 	= previous;
-				bestFit 			= search;
-				edgeCount 			= ec;
-			}
-		}
-
-		previous 	= search;
-		search 		= search->GetNext();
-	}
-
-	*EdgeCount 		= edgeCount;
-	*prevBestFit	= previousBestFit;
-
-	return bestFit;
-}
-
 void cTexturePacker::InsertTexture( cTexturePackerTex * t, cTexturePackerNode * bestFit, Int32 edgeCount, cTexturePackerNode * previousBestFit ) {
 	if ( NULL != bestFit ) {
 		Validate();
@@ -324,24 +292,21 @@ void cTexturePacker::InsertTexture( cTexturePackerTex * t, cTexturePackerNode *
 
 				t->Place( bestFit->X(), bestFit->Y(), flipped );
 
-				if ( previousBestFit )
-					previousBestFit->SetNext( bestFit->GetNext() );
-				else
-					mFreeList = bestFit->GetNext();
-
-				eeSAFE_DELETE( bestFit );
+				TexturePackerRemoveNode( &mFreeList, previousBestFit, bestFit );
 
 				Validate();
 			}
 			break;
 		}
 
-		while ( MergeNodes() ); // keep merging nodes as much as we can...
+		while ( TexturePackerMergeNodes( &mFreeList ) ); // keep merging nodes as much as we can...
 	}
 }
 
 void cTexturePacker::CreateChild() {
-	mChild = eeNew( cTexturePacker, ( mWidth, mHeight, mForcePowOfTwo, mPixelBorder, mAllowFlipping ) );
+	mChild = eeNew( cTexturePacker, ( mWidth, mHeight, mForcePowOfTwo, mPixelBorder, mAllowFlipping, mMethod ) );
+	mChild->mParent = this;
+	mChild->mPremultiplied = mPremultiplied;
 
 	std::list<cTexturePackerTex*>::iterator it;
 	std::list< std::list<cTexturePackerTex*>::iterator > remove;
@@ -352,10 +317,15 @@ void cTexturePacker::CreateChild() {
 		t = (*it);
 
 		if ( !t->Placed() ) {
-			mChild->AddTexture( t->Name() );
-			mChild->mParent = this;
+			// The texture is moved to the child ( without the border added for the packing ), so the images added from memory are kept
+			t->Width	( t->Width() 	- mPixelBorder );
+			t->Height	( t->Height() 	- mPixelBorder );
 
-			t->Disabled( true );
+			mTotalArea -= t->Area();
+
+			if ( !mChild->AddPackerTex( t ) ) {
+				eeSAFE_DELETE( t );
+			}
 
 			remove.push_back( it );
 
@@ -417,9 +387,9 @@ bool cTexturePacker::AddPackerTex( cTexturePackerTex * TPack ) {
 
 			if ( !Added ) {
 				mTextures.push_back( TPack );
-
-				return true;
 			}
+
+			return true;
 		}
 	}
 
@@ -448,44 +418,49 @@ Int32 cTexturePacker::PackTextures() { // pack the textures, the return code is
 
 	AddBorderToTextures( (Int32)mPixelBorder );
 
-	NewFree( 0, 0, mWidth, mHeight );
-
 	mCount = (Int32)mTextures.size();
 
-	// We must place each texture
 	std::list<cTexturePackerTex*>::iterator it;
-	for ( it = mTextures.begin(); it != mTextures.end(); it++ ) {
-		// For the texture with the longest edge we place it according to this criteria.
-		//   (1) If it is a perfect match, we always accept it as it causes the least amount of fragmentation.
-		//   (2) A match of one edge with the minimum area left over after the split.
-		//   (3) No edges match, so look for the node which leaves the least amount of area left over after the split.
-
-		if ( PackBig == mStrategy )
-			t 									= GetLonguestEdge();
-		else if ( PackTiny == mStrategy )
-			t 									= GetShortestEdge();
-
-		cTexturePackerNode * previousBestFit = NULL;
-		Int32 edgeCount 					= 0;
-		cTexturePackerNode * bestFit 		= GetBestFit( t, &previousBestFit, &edgeCount );
-
-		if ( NULL == bestFit ) {
-			if ( PackBig == mStrategy ) {
-				mStrategy = PackTiny;
-				eePRINTL( "Chaging Strategy to Tiny. %s faults.", t->Name().c_str() );
-			} else if ( PackTiny == mStrategy ) {
-				mStrategy = PackFail;
-				eePRINTL( "Strategy fail, must create a new image. %s faults.", t->Name().c_str() );
+
+	if ( PackFreeList != mMethod ) {
+		PackMaxRects();
+	} else {
+		NewFree( 0, 0, mWidth, mHeight );
+
+		// We must place each texture
+		for ( it = mTextures.begin(); it != mTextures.end(); it++ ) {
+			// For the texture with the longest edge we place it according to this criteria.
+			//   (1) If it is a perfect match, we always accept it as it causes the least amount of fragmentation.
+			//   (2) A match of one edge with the minimum area left over after the split.
+			//   (3) No edges match, so look for the node which leaves the least amount of area left over after the split.
+
+			if ( PackBig == mStrategy )
+				t 									= GetLonguestEdge();
+			else if ( PackTiny == mStrategy )
+				t 									= GetShortestEdge();
+
+			cTexturePackerNode * previousBestFit = NULL;
+			Int32 edgeCount 					= 0;
+			cTexturePackerNode * bestFit 		= TexturePackerGetBestFit( mFreeList, t->Width(), t->Height(), mAllowFlipping, &previousBestFit, &edgeCount );
+
+			if ( NULL == bestFit ) {
+				if ( PackBig == mStrategy ) {
+					mStrategy = PackTiny;
+					eePRINTL( "Chaging Strategy to Tiny. %s faults.", t->Name().c_str() );
+				} else if ( PackTiny == mStrategy ) {
+					mStrategy = PackFail;
+					eePRINTL( "Strategy fail, must create a new image. %s faults.", t->Name().c_str() );
+				}
+			} else {
+				InsertTexture( t, bestFit, edgeCount, previousBestFit );
+				mCount--;
 			}
-		} else {
-			InsertTexture( t, bestFit, edgeCount, previousBestFit );
-			mCount--;
-		}
 
-		if ( PackFail == mStrategy ) {
-			eePRINTL( "Creating a new image as a child." );
-			CreateChild();
-			break;
+			if ( PackFail == mStrategy ) {
+				eePRINTL( "Creating a new image as a child." );
+				CreateChild();
+				break;
+			}
 		}
 	}
 
@@ -498,14 +473,165 @@ Int32 cTexturePacker::PackTextures() { // pack the textures, the return code is
 
 	mPacked = true;
 
+	CalcUsedArea();
+
+	eePRINTL( "Total Area Used: %d. This represents the %4.3f percent", mUsedArea, GetPageOccupancy( 0 ) * 100.0 );
+
+	return ( mWidth * mHeight ) - mUsedArea;
+}
+
+void cTexturePacker::CalcUsedArea() {
+	mUsedArea = 0;
+
+	std::list<cTexturePackerTex*>::iterator it;
+
+	for ( it = mTextures.begin(); it != mTextures.end(); it++ ) {
+		if ( (*it)->Placed() )
+			mUsedArea += (*it)->Area();
+	}
+}
+
+void cTexturePacker::PackMaxRects() {
+	mFreeRects.clear();
+	mFreeRects.push_back( eeRecti( 0, 0, mWidth, mHeight ) );
+
+	// The textures are sorted by area, the biggest ones are placed first. The textures that don't fit are left for the next page.
+	std::list<cTexturePackerTex*>::iterator it;
+
 	for ( it = mTextures.begin(); it != mTextures.end(); it++ ) {
-		if ( !(*it)->Placed() )
-			mTotalArea -= (*it)->Area();
+		cTexturePackerTex * t = (*it);
+		eeRecti Pos;
+		bool Flipped = false;
+
+		if ( FindMaxRectsPosition( t, Pos, Flipped ) ) {
+			t->Place( Pos.Left, Pos.Top, Flipped );
+
+			PlaceMaxRect( Pos );
+
+			mCount--;
+		}
 	}
 
-	eePRINTL( "Total Area Used: %d. This represents the %4.3f percent", mTotalArea, ( (eeDouble)mTotalArea / (eeDouble)( mWidth * mHeight ) ) * 100.0 );
+	mFreeRects.clear();
+}
+
+bool cTexturePacker::FindMaxRectsPosition( cTexturePackerTex * t, eeRecti& Pos, bool& Flipped ) {
+	Int32 BestScore		= 0x7FFFFFFF;
+	Int32 BestScore2	= 0x7FFFFFFF;
+	bool Found			= false;
+
+	for ( Uint32 i = 0; i < mFreeRects.size(); i++ ) {
+		const eeRecti& Free = mFreeRects[i];
+		Int32 FreeWidth		= Free.Right - Free.Left;
+		Int32 FreeHeight	= Free.Bottom - Free.Top;
+
+		for ( Int32 f = 0; f < ( mAllowFlipping ? 2 : 1 ); f++ ) {
+			Int32 w = 0 == f ? t->Width() : t->Height();
+			Int32 h = 0 == f ? t->Height() : t->Width();
+
+			if ( w > FreeWidth || h > FreeHeight ) {
+				continue;
+			}
+
+			Int32 LeftoverX		= FreeWidth - w;
+			Int32 LeftoverY		= FreeHeight - h;
+			Int32 ShortSide		= eemin( LeftoverX, LeftoverY );
+			Int32 LongSide		= eemax( LeftoverX, LeftoverY );
+			Int32 Score;
+			Int32 Score2;
+
+			if ( PackMaxRectsBAF == mMethod ) {
+				Score	= FreeWidth * FreeHeight - w * h;
+				Score2	= ShortSide;
+			} else {
+				Score	= ShortSide;
+				Score2	= LongSide;
+			}
+
+			if ( Score < BestScore || ( Score == BestScore && Score2 < BestScore2 ) ) {
+				BestScore	= Score;
+				BestScore2	= Score2;
+				Pos			= eeRecti( Free.Left, Free.Top, Free.Left + w, Free.Top + h );
+				Flipped		= 0 != f;
+				Found		= true;
+			}
+		}
+	}
 
-	return ( mWidth * mHeight ) - mTotalArea;
+	return Found;
+}
+
+void cTexturePacker::PlaceMaxRect( const eeRecti& Used ) {
+	std::vector<eeRecti> NewRects;
+	Uint32 i;
+
+	// Split every free rectangle that overlaps the used one in the maximal rectangles around it
+	for ( i = 0; i < mFreeRects.size(); ) {
+		eeRecti Free = mFreeRects[i];
+
+		if ( Used.Left >= Free.Right || Used.Right <= Free.Left || Used.Top >= Free.Bottom || Used.Bottom <= Free.Top ) {
+			i++;
+			continue;
+		}
+
+		if ( Used.Left > Free.Left )
+			NewRects.push_back( eeRecti( Free.Left, Free.Top, Used.Left, Free.Bottom ) );
+
+		if ( Used.Right < Free.Right )
+			NewRects.push_back( eeRecti( Used.Right, Free.Top, Free.Right, Free.Bottom ) );
+
+		if ( Used.Top > Free.Top )
+			NewRects.push_back( eeRecti( Free.Left, Free.Top, Free.Right, Used.Top ) );
+
+		if ( Used.Bottom < Free.Bottom )
+			NewRects.push_back( eeRecti( Free.Left, Used.Bottom, Free.Right, Free.Bottom ) );
+
+		mFreeRects[i] = mFreeRects.back();
+		mFreeRects.pop_back();
+	}
+
+	// Only the new rectangles can be contained by others or contain the old ones, the old ones were already pruned
+	for ( i = 0; i < NewRects.size(); ) {
+		bool Contained = false;
+
+		for ( Uint32 j = 0; j < NewRects.size() && !Contained; j++ ) {
+			if ( i != j && NewRects[j].Contains( NewRects[i] ) && ( NewRects[i] != NewRects[j] || j < i ) ) {
+				Contained = true;
+			}
+		}
+
+		for ( Uint32 j = 0; j < mFreeRects.size() && !Contained; j++ ) {
+			if ( mFreeRects[j].Contains( NewRects[i] ) ) {
+				Contained = true;
+			}
+		}
+
+		if ( Contained ) {
+			NewRects[i] = NewRects.back();
+			NewRects.pop_back();
+		} else {
+			i++;
+		}
+	}
+
+	for ( i = 0; i < mFreeRects.size(); ) {
+		bool Contained = false;
+
+		for ( Uint32 j = 0; j < NewRects.size() && !Contained; j++ ) {
+			if ( NewRects[j].Contains( mFreeRects[i] ) ) {
+				Contained = true;
+			}
+		}
+
+		if ( Contained ) {
+			mFreeRects[i] = mFreeRects.back();
+			mFreeRects.pop_back();
+		} else {
+			i++;
+		}
+	}
+
+	mFreeRects.insert( mFreeRects.end(), NewRects.begin(), NewRects.end() );
 }
 
 void cTexturePacker::Save( const std::string& Filepath, const EE_SAVE_TYPE& Format, const bool& SaveExtensions ) {
@@ -515,67 +641,436 @@ void cTexturePacker::Save( const std::string& Filepath, const EE_SAVE_TYPE& Form
 	if ( !mTextures.size() )
 		return;
 
-	mFilepath = Filepath;
+	SavePages( Filepath, Format, SaveExtensions );
+}
+
+bool cTexturePacker::SaveIncremental( const std::string& Filepath, const EE_SAVE_TYPE& Format, const bool& SaveExtensions ) {
+	if ( mPacked || !mTextures.size() || !PackIncremental( Filepath, Format, SaveExtensions ) ) {
+		Save( Filepath, Format, SaveExtensions );
+
+		return false;
+	}
+
+	SavePages( Filepath, Format, SaveExtensions );
+
+	return true;
+}
+
+bool cTexturePacker::PackIncremental( const std::string& Filepath, const EE_SAVE_TYPE& Format, const bool& SaveExtensions ) {
+	std::string etapath( FileSystem::FileRemoveExtension( Filepath ) + EE_TEXTURE_ATLAS_EXTENSION );
+
+	if ( !FileSystem::FileExists( etapath ) )
+		return false;
+
+	cIOStreamFile fs( etapath, std::ios::in | std::ios::binary );
+
+	if ( !fs.IsOpen() )
+		return false;
+
+	Uint32 FileSize = FileSystem::FileSize( etapath );
+	Uint32 ReadSize = sizeof(sTextureAtlasHdr);
+	sTextureAtlasHdr TexGrHdr;
+
+	if ( FileSize < ReadSize )
+		return false;
+
+	fs.Read( reinterpret_cast<char*> (&TexGrHdr), sizeof(sTextureAtlasHdr) );
+
 	mSaveExtensions = SaveExtensions;
 
-	cImage Img( (Uint32)mWidth, (Uint32)mHeight, (Uint32)4 );
+	// The previous layout can only be reused if it was created with the same options
+	if ( EE_TEXTURE_ATLAS_MAGIC != TexGrHdr.Magic || (Uint32)Format != TexGrHdr.Format || mWidth != TexGrHdr.Width || mHeight != TexGrHdr.Height ||
+		 (Uint32)mPixelBorder != TexGrHdr.PixelBorder || GetAtlasFlags() != TexGrHdr.Flags || 0 == TexGrHdr.TextureCount )
+	{
+		return false;
+	}
 
-	Img.FillWithColor( eeColorA(0,0,0,0) );
+	std::vector< std::vector<sSubTextureHdr> > PrevSubTextures( TexGrHdr.TextureCount );
+	std::map<std::string, std::pair<Uint32, Uint32> > PrevIndex;
+	Uint32 i, p;
 
-	cTexturePackerTex * t = NULL;
-	int w, h, c;
-	std::list<cTexturePackerTex*>::iterator it;
+	for ( p = 0; p < TexGrHdr.TextureCount; p++ ) {
+		sTextureHdr TexHdr;
 
-	for ( it = mTextures.begin(); it != mTextures.end(); it++ ) {
-		t = (*it);
+		ReadSize += sizeof(sTextureHdr);
 
-		if ( t->Placed() ) {
-			Uint8 * data;
+		if ( FileSize < ReadSize )
+			return false;
 
-			if ( NULL == t->Image() ) {
-				data = stbi_load( t->Name().c_str(), &w, &h, &c, 0 );
+		fs.Read( reinterpret_cast<char*> (&TexHdr), sizeof(sTextureHdr) );
 
-				if ( NULL != data && t->Width() == w && t->Height() == h ) {
-					cImage * ImgCopy = eeNew( cImage, ( data, w, h, c ) );
+		if ( TexHdr.SubTextureCount < 0 )
+			return false;
 
-					if ( t->Flipped() )
-						ImgCopy->Flip();
+		ReadSize += sizeof(sSubTextureHdr) * TexHdr.SubTextureCount;
 
-					Img.CopyImage( ImgCopy, t->X(), t->Y() );
+		if ( FileSize < ReadSize )
+			return false;
 
-					ImgCopy->AvoidFreeImage( true );
+		if ( TexHdr.SubTextureCount > 0 ) {
+			PrevSubTextures[p].resize( TexHdr.SubTextureCount );
 
-					eeSAFE_DELETE( ImgCopy );
+			fs.Read( reinterpret_cast<char*> (&PrevSubTextures[p][0]), sizeof(sSubTextureHdr) * TexHdr.SubTextureCount );
+		}
 
-					if ( data )
-						free( data );
+		for ( i = 0; i < PrevSubTextures[p].size(); i++ ) {
+			PrevSubTextures[p][i].Name[ HDR_NAME_SIZE - 1 ] = '\0';
 
-					mPlacedCount++;
-				}
-			} else {
-				data = t->Image()->GetPixels();
+			PrevIndex[ std::string( PrevSubTextures[p][i].Name ) ] = std::make_pair( p, i );
+		}
+	}
+
+	// Creates the pages of the previous layout
+	std::vector<cTexturePacker*> Pages;
+	std::vector< std::vector<bool> > PrevUsed( TexGrHdr.TextureCount );
+
+	for ( p = 0; p < TexGrHdr.TextureCount; p++ ) {
+		cTexturePacker * Page = this;
+
+		if ( 0 != p ) {
+			Page = eeNew( cTexturePacker, ( mWidth, mHeight, mForcePowOfTwo, mPixelBorder, mAllowFlipping, mMethod ) );
+			Page->mParent = Pages.back();
+			Page->mPremultiplied = mPremultiplied;
+			Pages.back()->mChild = Page;
+		}
+
+		Page->mIncremental	= true;
+		Page->mDirty		= false;
+
+		Pages.push_back( Page );
 
-				if ( NULL != data ) {
-					if ( t->Flipped() )
-						t->Image()->Flip();
+		PrevUsed[p].resize( PrevSubTextures[p].size(), false );
+	}
 
-					Img.CopyImage( t->Image(), t->X(), t->Y() );
+	// The textures with the same name and size keep their place, the others are placed again
+	std::list<cTexturePackerTex*> Textures( mTextures );
+	std::list<cTexturePackerTex*> Pending;
+	std::list<cTexturePackerTex*>::iterator it;
 
-					mPlacedCount++;
+	mTextures.clear();
+
+	for ( it = Textures.begin(); it != Textures.end(); it++ ) {
+		cTexturePackerTex * t = (*it);
+		std::map<std::string, std::pair<Uint32, Uint32> >::iterator pit = PrevIndex.find( FileSystem::FileNameFromPath( t->Name() ) );
+
+		if ( pit != PrevIndex.end() ) {
+			cTexturePacker * Page	= Pages[ pit->second.first ];
+			sSubTextureHdr& Prev	= PrevSubTextures[ pit->second.first ][ pit->second.second ];
+
+			if ( Prev.Width == t->Width() && Prev.Height == t->Height() ) {
+				t->Place( Prev.X, Prev.Y, 0 != ( Prev.Flags & HDR_SUBTEXTURE_FLAG_FLIPED ) );
+
+				// The images added from memory don't have a date, they are always copied again
+				if ( NULL != t->Image() || Prev.Date != FileSystem::FileGetModificationDate( t->Name() ) || Prev.Channels != t->Channels() ) {
+					t->Dirty( true );
+					Page->mDirty = true;
 				}
+
+				Page->mTextures.push_back( t );
+
+				PrevUsed[ pit->second.first ][ pit->second.second ] = true;
+
+				continue;
 			}
 		}
+
+		Pending.push_back( t );
 	}
 
-	mFormat = Format;
+	// The space of the removed and resized textures must be cleared
+	for ( p = 0; p < PrevSubTextures.size(); p++ ) {
+		for ( i = 0; i < PrevSubTextures[p].size(); i++ ) {
+			if ( !PrevUsed[p][i] ) {
+				const sSubTextureHdr& Prev = PrevSubTextures[p][i];
+				bool Flipped = 0 != ( Prev.Flags & HDR_SUBTEXTURE_FLAG_FLIPED );
+				Int32 w = Flipped ? Prev.Height : Prev.Width;
+				Int32 h = Flipped ? Prev.Width : Prev.Height;
+
+				Pages[p]->mDirtyRects.push_back( eeRecti( Prev.X, Prev.Y, Prev.X + w + mPixelBorder, Prev.Y + h + mPixelBorder ) );
+				Pages[p]->mDirty = true;
+			}
+		}
+	}
 
-	Img.SaveToFile( Filepath, Format );
+	// Find the free space of every page
+	for ( p = 0; p < Pages.size(); p++ ) {
+		cTexturePacker * Page = Pages[p];
 
-	ChildSave( Format );
+		Page->mFreeRects.clear();
+		Page->mFreeRects.push_back( eeRecti( 0, 0, mWidth, mHeight ) );
+
+		for ( it = Page->mTextures.begin(); it != Page->mTextures.end(); it++ ) {
+			Page->PlaceMaxRect( GetTextureRect( *it ) );
+		}
+	}
+
+	// Place the new and resized textures in the free space, creating new pages if needed
+	for ( it = Pending.begin(); it != Pending.end(); it++ ) {
+		cTexturePackerTex * t = (*it);
+		eeRecti Pos;
+		bool Flipped = false;
+		bool Placed = false;
+
+		t->Width	( t->Width() 	+ mPixelBorder );
+		t->Height	( t->Height() 	+ mPixelBorder );
+
+		for ( p = 0; p <= Pages.size() && !Placed; p++ ) {
+			if ( p == Pages.size() ) {
+				cTexturePacker * Page = eeNew( cTexturePacker, ( mWidth, mHeight, mForcePowOfTwo, mPixelBorder, mAllowFlipping, mMethod ) );
+				Page->mParent = Pages.back();
+				Page->mPremultiplied = mPremultiplied;
+				Page->mFreeRects.push_back( eeRecti( 0, 0, mWidth, mHeight ) );
+				Pages.back()->mChild = Page;
+				Pages.push_back( Page );
+			}
+
+			cTexturePacker * Page = Pages[p];
+
+			if ( Page->FindMaxRectsPosition( t, Pos, Flipped ) ) {
+				t->Place( Pos.Left, Pos.Top, Flipped );
+				t->Dirty( true );
+
+				Page->PlaceMaxRect( Pos );
+				Page->mTextures.push_back( t );
+				Page->mDirty = true;
+
+				Placed = true;
+			}
+		}
+
+		t->Width	( t->Width() 	- mPixelBorder );
+		t->Height	( t->Height() 	- mPixelBorder );
+
+		// It can't happen, the textures bigger than the page are not added
+		if ( !Placed ) {
+			eeSAFE_DELETE( t );
+		}
+	}
+
+	// Release the pages that were left empty at the end
+	Uint32 Last = 0;
+
+	for ( p = 0; p < Pages.size(); p++ ) {
+		if ( Pages[p]->mTextures.size() )
+			Last = p;
+	}
+
+	eeSAFE_DELETE( Pages[ Last ]->mChild );
+	Pages.resize( Last + 1 );
+
+	for ( p = 0; p < Pages.size(); p++ ) {
+		cTexturePacker * Page = Pages[p];
+
+		Page->mFreeRects.clear();
+		Page->mPacked		= true;
+		Page->mCount		= 0;
+		Page->mPlacedCount	= (Int32)Page->mTextures.size();
+
+		Page->CalcUsedArea();
+	}
+
+	eePRINTL( "Incremental pack: %d pages. Occupancy: %4.3f percent", (Int32)Pages.size(), GetOccupancy() * 100.0 );
+
+	return true;
+}
+
+Uint32 cTexturePacker::GetAtlasFlags() const {
+	Uint32 Flags = 0;
+
+	if ( mAllowFlipping )
+		Flags |= HDR_TEXTURE_ATLAS_ALLOW_FLIPPING;
+
+	if ( !mSaveExtensions )
+		Flags |= HDR_TEXTURE_ATLAS_REMOVE_EXTENSION;
+
+	if ( mForcePowOfTwo )
+		Flags |= HDR_TEXTURE_ATLAS_POW_OF_TWO;
+
+	if ( mPremultiplied )
+		Flags |= HDR_TEXTURE_ATLAS_PREMULTIPLIED_ALPHA;
+
+	return Flags;
+}
+
+void cTexturePacker::SavePages( const std::string& Filepath, const EE_SAVE_TYPE& Format, const bool& SaveExtensions ) {
+	std::vector<cTexturePacker*> Pages;
+	std::string fFpath		= FileSystem::FileRemoveExtension( Filepath );
+	std::string fExt		= FileSystem::FileExtension( Filepath );
+	cTexturePacker * Page	= this;
+
+	while ( NULL != Page ) {
+		Page->mFilepath			= Pages.size() ? fFpath + "_ch" + String::ToStr( Pages.size() ) + "." + fExt : Filepath;
+		Page->mSaveExtensions	= SaveExtensions;
+		Page->mFormat			= Format;
+
+		Pages.push_back( Page );
+
+		Page = Page->GetChild();
+	}
+
+	// The pages are independent, every page is composed and encoded in its own thread
+	Uint32 ThreadsCount = eemin( (Uint32)eemax( Sys::GetCPUCount(), 1 ), (Uint32)Pages.size() );
+
+	if ( ThreadsCount > 1 ) {
+		cTexturePackerSaveJob Job( Pages );
+		std::vector<cThread*> Threads;
+		Uint32 i;
+
+		for ( i = 0; i < ThreadsCount; i++ ) {
+			Threads.push_back( eeNew( cThread, ( &cTexturePackerSaveJob::Run, &Job ) ) );
+			Threads[i]->Launch();
+		}
+
+		for ( i = 0; i < ThreadsCount; i++ ) {
+			Threads[i]->Wait();
+
+			eeSAFE_DELETE( Threads[i] );
+		}
+	} else {
+		for ( Uint32 i = 0; i < Pages.size(); i++ ) {
+			Pages[i]->SavePage();
+		}
+	}
 
 	SaveSubTextures();
 }
 
+bool cTexturePacker::CopyTexture( cImage * Img, cTexturePackerTex * t ) {
+	Uint8 * data = NULL;
+	Uint8 * Pixels;
+	int w, h, c;
+
+	if ( NULL == t->Image() ) {
+		data = stbi_load( t->Name().c_str(), &w, &h, &c, 0 );
+
+		if ( NULL == data || t->Width() != w || t->Height() != h ) {
+			if ( data )
+				free( data );
+
+			return false;
+		}
+
+		Pixels = data;
+	} else if ( NULL != t->Image()->GetPixels() ) {
+		Pixels	= t->Image()->GetPixels();
+		w		= t->Image()->Width();
+		h		= t->Image()->Height();
+		c		= t->Image()->Channels();
+	} else {
+		return false;
+	}
+
+	if ( t->Flipped() ) {
+		// The source image is rotated into a temporary image, so the texture image is kept as it was loaded
+		cImage Rotated( (Uint32)h, (Uint32)w, (Uint32)c, eeColorA(0,0,0,0), false );
+
+		Private::PixelsRotate( Rotated.GetPixels(), Pixels, w, h, c );
+
+		Img->CopyImage( &Rotated, t->X(), t->Y() );
+	} else {
+		cImage Source( Pixels, w, h, c );
+
+		Source.AvoidFreeImage( true );
+
+		Img->CopyImage( &Source, t->X(), t->Y() );
+	}
+
+	// Only the rectangle of the texture is premultiplied, the rest of the page could be already premultiplied ( incremental rebuild )
+	if ( mPremultiplied && ( 2 == Img->Channels() || 4 == Img->Channels() ) ) {
+		Int32 Left		= eemax( t->X(), 0 );
+		Int32 Right		= eemin( t->X() + ( t->Flipped() ? h : w ), (Int32)Img->Width() );
+		Int32 Bottom	= eemin( t->Y() + ( t->Flipped() ? w : h ), (Int32)Img->Height() );
+
+		for ( Int32 y = eemax( t->Y(), 0 ); y < Bottom && Right > Left; y++ ) {
+			Private::PixelsPremultiplyAlpha( Img->GetPixels() + ( y * Img->Width() + Left ) * Img->Channels(), Right - Left, Img->Channels() );
+		}
+	}
+
+	if ( data )
+		free( data );
+
+	return true;
+}
+
+eeRecti cTexturePacker::GetTextureRect( cTexturePackerTex * t ) const {
+	Int32 w = t->Flipped() ? t->Height() : t->Width();
+	Int32 h = t->Flipped() ? t->Width() : t->Height();
+
+	return eeRecti( t->X(), t->Y(), t->X() + w + mPixelBorder, t->Y() + h + mPixelBorder );
+}
+
+void cTexturePacker::ClearRect( cImage * Img, eeRecti Rect ) {
+	Rect.Left	= eemax( Rect.Left, 0 );
+	Rect.Top	= eemax( Rect.Top, 0 );
+	Rect.Right	= eemin( Rect.Right, (Int32)Img->Width() );
+	Rect.Bottom	= eemin( Rect.Bottom, (Int32)Img->Height() );
+
+	if ( Rect.Right > Rect.Left && Rect.Bottom > Rect.Top ) {
+		Uint32 Channels = Img->Channels();
+
+		for ( Int32 y = Rect.Top; y < Rect.Bottom; y++ ) {
+			Private::PixelsFill( Img->GetPixels() + ( y * Img->Width() + Rect.Left ) * Channels, Rect.Right - Rect.Left, Channels, eeColorA(0,0,0,0) );
+		}
+	}
+}
+
+void cTexturePacker::SavePage() {
+	std::list<cTexturePackerTex*>::iterator it;
+
+	if ( mIncremental ) {
+		// The page didn't change since the last build, it's not encoded again
+		if ( !mDirty && FileSystem::FileExists( mFilepath ) ) {
+			return;
+		}
+
+		// The lossy formats are composed again to avoid accumulating the compression artifacts
+		bool Lossless = SAVE_TYPE_PNG == mFormat || SAVE_TYPE_TGA == mFormat || SAVE_TYPE_BMP == mFormat;
+		cImage * Img = Lossless && FileSystem::FileExists( mFilepath ) ? eeNew( cImage, ( mFilepath, 4 ) ) : NULL;
+
+		if ( NULL != Img && NULL != Img->GetPixels() && (Int32)Img->Width() == mWidth && (Int32)Img->Height() == mHeight ) {
+			// Clear the rectangles of the removed and modified textures, and then copy the modified textures
+			for ( Uint32 i = 0; i < mDirtyRects.size(); i++ ) {
+				ClearRect( Img, mDirtyRects[i] );
+			}
+
+			for ( it = mTextures.begin(); it != mTextures.end(); it++ ) {
+				if ( (*it)->Dirty() ) {
+					ClearRect( Img, GetTextureRect( *it ) );
+				}
+			}
+
+			for ( it = mTextures.begin(); it != mTextures.end(); it++ ) {
+				if ( (*it)->Dirty() ) {
+					CopyTexture( Img, *it );
+				}
+			}
+
+			Img->SaveToFile( mFilepath, mFormat );
+
+			eeSAFE_DELETE( Img );
+
+			return;
+		}
+
+		eeSAFE_DELETE( Img );
+	}
+
+	// The page is composed again from all its textures
+	mPlacedCount = 0;
+
+	cImage Img( (Uint32)mWidth, (Uint32)mHeight, (Uint32)4 );
+
+	Img.FillWithColor( eeColorA(0,0,0,0) );
+
+	for ( it = mTextures.begin(); it != mTextures.end(); it++ ) {
+		if ( (*it)->Placed() && CopyTexture( &Img, *it ) ) {
+			mPlacedCount++;
+		}
+	}
+
+	Img.SaveToFile( mFilepath, mFormat );
+}
+
 Int32 cTexturePacker::GetChildCount() {
 	cTexturePacker * Child 		= mChild;
 	Int32 ChildCount 			= 0;
@@ -600,16 +1095,7 @@ void cTexturePacker::SaveSubTextures() {
 	TexGrHdr.Width			= mWidth;
 	TexGrHdr.Height			= mHeight;
 	TexGrHdr.PixelBorder	= mPixelBorder;
-	TexGrHdr.Flags			= 0;
-
-	if ( mAllowFlipping )
-		TexGrHdr.Flags |= HDR_TEXTURE_ATLAS_ALLOW_FLIPPING;
-
-	if ( !mSaveExtensions )
-		TexGrHdr.Flags |= HDR_TEXTURE_ATLAS_REMOVE_EXTENSION;
-
-	if ( mForcePowOfTwo )
-		TexGrHdr.Flags |= HDR_TEXTURE_ATLAS_POW_OF_TWO;
+	TexGrHdr.Flags			= GetAtlasFlags();
 
 	std::vector<sTextureHdr> TexHdr( TexGrHdr.TextureCount );
 
@@ -721,29 +1207,6 @@ sTextureHdr	cTexturePacker::CreateTextureHdr( cTexturePacker * Packer ) {
 	return TexHdr;
 }
 
-void cTexturePacker::ChildSave( const EE_SAVE_TYPE& Format ) {
-	if ( NULL != mChild ) {
-		cTexturePacker * Parent 	= mChild->GetParent();
-		cTexturePacker * LastParent	= NULL;
-		Int32 ParentCount 			= 0;
-
-		// Find the grand parent
-		while ( NULL != Parent ) {
-			ParentCount++;
-			LastParent = Parent;
-			Parent 	= Parent->GetParent();
-		}
-
-		if ( NULL != LastParent ) {
-			std::string fFpath	= FileSystem::FileRemoveExtension( LastParent->GetFilepath() );
-			std::string fExt	= FileSystem::FileExtension( LastParent->GetFilepath() );
-			std::string fName	= fFpath + "_ch" + String::ToStr( ParentCount ) + "." + fExt;
-
-			mChild->Save( fName, Format, mSaveExtensions );
-		}
-	}
-}
-
 cTexturePacker * cTexturePacker::GetChild() const {
 	return mChild;
 }
@@ -772,6 +1235,58 @@ const Int32& cTexturePacker::GetPlacedCount() const {
 	return mPlacedCount;
 }
 
+const cTexturePacker::PackMethod& cTexturePacker::GetPackMethod() const {
+	return mMethod;
+}
+
+void cTexturePacker::SetPremultipliedAlpha( const bool& Premultiplied ) {
+	for ( cTexturePacker * Page = this; NULL != Page; Page = Page->mChild ) {
+		Page->mPremultiplied = Premultiplied;
+	}
+}
+
+const bool& cTexturePacker::GetPremultipliedAlpha() const {
+	return mPremultiplied;
+}
+
+Uint32 cTexturePacker::GetPagesCount() const {
+	Uint32 Count = 1;
+	cTexturePacker * Child = mChild;
+
+	while ( NULL != Child ) {
+		Count++;
+		Child = Child->GetChild();
+	}
+
+	return Count;
+}
+
+eeFloat cTexturePacker::GetPageOccupancy( const Uint32& Page ) const {
+	const cTexturePacker * Packer = this;
+
+	for ( Uint32 i = 0; i < Page && NULL != Packer; i++ ) {
+		Packer = Packer->GetChild();
+	}
+
+	if ( NULL == Packer || Packer->mWidth <= 0 || Packer->mHeight <= 0 ) {
+		return 0;
+	}
+
+	return (eeFloat)( (eeDouble)Packer->mUsedArea / (eeDouble)( Packer->mWidth * Packer->mHeight ) );
+}
+
+eeFloat cTexturePacker::GetOccupancy() const {
+	eeDouble Used	= 0;
+	eeDouble Total	= 0;
+
+	for ( const cTexturePacker * Packer = this; NULL != Packer; Packer = Packer->GetChild() ) {
+		Used	+= Packer->mUsedArea;
+		Total	+= (eeDouble)Packer->mWidth * (eeDouble)Packer->mHeight;
+	}
+
+	return Total > 0 ? (eeFloat)( Used / Total ) : 0;
+}
+
 const Int32& cTexturePacker::Width() const {
 	return mWidth;
 }
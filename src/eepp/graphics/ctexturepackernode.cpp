@@ -97,4 +97,100 @@ bool cTexturePackerNode::Merge( const cTexturePackerNode& n ) {
 	return ret;
 }
 
+void TexturePackerNewFree( cTexturePackerNode ** FreeList, Int32 x, Int32 y, Int32 width, Int32 height ) {
+	cTexturePackerNode * node = eeNew( cTexturePackerNode, ( x, y, width, height ) );
+	node->SetNext( *FreeList );
+	*FreeList = node;
+}
+
+void TexturePackerReleaseFreeList( cTexturePackerNode ** FreeList ) {
+	cTexturePackerNode * next = *FreeList;
+	cTexturePackerNode * kill = NULL;
+
+	while ( NULL != next ) {
+		kill = next;
+
+		next = next->GetNext();
+
+		eeSAFE_DELETE( kill );
+	}
+
+	*FreeList = NULL;
+}
+
+void TexturePackerRemoveNode( cTexturePackerNode ** FreeList, cTexturePackerNode * Prev, cTexturePackerNode * Node ) {
+	if ( NULL != Prev )
+		Prev->SetNext( Node->GetNext() );
+	else
+		*FreeList = Node->GetNext();
+
+	eeSAFE_DELETE( Node );
+}
+
+bool TexturePackerMergeNodes( cTexturePackerNode ** FreeList ) {
+	cTexturePackerNode * f = *FreeList;
+
+	while ( f ) {
+		cTexturePackerNode * prev 	= NULL;
+		cTexturePackerNode * c 		= *FreeList;
+
+		while ( c ) {
+			if ( f != c && f->Merge( *c ) ) {
+				TexturePackerRemoveNode( FreeList, prev, c );
+
+				return true;
+			}
+
+			prev 	= c;
+			c 		= c->GetNext();
+		}
+
+		f = f->GetNext();
+	}
+
+	return false;
+}
+
+cTexturePackerNode * TexturePackerGetBestFit( cTexturePackerNode * FreeList, const Int32& Width, const Int32& Height, const bool& AllowFlipping, cTexturePackerNode ** PrevBestFit, Int32 * EdgeCount ) {
+	Int32 leastY 							= 0x7FFFFFFF;
+	Int32 leastX 							= 0x7FFFFFFF;
+	cTexturePackerNode * previousBestFit 	= NULL;
+	cTexturePackerNode * bestFit 			= NULL;
+	cTexturePackerNode * previous 			= NULL;
+	cTexturePackerNode * search 			= FreeList;
+	Int32 edgeCount 						= 0;
+	Int32 ec;
+
+	// Walk the singly linked list of free nodes
+	// see if it will fit into any currently free space
+	while ( search ) {
+		// see if the rectangle will fit into this slot, and if so how many edges does it share.
+		if ( search->Fits( Width, Height, ec, AllowFlipping ) ) {
+			if ( ec == 2 ) {
+				previousBestFit 	= previous; // record the pointer previous to this one (used to patch the linked list)
+				bestFit 			= search; 	// record the best fit.
+				edgeCount 			= ec;
+
+				break;
+			}
+
+			if ( search->Y() < leastY || ( search->Y() == leastY && search->X() < leastX ) ) {
+				leastY 				= search->Y();
+				leastX 				= search->X();
+				previousBestFit 	= previous;
+				bestFit 			= search;
+				edgeCount 			= ec;
+			}
+		}
+
+		previous 	= search;
+		search 		= search->GetNext();
+	}
+
+	*EdgeCount 		= edgeCount;
+	*PrevBestFit	= previousBestFit;
+
+	return bestFit;
+}
+
 }}}
@@ -44,6 +44,27 @@ class cTexturePackerNode {
 		Int32 					mHeight;
 }; 
 
+/** The free list helpers shared by cTexturePacker and cTextureAtlasPage. The free list is a singly linked list of the free rectangles of a page. */
+
+/** Adds a free node at the front of the free list */
+void TexturePackerNewFree( cTexturePackerNode ** FreeList, Int32 x, Int32 y, Int32 width, Int32 height );
+
+/** Releases all the nodes of the free list */
+void TexturePackerReleaseFreeList( cTexturePackerNode ** FreeList );
+
+/** Removes a node from the free list and releases it. Prev is the node previous to Node ( NULL if Node is the first one ). */
+void TexturePackerRemoveNode( cTexturePackerNode ** FreeList, cTexturePackerNode * Prev, cTexturePackerNode * Node );
+
+/** Merges two nodes of the free list that share an edge, the merged node is removed from the list.
+*	@return True if two nodes were merged ( call it until it returns false to merge all the nodes ) */
+bool TexturePackerMergeNodes( cTexturePackerNode ** FreeList );
+
+/** Finds the free node where a rectangle fits best: the first node that shares the two edges with the rectangle, otherwise the top-most and left-most node where it fits.
+*	@param PrevBestFit Receives the node previous to the best fit ( used to patch the linked list )
+*	@param EdgeCount Receives the number of edges that the rectangle shares with the best fit
+*	@return The best fit, NULL if the rectangle doesn't fit in any node */
+cTexturePackerNode * TexturePackerGetBestFit( cTexturePackerNode * FreeList, const Int32& Width, const Int32& Height, const bool& AllowFlipping, cTexturePackerNode ** PrevBestFit, Int32 * EdgeCount );
+
 }}}
 
 #endif
@@ -17,6 +17,7 @@ cTexturePackerTex::cTexturePackerTex( const std::string& Name ) :
 	mPlaced(false),
 	mLoadedInfo(false),
 	mDisabled(false),
+	mDirty(false),
 	mImg( NULL )
 {
 	if ( stbi_info( Name.c_str(), &mWidth, &mHeight, &mChannels ) ) {
@@ -39,6 +40,7 @@ cTexturePackerTex::cTexturePackerTex(cImage * Img , const std::string& Name ) :
 	mPlaced(false),
 	mLoadedInfo(false),
 	mDisabled(false),
+	mDirty(false),
 	mImg( Img )
 {
 	mArea 			= mWidth * mHeight;
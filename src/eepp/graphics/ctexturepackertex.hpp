@@ -50,6 +50,10 @@ class cTexturePackerTex {
 
 		inline void				Disabled( const bool& d ) 	{ mDisabled = d; }
 
+		inline const bool&		Dirty() const 				{ return mDirty; }
+
+		inline void				Dirty( const bool& d ) 		{ mDirty = d; }
+
 		inline const Int32& 	DestWidth() const			{ return mDestWidth; }
 
 		inline const Int32& 	DestHeight() const			{ return mDestHeight; }
@@ -84,6 +88,7 @@ class cTexturePackerTex {
 		bool  		mPlaced;
 		bool		mLoadedInfo;
 		bool		mDisabled;
+		bool		mDirty;
 		cImage *	mImg;
 };
 
@@ -0,0 +1,260 @@
+#include <eepp/graphics/cvertexstreambuffer.hpp>
+#include <eepp/graphics/renderer/cgl.hpp>
+#include <eepp/graphics/renderer/crenderergl3cp.hpp>
+
+namespace EE { namespace Graphics { namespace Private {
+
+cVertexStreamBuffer::cVertexStreamBuffer( const Uint32& SegmentSize, const Uint32& Segments ) :
+	mBuffer( 0 ),
+	mVAO( 0 ),
+	mPrevVAO( 0 ),
+	mSegmentSize( SegmentSize ),
+	mSegments( eemax( Segments, (Uint32)2 ) ),
+	mSegment( 0 ),
+	mOffset( 0 ),
+	mCreated( false ),
+	mFailed( false ),
+	mFences( false ),
+	mMapRange( false )
+{
+	for ( Uint32 i = 0; i < eeARRAY_SIZE( mAttribs ); i++ ) {
+		mAttribs[i] = -1;
+	}
+
+	mSync.resize( mSegments, NULL );
+}
+
+cVertexStreamBuffer::~cVertexStreamBuffer() {
+	if ( !mCreated ) {
+		return;
+	}
+
+	DeleteFences();
+
+	glDeleteBuffersARB( 1, &mBuffer );
+
+	if ( mVAO ) {
+		GLi->DeleteVertexArrays( 1, &mVAO );
+	}
+}
+
+bool cVertexStreamBuffer::IsSupported() {
+	return NULL != GLi && GLv_NULL != GLi->Version() && GLi->IsExtension( EEGL_ARB_vertex_buffer_object );
+}
+
+const bool& cVertexStreamBuffer::UsingFences() const {
+	return mFences;
+}
+
+bool cVertexStreamBuffer::Create() {
+	if ( !IsSupported() ) {
+		return false;
+	}
+
+	glGenBuffersARB( 1, &mBuffer );
+
+	if ( 0 == mBuffer ) {
+		return false;
+	}
+
+	if ( GLv_3CP == GLi->Version() ) {
+		GLi->GenVertexArrays( 1, &mVAO );
+
+		if ( 0 == mVAO ) {
+			glDeleteBuffersARB( 1, &mBuffer );
+			return false;
+		}
+	}
+
+	#ifdef EE_GLEW_AVAILABLE
+	mFences		= GLi->IsExtension( EEGL_ARB_sync );
+	mMapRange	= mFences && GLi->IsExtension( EEGL_ARB_map_buffer_range );
+	#endif
+
+	glBindBufferARB( GL_ARRAY_BUFFER, mBuffer );
+
+	Allocate( mSegmentSize );
+
+	glBindBufferARB( GL_ARRAY_BUFFER, 0 );
+
+	mCreated = true;
+
+	return true;
+}
+
+void cVertexStreamBuffer::Allocate( const Uint32& SegmentSize ) {
+	DeleteFences();
+
+	mSegmentSize	= SegmentSize;
+	mSegment		= 0;
+	mOffset			= 0;
+
+	glBufferDataARB( GL_ARRAY_BUFFER, mSegmentSize * mSegments, NULL, GL_STREAM_DRAW );
+}
+
+void cVertexStreamBuffer::DeleteFences() {
+	#ifdef EE_GLEW_AVAILABLE
+	for ( Uint32 i = 0; i < mSync.size(); i++ ) {
+		if ( NULL != mSync[i] ) {
+			glDeleteSync( reinterpret_cast<GLsync>( mSync[i] ) );
+			mSync[i] = NULL;
+		}
+	}
+	#endif
+}
+
+void cVertexStreamBuffer::NextSegment() {
+	#ifdef EE_GLEW_AVAILABLE
+	if ( mFences ) {
+		mSync[ mSegment ] = reinterpret_cast<void*>( glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 ) );
+
+		mSegment = ( mSegment + 1 ) % mSegments;
+		mOffset = 0;
+
+		if ( NULL != mSync[ mSegment ] ) {
+			GLsync sync = reinterpret_cast<GLsync>( mSync[ mSegment ] );
+
+			GLenum res = glClientWaitSync( sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000 );
+
+			glDeleteSync( sync );
+
+			mSync[ mSegment ] = NULL;
+
+			// If the fences don't work fallback to orphaning the buffer
+			if ( GL_WAIT_FAILED == res ) {
+				mFences		= false;
+				mMapRange	= false;
+
+				Allocate( mSegmentSize );
+			}
+		}
+
+		return;
+	}
+	#endif
+
+	mSegment = ( mSegment + 1 ) % mSegments;
+	mOffset = 0;
+
+	// The whole ring was used, let the driver give us a new storage instead of waiting for the GPU
+	if ( 0 == mSegment ) {
+		glBufferDataARB( GL_ARRAY_BUFFER, mSegmentSize * mSegments, NULL, GL_STREAM_DRAW );
+	}
+}
+
+void cVertexStreamBuffer::Write( const Uint32& Offset, const void * Data, const Uint32& Size ) {
+	#ifdef EE_GLEW_AVAILABLE
+	if ( mMapRange ) {
+		void * ptr = glMapBufferRange( GL_ARRAY_BUFFER, Offset, Size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT );
+
+		if ( NULL != ptr ) {
+			memcpy( ptr, Data, Size );
+
+			if ( GL_TRUE == glUnmapBuffer( GL_ARRAY_BUFFER ) ) {
+				return;
+			}
+		}
+
+		mMapRange = false;
+	}
+	#endif
+
+	glBufferSubDataARB( GL_ARRAY_BUFFER, Offset, Size, Data );
+}
+
+Int32 cVertexStreamBuffer::Begin( const void * Data, const Uint32& Size ) {
+	if ( mFailed || 0 == Size ) {
+		return -1;
+	}
+
+	if ( !mCreated && !Create() ) {
+		mFailed = true;
+		return -1;
+	}
+
+	glBindBufferARB( GL_ARRAY_BUFFER, mBuffer );
+
+	if ( Size > mSegmentSize ) {
+		Uint32 NewSize = mSegmentSize;
+
+		while ( NewSize < Size ) {
+			NewSize <<= 1;
+		}
+
+		Allocate( NewSize );
+	} else if ( mOffset + Size > mSegmentSize ) {
+		NextSegment();
+	}
+
+	Uint32 Offset = mSegment * mSegmentSize + mOffset;
+
+	Write( Offset, Data, Size );
+
+	// Keep every upload 16 bytes aligned
+	mOffset += ( Size + 15 ) & ~15;
+
+	if ( mVAO ) {
+		mPrevVAO = GLi->GetCurrentVertexArray();
+
+		GLi->BindVertexArray( mVAO );
+	}
+
+	return (Int32)Offset;
+}
+
+void cVertexStreamBuffer::Pointer( const Uint32& State, GLint size, GLenum type, GLsizei stride, const Uint32& Offset ) {
+	const GLvoid * pointer = reinterpret_cast<const char*>( NULL ) + Offset;
+
+	#ifdef EE_GL3_ENABLED
+	if ( mVAO ) {
+		// The vertex array object keeps its own attribute states, so they are not shared with the renderer ones
+		GLint index = GLi->GetRendererGL3CP()->GetStateIndex( State );
+
+		if ( mAttribs[ State ] != index ) {
+			if ( -1 != mAttribs[ State ] )
+				glDisableVertexAttribArray( mAttribs[ State ] );
+
+			if ( -1 != index )
+				glEnableVertexAttribArray( index );
+
+			mAttribs[ State ] = index;
+		}
+
+		if ( -1 != index ) {
+			glVertexAttribPointerARB( index, size, type, ( GL_UNSIGNED_BYTE == type || GL_UNSIGNED_SHORT == type ) ? GL_TRUE : GL_FALSE, stride, pointer );
+		}
+
+		return;
+	}
+	#endif
+
+	switch ( State ) {
+		case EEGL_VERTEX_ARRAY:
+			GLi->VertexPointer( size, type, stride, pointer, 0 );
+			break;
+		case EEGL_COLOR_ARRAY:
+			GLi->ColorPointer( size, type, stride, pointer, 0 );
+			break;
+		case EEGL_TEXTURE_COORD_ARRAY:
+			GLi->TexCoordPointer( size, type, stride, pointer, 0 );
+			break;
+	}
+}
+
+void cVertexStreamBuffer::DisablePointer( const Uint32& State ) {
+	if ( mVAO && -1 != mAttribs[ State ] ) {
+		glDisableVertexAttribArray( mAttribs[ State ] );
+
+		mAttribs[ State ] = -1;
+	}
+}
+
+void cVertexStreamBuffer::End() {
+	if ( mVAO ) {
+		GLi->BindVertexArray( mPrevVAO );
+	}
+
+	glBindBufferARB( GL_ARRAY_BUFFER, 0 );
+}
+
+}}}
@@ -0,0 +1,68 @@
+#ifndef EE_GRAPHICSCVERTEXSTREAMBUFFER_HPP
+#define EE_GRAPHICSCVERTEXSTREAMBUFFER_HPP
+
+#include <eepp/graphics/base.hpp>
+#include <eepp/graphics/opengl.hpp>
+#include <eepp/graphics/glhelper.hpp>
+
+namespace EE { namespace Graphics { namespace Private {
+
+/** @brief A vertex buffer split in a ring of segments, used to stream the batched vertexs to the GPU.
+*	Every upload is written after the previous one, so the driver never has to wait for a region that the GPU is still reading.
+*	If fences are available every filled segment is fenced and the fence is waited before the segment is reused,
+*	otherwise the buffer storage is orphaned every time the ring wraps.
+*/
+class cVertexStreamBuffer {
+	public:
+		cVertexStreamBuffer( const Uint32& SegmentSize = 256 * 1024, const Uint32& Segments = 3 );
+
+		~cVertexStreamBuffer();
+
+		/** @return If the current renderer can stream the vertexs with vertex buffers */
+		static bool IsSupported();
+
+		/** Writes the data in the ring and binds the buffer ( and its vertex array object with the GL3 Core Profile renderer ).
+		*	@return The offset of the data in the buffer, or -1 if the data couldn't be uploaded ( the caller must fallback to client arrays ).
+		*/
+		Int32 Begin( const void * Data, const Uint32& Size );
+
+		/** Sets the array state ( EEGL_ARRAY_STATES ) pointer at the buffer offset */
+		void Pointer( const Uint32& State, GLint size, GLenum type, GLsizei stride, const Uint32& Offset );
+
+		/** Disables the array state ( EEGL_ARRAY_STATES ) */
+		void DisablePointer( const Uint32& State );
+
+		/** Unbinds the buffer, and restores the previous vertex array object */
+		void End();
+
+		/** @return True if the segments are synchronized with fences, false if the buffer is orphaned when the ring wraps */
+		const bool& UsingFences() const;
+	protected:
+		GLuint				mBuffer;
+		GLuint				mVAO;
+		GLuint				mPrevVAO;
+		Uint32				mSegmentSize;
+		Uint32				mSegments;
+		Uint32				mSegment;
+		Uint32				mOffset;
+		GLint				mAttribs[ EEGL_TEXTURE_COORD_ARRAY + 1 ];
+		bool				mCreated;
+		bool				mFailed;
+		bool				mFences;
+		bool				mMapRange;
+		std::vector<void*>	mSync;
+
+		bool Create();
+
+		void Allocate( const Uint32& SegmentSize );
+
+		void NextSegment();
+
+		void DeleteFences();
+
+		void Write( const Uint32& Offset, const void * Data, const Uint32& Size );
+};
+
+}}}
+
+#endif
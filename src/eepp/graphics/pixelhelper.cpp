@@ -0,0 +1,607 @@
+#include <eepp/graphics/pixelhelper.hpp>
+
+#if defined( EE_SSE2 )
+#include <emmintrin.h>
+#elif defined( EE_NEON )
+#include <arm_neon.h>
+#endif
+
+namespace EE { namespace Graphics { namespace Private {
+
+// c * a / 255 rounded to the nearest integer, without the division
+static inline Uint8 MulDiv255( const Uint32& c, const Uint32& a ) {
+	Uint32 t = c * a + 128;
+
+	return (Uint8)( ( t + ( t >> 8 ) ) >> 8 );
+}
+
+#if defined( EE_SSE2 )
+// The same than MulDiv255 for 8 16 bits lanes
+static inline __m128i MulDiv255( const __m128i& C, const __m128i& A ) {
+	__m128i T = _mm_add_epi16( _mm_mullo_epi16( C, A ), _mm_set1_epi16( 128 ) );
+
+	return _mm_srli_epi16( _mm_add_epi16( T, _mm_srli_epi16( T, 8 ) ), 8 );
+}
+#elif defined( EE_NEON )
+static inline uint8x8_t MulDiv255( const uint8x8_t& C, const uint8x8_t& A ) {
+	uint16x8_t T = vmull_u8( C, A );
+
+	return vraddhn_u16( T, vrshrq_n_u16( T, 8 ) );
+}
+
+static inline uint8x16_t MulDiv255( const uint8x16_t& C, const uint8x16_t& A ) {
+	return vcombine_u8( MulDiv255( vget_low_u8( C ), vget_low_u8( A ) ), MulDiv255( vget_high_u8( C ), vget_high_u8( A ) ) );
+}
+#endif
+
+static inline bool PixelEqual( const Uint8 * P, const Uint8 * Key, const Uint32& Channels ) {
+	for ( Uint32 c = 0; c < Channels; c++ ) {
+		if ( P[c] != Key[c] ) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void PixelsReplaceColor( Uint8 * Pixels, const Uint32& Count, const Uint32& Channels, const eeColorA& ColorKey, const eeColorA& NewColor ) {
+	Uint8 Key[4] = { ColorKey.R(), ColorKey.G(), ColorKey.B(), ColorKey.A() };
+	Uint8 New[4] = { NewColor.R(), NewColor.G(), NewColor.B(), NewColor.A() };
+	Uint32 i = 0;
+	Uint32 c;
+
+	#if defined( EE_SSE2 )
+	if ( 3 == Channels ) {
+		// 16 pixels ( 48 bytes ) per iteration, a pixel matches when its 3 bytes match
+		Uint8 KeyPattern[48];
+
+		for ( c = 0; c < 48; c++ ) {
+			KeyPattern[c] = Key[ c % 3 ];
+		}
+
+		__m128i K0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( KeyPattern ) );
+		__m128i K1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( KeyPattern + 16 ) );
+		__m128i K2 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( KeyPattern + 32 ) );
+
+		for ( ; i + 16 <= Count; i += 16 ) {
+			Uint8 * P = Pixels + i * 3;
+
+			Uint64 Bits = (Uint64)_mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( P ) ), K0 ) ) |
+						( (Uint64)_mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( P + 16 ) ), K1 ) ) << 16 ) |
+						( (Uint64)_mm_movemask_epi8( _mm_cmpeq_epi8( _mm_loadu_si128( reinterpret_cast<const __m128i*>( P + 32 ) ), K2 ) ) << 32 );
+
+			Bits &= ( Bits >> 1 ) & ( Bits >> 2 );
+
+			if ( 0 != Bits ) {
+				for ( c = 0; c < 16; c++ ) {
+					if ( ( Bits >> ( c * 3 ) ) & 1 ) {
+						P[ c * 3 ]		= New[0];
+						P[ c * 3 + 1 ]	= New[1];
+						P[ c * 3 + 2 ]	= New[2];
+					}
+				}
+			}
+		}
+	} else {
+		__m128i K, N, M;
+
+		// The 1, 2 and 4 channels pixels are compared as 8, 16 and 32 bits lanes
+		if ( 4 == Channels ) {
+			Uint32 K32, N32;
+			memcpy( &K32, Key, 4 );
+			memcpy( &N32, New, 4 );
+			K = _mm_set1_epi32( (int)K32 );
+			N = _mm_set1_epi32( (int)N32 );
+		} else if ( 2 == Channels ) {
+			Uint16 K16, N16;
+			memcpy( &K16, Key, 2 );
+			memcpy( &N16, New, 2 );
+			K = _mm_set1_epi16( (short)K16 );
+			N = _mm_set1_epi16( (short)N16 );
+		} else {
+			K = _mm_set1_epi8( (char)Key[0] );
+			N = _mm_set1_epi8( (char)New[0] );
+		}
+
+		Uint32 Step = 16 / Channels;
+
+		for ( ; i + Step <= Count; i += Step ) {
+			__m128i * Ptr	= reinterpret_cast<__m128i*>( Pixels + i * Channels );
+			__m128i P		= _mm_loadu_si128( Ptr );
+
+			if ( 4 == Channels )
+				M = _mm_cmpeq_epi32( P, K );
+			else if ( 2 == Channels )
+				M = _mm_cmpeq_epi16( P, K );
+			else
+				M = _mm_cmpeq_epi8( P, K );
+
+			if ( 0 != _mm_movemask_epi8( M ) ) {
+				_mm_storeu_si128( Ptr, _mm_or_si128( _mm_and_si128( M, N ), _mm_andnot_si128( M, P ) ) );
+			}
+		}
+	}
+	#elif defined( EE_NEON )
+	if ( 3 == Channels ) {
+		uint8x16_t K0 = vdupq_n_u8( Key[0] ), K1 = vdupq_n_u8( Key[1] ), K2 = vdupq_n_u8( Key[2] );
+		uint8x16_t N0 = vdupq_n_u8( New[0] ), N1 = vdupq_n_u8( New[1] ), N2 = vdupq_n_u8( New[2] );
+
+		for ( ; i + 16 <= Count; i += 16 ) {
+			uint8x16x3_t P	= vld3q_u8( Pixels + i * 3 );
+			uint8x16_t M	= vandq_u8( vandq_u8( vceqq_u8( P.val[0], K0 ), vceqq_u8( P.val[1], K1 ) ), vceqq_u8( P.val[2], K2 ) );
+
+			P.val[0] = vbslq_u8( M, N0, P.val[0] );
+			P.val[1] = vbslq_u8( M, N1, P.val[1] );
+			P.val[2] = vbslq_u8( M, N2, P.val[2] );
+
+			vst3q_u8( Pixels + i * 3, P );
+		}
+	} else if ( 4 == Channels ) {
+		Uint32 K32, N32;
+		memcpy( &K32, Key, 4 );
+		memcpy( &N32, New, 4 );
+
+		uint32x4_t K = vdupq_n_u32( K32 );
+		uint32x4_t N = vdupq_n_u32( N32 );
+
+		for ( ; i + 4 <= Count; i += 4 ) {
+			uint32x4_t P = vreinterpretq_u32_u8( vld1q_u8( Pixels + i * 4 ) );
+
+			vst1q_u8( Pixels + i * 4, vreinterpretq_u8_u32( vbslq_u32( vceqq_u32( P, K ), N, P ) ) );
+		}
+	} else if ( 2 == Channels ) {
+		Uint16 K16, N16;
+		memcpy( &K16, Key, 2 );
+		memcpy( &N16, New, 2 );
+
+		uint16x8_t K = vdupq_n_u16( K16 );
+		uint16x8_t N = vdupq_n_u16( N16 );
+
+		for ( ; i + 8 <= Count; i += 8 ) {
+			uint16x8_t P = vreinterpretq_u16_u8( vld1q_u8( Pixels + i * 2 ) );
+
+			vst1q_u8( Pixels + i * 2, vreinterpretq_u8_u16( vbslq_u16( vceqq_u16( P, K ), N, P ) ) );
+		}
+	} else {
+		uint8x16_t K = vdupq_n_u8( Key[0] );
+		uint8x16_t N = vdupq_n_u8( New[0] );
+
+		for ( ; i + 16 <= Count; i += 16 ) {
+			uint8x16_t P = vld1q_u8( Pixels + i );
+
+			vst1q_u8( Pixels + i, vbslq_u8( vceqq_u8( P, K ), N, P ) );
+		}
+	}
+	#endif
+
+	for ( ; i < Count; i++ ) {
+		Uint8 * P = Pixels + i * Channels;
+
+		if ( PixelEqual( P, Key, Channels ) ) {
+			for ( c = 0; c < Channels; c++ ) {
+				P[c] = New[c];
+			}
+		}
+	}
+}
+
+void PixelsFill( Uint8 * Pixels, const Uint32& Count, const Uint32& Channels, const eeColorA& Color ) {
+	// 48 bytes contain an exact number of pixels of 1, 2, 3 and 4 channels
+	Uint8 Comp[4] = { Color.R(), Color.G(), Color.B(), Color.A() };
+	Uint8 Pattern[48];
+	Uint32 Size = Count * Channels;
+	Uint32 i = 0;
+
+	for ( i = 0; i < 48; i++ ) {
+		Pattern[i] = Comp[ i % Channels ];
+	}
+
+	i = 0;
+
+	#if defined( EE_SSE2 )
+	__m128i P0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( Pattern ) );
+	__m128i P1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( Pattern + 16 ) );
+	__m128i P2 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( Pattern + 32 ) );
+
+	for ( ; i + 48 <= Size; i += 48 ) {
+		_mm_storeu_si128( reinterpret_cast<__m128i*>( Pixels + i ), P0 );
+		_mm_storeu_si128( reinterpret_cast<__m128i*>( Pixels + i + 16 ), P1 );
+		_mm_storeu_si128( reinterpret_cast<__m128i*>( Pixels + i + 32 ), P2 );
+	}
+	#elif defined( EE_NEON )
+	uint8x16_t P0 = vld1q_u8( Pattern );
+	uint8x16_t P1 = vld1q_u8( Pattern + 16 );
+	uint8x16_t P2 = vld1q_u8( Pattern + 32 );
+
+	for ( ; i + 48 <= Size; i += 48 ) {
+		vst1q_u8( Pixels + i, P0 );
+		vst1q_u8( Pixels + i + 16, P1 );
+		vst1q_u8( Pixels + i + 32, P2 );
+	}
+	#else
+	for ( ; i + 48 <= Size; i += 48 ) {
+		memcpy( Pixels + i, Pattern, 48 );
+	}
+	#endif
+
+	if ( i < Size ) {
+		memcpy( Pixels + i, Pattern, Size - i );
+	}
+}
+
+void PixelsPremultiplyAlpha( Uint8 * Pixels, const Uint32& Count, const Uint32& Channels ) {
+	if ( 4 != Channels && 2 != Channels ) {
+		return;
+	}
+
+	Uint32 i = 0;
+
+	#if defined( EE_SSE2 )
+	// 4 RGBA pixels or 8 grey alpha pixels per iteration. The alpha lanes are multiplied by 255, so they keep their value.
+	__m128i Zero = _mm_setzero_si128();
+	__m128i AlphaOne;
+
+	if ( 4 == Channels ) {
+		AlphaOne = _mm_set_epi16( 255, 0, 0, 0, 255, 0, 0, 0 );
+	} else {
+		AlphaOne = _mm_set_epi16( 255, 0, 255, 0, 255, 0, 255, 0 );
+	}
+
+	for ( ; ( i + 16 / Channels ) <= Count; i += 16 / Channels ) {
+		__m128i * Ptr	= reinterpret_cast<__m128i*>( Pixels + i * Channels );
+		__m128i P		= _mm_loadu_si128( Ptr );
+		__m128i Lo		= _mm_unpacklo_epi8( P, Zero );
+		__m128i Hi		= _mm_unpackhi_epi8( P, Zero );
+		__m128i ALo, AHi;
+
+		if ( 4 == Channels ) {
+			ALo = _mm_shufflehi_epi16( _mm_shufflelo_epi16( Lo, _MM_SHUFFLE( 3, 3, 3, 3 ) ), _MM_SHUFFLE( 3, 3, 3, 3 ) );
+			AHi = _mm_shufflehi_epi16( _mm_shufflelo_epi16( Hi, _MM_SHUFFLE( 3, 3, 3, 3 ) ), _MM_SHUFFLE( 3, 3, 3, 3 ) );
+		} else {
+			ALo = _mm_shufflehi_epi16( _mm_shufflelo_epi16( Lo, _MM_SHUFFLE( 3, 3, 1, 1 ) ), _MM_SHUFFLE( 3, 3, 1, 1 ) );
+			AHi = _mm_shufflehi_epi16( _mm_shufflelo_epi16( Hi, _MM_SHUFFLE( 3, 3, 1, 1 ) ), _MM_SHUFFLE( 3, 3, 1, 1 ) );
+		}
+
+		Lo = MulDiv255( Lo, _mm_or_si128( ALo, AlphaOne ) );
+		Hi = MulDiv255( Hi, _mm_or_si128( AHi, AlphaOne ) );
+
+		_mm_storeu_si128( Ptr, _mm_packus_epi16( Lo, Hi ) );
+	}
+	#elif defined( EE_NEON )
+	if ( 4 == Channels ) {
+		for ( ; i + 16 <= Count; i += 16 ) {
+			uint8x16x4_t P = vld4q_u8( Pixels + i * 4 );
+
+			P.val[0] = MulDiv255( P.val[0], P.val[3] );
+			P.val[1] = MulDiv255( P.val[1], P.val[3] );
+			P.val[2] = MulDiv255( P.val[2], P.val[3] );
+
+			vst4q_u8( Pixels + i * 4, P );
+		}
+	} else {
+		for ( ; i + 16 <= Count; i += 16 ) {
+			uint8x16x2_t P = vld2q_u8( Pixels + i * 2 );
+
+			P.val[0] = MulDiv255( P.val[0], P.val[1] );
+
+			vst2q_u8( Pixels + i * 2, P );
+		}
+	}
+	#endif
+
+	for ( ; i < Count; i++ ) {
+		Uint8 * P	= Pixels + i * Channels;
+		Uint8 A		= P[ Channels - 1 ];
+
+		for ( Uint32 c = 0; c < Channels - 1; c++ ) {
+			P[c] = MulDiv255( P[c], A );
+		}
+	}
+}
+
+void PixelsSwizzle( Uint8 * Pixels, const Uint32& Count, const Uint32& Channels, const Uint8 * Map ) {
+	Uint32 i = 0;
+	Uint32 c;
+	bool Identity = true;
+
+	for ( c = 0; c < Channels; c++ ) {
+		if ( Map[c] >= Channels ) {
+			return;
+		}
+
+		if ( Map[c] != c ) {
+			Identity = false;
+		}
+	}
+
+	if ( Identity ) {
+		return;
+	}
+
+	#if defined( EE_SSE2 )
+	if ( 4 == Channels ) {
+		// Every channel is shifted from its source position to its destination position in the 32 bits lanes
+		__m128i Mask = _mm_set1_epi32( 0xFF );
+		__m128i SrcShift[4];
+		__m128i DstShift[4];
+
+		for ( c = 0; c < 4; c++ ) {
+			SrcShift[c] = _mm_cvtsi32_si128( Map[c] * 8 );
+			DstShift[c] = _mm_cvtsi32_si128( c * 8 );
+		}
+
+		for ( ; i + 4 <= Count; i += 4 ) {
+			__m128i * Ptr	= reinterpret_cast<__m128i*>( Pixels + i * 4 );
+			__m128i P		= _mm_loadu_si128( Ptr );
+			__m128i R		= _mm_setzero_si128();
+
+			for ( c = 0; c < 4; c++ ) {
+				R = _mm_or_si128( R, _mm_sll_epi32( _mm_and_si128( _mm_srl_epi32( P, SrcShift[c] ), Mask ), DstShift[c] ) );
+			}
+
+			_mm_storeu_si128( Ptr, R );
+		}
+	}
+	#elif defined( EE_NEON )
+	if ( 4 == Channels ) {
+		for ( ; i + 16 <= Count; i += 16 ) {
+			uint8x16x4_t P = vld4q_u8( Pixels + i * 4 );
+			uint8x16x4_t R;
+
+			for ( c = 0; c < 4; c++ ) {
+				R.val[c] = P.val[ Map[c] ];
+			}
+
+			vst4q_u8( Pixels + i * 4, R );
+		}
+	} else if ( 3 == Channels ) {
+		for ( ; i + 16 <= Count; i += 16 ) {
+			uint8x16x3_t P = vld3q_u8( Pixels + i * 3 );
+			uint8x16x3_t R;
+
+			for ( c = 0; c < 3; c++ ) {
+				R.val[c] = P.val[ Map[c] ];
+			}
+
+			vst3q_u8( Pixels + i * 3, R );
+		}
+	}
+	#endif
+
+	Uint8 Tmp[4];
+
+	for ( ; i < Count; i++ ) {
+		Uint8 * P = Pixels + i * Channels;
+
+		for ( c = 0; c < Channels; c++ ) {
+			Tmp[c] = P[ Map[c] ];
+		}
+
+		for ( c = 0; c < Channels; c++ ) {
+			P[c] = Tmp[c];
+		}
+	}
+}
+
+void PixelsConvert( Uint8 * Dst, const Uint32& DstChannels, const Uint8 * Src, const Uint32& SrcChannels, const Uint32& Count ) {
+	if ( DstChannels == SrcChannels ) {
+		memcpy( Dst, Src, Count * DstChannels );
+		return;
+	}
+
+	Uint32 i = 0;
+	Uint32 c;
+
+	#if defined( EE_SSE2 )
+	if ( 4 == DstChannels && ( 1 == SrcChannels || 2 == SrcChannels ) ) {
+		// The grey and grey alpha pixels are widened with unpacks, the missing channels are set to 255
+		__m128i Full = _mm_set1_epi8( (char)0xFF );
+
+		if ( 1 == SrcChannels ) {
+			for ( ; i + 16 <= Count; i += 16 ) {
+				__m128i S	= _mm_loadu_si128( reinterpret_cast<const __m128i*>( Src + i ) );
+				__m128i Lo	= _mm_unpacklo_epi8( S, Full );
+				__m128i Hi	= _mm_unpackhi_epi8( S, Full );
+				__m128i * D	= reinterpret_cast<__m128i*>( Dst + i * 4 );
+
+				_mm_storeu_si128( D		, _mm_unpacklo_epi16( Lo, Full ) );
+				_mm_storeu_si128( D + 1	, _mm_unpackhi_epi16( Lo, Full ) );
+				_mm_storeu_si128( D + 2	, _mm_unpacklo_epi16( Hi, Full ) );
+				_mm_storeu_si128( D + 3	, _mm_unpackhi_epi16( Hi, Full ) );
+			}
+		} else {
+			for ( ; i + 8 <= Count; i += 8 ) {
+				__m128i S	= _mm_loadu_si128( reinterpret_cast<const __m128i*>( Src + i * 2 ) );
+				__m128i * D	= reinterpret_cast<__m128i*>( Dst + i * 4 );
+
+				_mm_storeu_si128( D		, _mm_unpacklo_epi16( S, Full ) );
+				_mm_storeu_si128( D + 1	, _mm_unpackhi_epi16( S, Full ) );
+			}
+		}
+	}
+	#elif defined( EE_NEON )
+	if ( 3 == SrcChannels && 4 == DstChannels ) {
+		for ( ; i + 16 <= Count; i += 16 ) {
+			uint8x16x3_t S = vld3q_u8( Src + i * 3 );
+			uint8x16x4_t D;
+
+			D.val[0] = S.val[0];
+			D.val[1] = S.val[1];
+			D.val[2] = S.val[2];
+			D.val[3] = vdupq_n_u8( 255 );
+
+			vst4q_u8( Dst + i * 4, D );
+		}
+	} else if ( 4 == SrcChannels && 3 == DstChannels ) {
+		for ( ; i + 16 <= Count; i += 16 ) {
+			uint8x16x4_t S = vld4q_u8( Src + i * 4 );
+			uint8x16x3_t D;
+
+			D.val[0] = S.val[0];
+			D.val[1] = S.val[1];
+			D.val[2] = S.val[2];
+
+			vst3q_u8( Dst + i * 3, D );
+		}
+	}
+	#endif
+
+	Uint32 Copy = eemin( DstChannels, SrcChannels );
+
+	for ( ; i < Count; i++ ) {
+		const Uint8 * S	= Src + i * SrcChannels;
+		Uint8 * D		= Dst + i * DstChannels;
+
+		for ( c = 0; c < Copy; c++ ) {
+			D[c] = S[c];
+		}
+
+		for ( ; c < DstChannels; c++ ) {
+			D[c] = 255;
+		}
+	}
+}
+
+static inline void BlendPixel( Uint8 * D, const Uint8 * S ) {
+	if ( 255 == S[3] ) {
+		D[0] = S[0];
+		D[1] = S[1];
+		D[2] = S[2];
+		D[3] = S[3];
+	} else if ( 0 != S[3] ) {
+		eeColorA C( Color::Blend( eeColorA( S[0], S[1], S[2], S[3] ), eeColorA( D[0], D[1], D[2], D[3] ) ) );
+
+		D[0] = C.R();
+		D[1] = C.G();
+		D[2] = C.B();
+		D[3] = C.A();
+	}
+}
+
+void PixelsBlend( Uint8 * Dst, const Uint8 * Src, const Uint32& Count ) {
+	Uint32 i = 0;
+
+	#if defined( EE_SSE2 ) || defined( EE_NEON )
+	Uint32 AlphaBits;
+	Uint8 AlphaMask[4] = { 0, 0, 0, 255 };
+	memcpy( &AlphaBits, AlphaMask, 4 );
+
+	#if defined( EE_SSE2 )
+	__m128i Alpha	= _mm_set1_epi32( (int)AlphaBits );
+	__m128i Zero	= _mm_setzero_si128();
+	#else
+	uint32x4_t Alpha	= vdupq_n_u32( AlphaBits );
+	uint32x4_t Zero		= vdupq_n_u32( 0 );
+	#endif
+
+	// Most of the pixels of the sprites are opaque or fully transparent, 4 of them are copied or skipped at once
+	for ( ; i + 4 <= Count; i += 4 ) {
+		#if defined( EE_SSE2 )
+		__m128i S = _mm_loadu_si128( reinterpret_cast<const __m128i*>( Src + i * 4 ) );
+		__m128i A = _mm_and_si128( S, Alpha );
+
+		if ( 0xFFFF == _mm_movemask_epi8( _mm_cmpeq_epi32( A, Alpha ) ) ) {
+			_mm_storeu_si128( reinterpret_cast<__m128i*>( Dst + i * 4 ), S );
+			continue;
+		}
+
+		if ( 0xFFFF == _mm_movemask_epi8( _mm_cmpeq_epi32( A, Zero ) ) ) {
+			continue;
+		}
+		#else
+		uint32x4_t S = vreinterpretq_u32_u8( vld1q_u8( Src + i * 4 ) );
+		uint32x4_t A = vandq_u32( S, Alpha );
+		uint32x4_t M = vceqq_u32( A, Alpha );
+		uint32x2_t R = vpmin_u32( vget_low_u32( M ), vget_high_u32( M ) );
+
+		if ( 0xFFFFFFFF == vget_lane_u32( vpmin_u32( R, R ), 0 ) ) {
+			vst1q_u8( Dst + i * 4, vreinterpretq_u8_u32( S ) );
+			continue;
+		}
+
+		M = vceqq_u32( A, Zero );
+		R = vpmin_u32( vget_low_u32( M ), vget_high_u32( M ) );
+
+		if ( 0xFFFFFFFF == vget_lane_u32( vpmin_u32( R, R ), 0 ) ) {
+			continue;
+		}
+		#endif
+
+		for ( Uint32 p = 0; p < 4; p++ ) {
+			BlendPixel( Dst + ( i + p ) * 4, Src + ( i + p ) * 4 );
+		}
+	}
+	#endif
+
+	for ( ; i < Count; i++ ) {
+		BlendPixel( Dst + i * 4, Src + i * 4 );
+	}
+}
+
+void PixelsFlipRows( Uint8 * Pixels, const Uint32& RowSize, const Uint32& Rows ) {
+	for ( Uint32 y = 0; y < Rows / 2; y++ ) {
+		Uint8 * A = Pixels + y * RowSize;
+		Uint8 * B = Pixels + ( Rows - 1 - y ) * RowSize;
+		Uint32 i = 0;
+
+		#if defined( EE_SSE2 )
+		for ( ; i + 16 <= RowSize; i += 16 ) {
+			__m128i a = _mm_loadu_si128( reinterpret_cast<const __m128i*>( A + i ) );
+			__m128i b = _mm_loadu_si128( reinterpret_cast<const __m128i*>( B + i ) );
+
+			_mm_storeu_si128( reinterpret_cast<__m128i*>( A + i ), b );
+			_mm_storeu_si128( reinterpret_cast<__m128i*>( B + i ), a );
+		}
+		#elif defined( EE_NEON )
+		for ( ; i + 16 <= RowSize; i += 16 ) {
+			uint8x16_t a = vld1q_u8( A + i );
+			uint8x16_t b = vld1q_u8( B + i );
+
+			vst1q_u8( A + i, b );
+			vst1q_u8( B + i, a );
+		}
+		#endif
+
+		for ( ; i < RowSize; i++ ) {
+			Uint8 t = A[i];
+			A[i] = B[i];
+			B[i] = t;
+		}
+	}
+}
+
+// The image is rotated in tiles, so the rows written in the destination are still in the cache for the next source row
+template <Uint32 C>
+static void RotatePixels( Uint8 * Dst, const Uint8 * Src, const Uint32& Width, const Uint32& Height ) {
+	const Uint32 Tile = 32;
+
+	for ( Uint32 ty = 0; ty < Height; ty += Tile ) {
+		Uint32 ey = eemin( ty + Tile, Height );
+
+		for ( Uint32 tx = 0; tx < Width; tx += Tile ) {
+			Uint32 ex = eemin( tx + Tile, Width );
+
+			for ( Uint32 y = ty; y < ey; y++ ) {
+				const Uint8 * S	= Src + ( y * Width + tx ) * C;
+				Uint8 * D		= Dst + ( tx * Height + ( Height - 1 - y ) ) * C;
+
+				for ( Uint32 x = tx; x < ex; x++, S += C, D += Height * C ) {
+					for ( Uint32 c = 0; c < C; c++ ) {
+						D[c] = S[c];
+					}
+				}
+			}
+		}
+	}
+}
+
+void PixelsRotate( Uint8 * Dst, const Uint8 * Src, const Uint32& Width, const Uint32& Height, const Uint32& Channels ) {
+	switch ( Channels ) {
+		case 1: RotatePixels<1>( Dst, Src, Width, Height ); break;
+		case 2: RotatePixels<2>( Dst, Src, Width, Height ); break;
+		case 3: RotatePixels<3>( Dst, Src, Width, Height ); break;
+		case 4: RotatePixels<4>( Dst, Src, Width, Height ); break;
+	}
+}
+
+}}}
@@ -0,0 +1,39 @@
+#ifndef EE_GRAPHICSPIXELHELPER_HPP
+#define EE_GRAPHICSPIXELHELPER_HPP
+
+#include <eepp/graphics/base.hpp>
+
+namespace EE { namespace Graphics { namespace Private {
+
+/** Pixel kernels used by cImage and the texture packer. They work with 8 bits per channel pixels of 1 to 4 channels, and use SSE2 or NEON when available.
+*	Count is always the number of pixels ( not bytes ) to process.
+*/
+
+/** Replaces every pixel that is equal to ColorKey with NewColor ( only the first Channels components of the colors are compared and copied ) */
+void PixelsReplaceColor( Uint8 * Pixels, const Uint32& Count, const Uint32& Channels, const eeColorA& ColorKey, const eeColorA& NewColor );
+
+/** Fills the pixels with a color */
+void PixelsFill( Uint8 * Pixels, const Uint32& Count, const Uint32& Channels, const eeColorA& Color );
+
+/** Multiplies the color components by the alpha component ( the last channel, only 2 and 4 channels images have alpha ) */
+void PixelsPremultiplyAlpha( Uint8 * Pixels, const Uint32& Count, const Uint32& Channels );
+
+/** Reorders the channels of the pixels, the channel i of every pixel is replaced by the channel Map[i] ( Map must have Channels elements ) */
+void PixelsSwizzle( Uint8 * Pixels, const Uint32& Count, const Uint32& Channels, const Uint8 * Map );
+
+/** Copies a row of pixels converting the number of channels. The channels that the source doesn't have are set to 255 ( the same result than
+*	copying the pixels with cImage::GetPixel and cImage::SetPixel ). The source and destination must not overlap. */
+void PixelsConvert( Uint8 * Dst, const Uint32& DstChannels, const Uint8 * Src, const Uint32& SrcChannels, const Uint32& Count );
+
+/** Blends RGBA source pixels over RGBA destination pixels ( the same result than Color::Blend ). The opaque and fully transparent pixels are copied and skipped 4 at a time. */
+void PixelsBlend( Uint8 * Dst, const Uint8 * Src, const Uint32& Count );
+
+/** Flips vertically the rows of an image in place */
+void PixelsFlipRows( Uint8 * Pixels, const Uint32& RowSize, const Uint32& Rows );
+
+/** Rotates an image 90º clockwise ( the cImage::Flip transform ). Dst must have space for Width * Height pixels, and it's Height pixels wide. */
+void PixelsRotate( Uint8 * Dst, const Uint8 * Src, const Uint32& Width, const Uint32& Height, const Uint32& Channels );
+
+}}}
+
+#endif
@@ -40,7 +40,7 @@ bool PixelPerfectCollide( cTexture * Tex1, const eeUint& x1, const eeUint& y1, c
 		inter_y1 = eemin(ay2,by2);
 		eeColorA C1, C2;
 
-		for(eeUint y = inter_y0 ; y <= inter_y1 ; y++) {
+		for(eeUint y = inter_y0 ; y <= inter_y1 && !Collide ; y++) {
 			for(eeUint x = inter_x0 ; x <= inter_x1 ; x++) {
 				if (Tex1_SrcRECT.Right != 0 && Tex1_SrcRECT.Bottom != 0)
 					C1 = Tex1->GetPixel( x - x1 + Tex1_SrcRECT.Left, y - y1 + Tex1_SrcRECT.Top );
@@ -81,7 +81,7 @@ bool PixelPerfectCollide( cTexture * Tex, const eeUint& x1, const eeUint& y1, co
 		ay2 = ay1 + Tex->Height() - 1;
 	}
 
-	if ( !( ax1 >= x2 && ax2 <= x2 && ay1 >= y2 && ay2 <= y2 ) ) {
+	if ( x2 >= ax1 && x2 <= ax2 && y2 >= ay1 && y2 <= ay2 ) {
 		eeColorA C1;
 		
 		Tex->Lock();
@@ -99,4 +99,73 @@ bool PixelPerfectCollide( cTexture * Tex, const eeUint& x1, const eeUint& y1, co
 	return Collide;
 }
 
+static bool BoundingBoxesOverlap( cSubTexture * SubTex1, const Int32& x1, const Int32& y1, cSubTexture * SubTex2, const Int32& x2, const Int32& y2 ) {
+	const eeRecti& R1 = SubTex1->SrcRect();
+	const eeRecti& R2 = SubTex2->SrcRect();
+
+	return !( x1 >= x2 + R2.Right - R2.Left || x2 >= x1 + R1.Right - R1.Left || y1 >= y2 + R2.Bottom - R2.Top || y2 >= y1 + R1.Bottom - R1.Top );
+}
+
+bool PixelPerfectCollide( cSubTexture * SubTex1, const Int32& x1, const Int32& y1, cSubTexture * SubTex2, const Int32& x2, const Int32& y2 ) {
+	eeASSERT( NULL != SubTex1 && NULL != SubTex2 );
+
+	Int32 ax = x1 + SubTex1->Offset().x;
+	Int32 ay = y1 + SubTex1->Offset().y;
+	Int32 bx = x2 + SubTex2->Offset().x;
+	Int32 by = y2 + SubTex2->Offset().y;
+
+	if ( !BoundingBoxesOverlap( SubTex1, ax, ay, SubTex2, bx, by ) )
+		return false;
+
+	const cCollisionMask * Mask1 = SubTex1->GetCollisionMask();
+	const cCollisionMask * Mask2 = SubTex2->GetCollisionMask();
+
+	return NULL != Mask1 && NULL != Mask2 && Mask1->Collide( ax, ay, *Mask2, bx, by );
+}
+
+bool PixelPerfectCollide( cSubTexture * SubTex, const Int32& x1, const Int32& y1, const Int32& x2, const Int32& y2 ) {
+	eeASSERT( NULL != SubTex );
+
+	const cCollisionMask * Mask = SubTex->GetCollisionMask();
+
+	return NULL != Mask && Mask->IsSolid( x2 - x1 - SubTex->Offset().x, y2 - y1 - SubTex->Offset().y );
+}
+
+Uint32 PixelPerfectCollide( cSubTexture * SubTex, const Int32& x, const Int32& y, cSubTexture ** Others, const eeVector2i * OthersPos, const Uint32& Count, bool * Collisions ) {
+	eeASSERT( NULL != SubTex );
+
+	const cCollisionMask * Mask = SubTex->GetCollisionMask();
+	Int32 ax = x + SubTex->Offset().x;
+	Int32 ay = y + SubTex->Offset().y;
+	Uint32 Collided = 0;
+
+	for ( Uint32 i = 0; i < Count; i++ ) {
+		bool Collide = false;
+
+		if ( NULL != Mask && NULL != Others[i] ) {
+			Int32 bx = OthersPos[i].x + Others[i]->Offset().x;
+			Int32 by = OthersPos[i].y + Others[i]->Offset().y;
+
+			if ( BoundingBoxesOverlap( SubTex, ax, ay, Others[i], bx, by ) ) {
+				const cCollisionMask * OtherMask = Others[i]->GetCollisionMask();
+
+				Collide = NULL != OtherMask && Mask->Collide( ax, ay, *OtherMask, bx, by );
+			}
+		}
+
+		if ( NULL != Collisions ) {
+			Collisions[i] = Collide;
+		}
+
+		if ( Collide ) {
+			Collided++;
+
+			if ( NULL == Collisions )
+				break;
+		}
+	}
+
+	return Collided;
+}
+
 }}
@@ -3,12 +3,15 @@
 #include <eepp/graphics/renderer/crenderergl3.hpp>
 #include <eepp/graphics/renderer/crenderergl3cp.hpp>
 #include <eepp/graphics/renderer/crenderergles2.hpp>
+#include <eepp/graphics/renderer/crenderernull.hpp>
 #include <eepp/helper/SOIL2/src/SOIL2/SOIL2.h>
 
 namespace EE { namespace Graphics {
 
 typedef const GLubyte *( * pglGetStringiFunc) (GLenum, GLuint);
 
+static const GLuint EEGL_STATE_UNKNOWN = 0xFFFFFFFF;
+
 cGL * GLi = NULL;
 
 cGL * cGL::ms_singleton = NULL;
@@ -40,6 +43,11 @@ cGL * cGL::CreateSingleton( EEGL_version ver ) {
 	#endif
 
 	switch ( ver ) {
+		case GLv_NULL:
+		{
+			ms_singleton = eeNew( cRendererNull, () );
+			break;
+		}
 		case GLv_ES2:
 		{
 			#if defined( EE_GL3_ENABLED ) || defined( EE_GLES2 )
@@ -114,9 +122,17 @@ cGL::cGL() :
 	mBlendEnabled( false ),
 	mQuadVertexs( 4 ),
 	mLineWidth( 1 ),
-	mCurVAO( 0 )
+	mCurVAO( 0 ),
+	mStateFilter( true ),
+	mStateChangesIssued( 0 ),
+	mStateChangesDropped( 0 ),
+	mStateTextureUnit( 0 ),
+	mStateProgram( 0 ),
+	mStateCacheDirty( false )
 {
 	GLi = this;
+
+	InvalidateStateCache();
 }
 
 cGL::~cGL() {
@@ -139,6 +155,10 @@ cRendererGLES2 * cGL::GetRendererGLES2() {
 	return reinterpret_cast<cRendererGLES2*>( this );
 }
 
+cRendererNull * cGL::GetRendererNull() {
+	return reinterpret_cast<cRendererNull*>( this );
+}
+
 void cGL::WriteExtension( Uint8 Pos, Uint32 BitWrite ) {
 	BitOp::WriteBitKey( &mExtensions, Pos, BitWrite );
 }
@@ -164,6 +184,9 @@ void cGL::Init() {
 		WriteExtension( EEGL_ARB_pixel_buffer_object		, GLEW_ARB_pixel_buffer_object						);
 		WriteExtension( EEGL_ARB_vertex_array_object		, GLEW_ARB_vertex_array_object 						);
 		WriteExtension( EEGL_EXT_blend_func_separate		, GLEW_EXT_blend_func_separate						);
+		WriteExtension( EEGL_ARB_sync						, GLEW_ARB_sync										);
+		WriteExtension( EEGL_ARB_map_buffer_range			, GLEW_ARB_map_buffer_range							);
+		WriteExtension( EEGL_ARB_timer_query				, GLEW_ARB_timer_query								);
 	}
 	else
 	#endif
@@ -182,12 +205,19 @@ void cGL::Init() {
 		WriteExtension( EEGL_ARB_pixel_buffer_object		, IsExtension( "GL_ARB_pixel_buffer_object" )		);
 		WriteExtension( EEGL_ARB_vertex_array_object		, IsExtension( "GL_ARB_vertex_array_object" )		);
 		WriteExtension( EEGL_EXT_blend_func_separate		, IsExtension( "GL_EXT_blend_func_separate" )		);
+		WriteExtension( EEGL_ARB_sync						, IsExtension( "GL_ARB_sync" )						);
+		WriteExtension( EEGL_ARB_map_buffer_range			, IsExtension( "GL_ARB_map_buffer_range" )			);
+		WriteExtension( EEGL_ARB_timer_query				, IsExtension( "GL_ARB_timer_query" )				);
 	}
 
 	// NVIDIA added support for GL_OES_compressed_ETC1_RGB8_texture in desktop GPUs
 	// GLEW doesn't return the correct result
 	WriteExtension( EEGL_OES_compressed_ETC1_RGB8_texture	, SOIL_GL_ExtensionSupported( "GL_OES_compressed_ETC1_RGB8_texture" )	);
 
+	// The ES3 compatibility brings the ETC2 and EAC formats to the desktop GPUs
+	WriteExtension( EEGL_ARB_ES3_compatibility				, IsExtension( "GL_ARB_ES3_compatibility" )				);
+	WriteExtension( EEGL_KHR_texture_compression_astc_ldr	, IsExtension( "GL_KHR_texture_compression_astc_ldr" )	);
+
 	#ifdef EE_GLES
 
 	WriteExtension( EEGL_ARB_point_parameters				, 1													);
@@ -230,6 +260,14 @@ void cGL::Init() {
 																IsExtension( "WEBKIT_WEBGL_compressed_texture_s3tc" ) ||
 																IsExtension( "MOZ_WEBGL_compressed_texture_s3tc" ) );
 	}
+
+	if ( !IsExtension( EEGL_ARB_ES3_compatibility ) ) {
+		WriteExtension( EEGL_ARB_ES3_compatibility			,	IsExtension( "WEBGL_compressed_texture_etc" ) );
+	}
+
+	if ( !IsExtension( EEGL_KHR_texture_compression_astc_ldr ) ) {
+		WriteExtension( EEGL_KHR_texture_compression_astc_ldr,	IsExtension( "WEBGL_compressed_texture_astc" ) );
+	}
 	#endif
 }
 
@@ -375,39 +413,25 @@ void cGL::Viewport( GLint x, GLint y, GLsizei width, GLsizei height ) {
 }
 
 void cGL::Disable ( GLenum cap ) {
-	switch ( cap )
-	{
-		case GL_BLEND:
-		{
-			if ( !mBlendEnabled ) {
-				return;
-			}
+	if ( GL_BLEND == cap )
+		mBlendEnabled = false;
 
-			mBlendEnabled = false;
+	if ( IssueState( !StateIs( mStateCaps, cap, false ) ) ) {
+		mStateCaps[ cap ] = false;
 
-			break;
-		}
+		glDisable( cap );
 	}
-
-	glDisable( cap );
 }
 
 void cGL::Enable( GLenum cap ) {
-	switch ( cap )
-	{
-		case GL_BLEND:
-		{
-			if ( mBlendEnabled ) {
-				return;
-			}
+	if ( GL_BLEND == cap )
+		mBlendEnabled = true;
 
-			mBlendEnabled = true;
+	if ( IssueState( !StateIs( mStateCaps, cap, true ) ) ) {
+		mStateCaps[ cap ] = true;
 
-			break;
-		}
+		glEnable( cap );
 	}
-
-	glEnable( cap );
 }
 
 const char * cGL::GetString( GLenum name ) {
@@ -442,27 +466,148 @@ void cGL::DrawElements( GLenum mode, GLsizei count, GLenum type, const GLvoid *i
 
 void cGL::BindTexture ( GLenum target, GLuint texture ) {
 	if ( GLv_3CP == Version() && 0 == texture ) return;
-	glBindTexture( target, texture );
+
+	if ( GL_TEXTURE_2D != target || mStateTextureUnit >= EE_MAX_TEXTURE_UNITS ) {
+		IssueState( true );
+
+		glBindTexture( target, texture );
+
+		return;
+	}
+
+	if ( IssueState( mStateTexture[ mStateTextureUnit ] != texture ) ) {
+		mStateTexture[ mStateTextureUnit ] = texture;
+
+		glBindTexture( target, texture );
+	}
+}
+
+void cGL::DeleteTextures ( GLsizei n, const GLuint * textures ) {
+	for ( GLsizei i = 0; i < n; i++ ) {
+		for ( Uint32 u = 0; u < EE_MAX_TEXTURE_UNITS; u++ ) {
+			if ( mStateTexture[ u ] == textures[ i ] ) {
+				mStateTexture[ u ] = 0;
+			}
+		}
+	}
+
+	glDeleteTextures( n, textures );
 }
 
 void cGL::ActiveTexture( GLenum texture ) {
-	glActiveTexture( texture );
+	Uint32 unit = texture - GL_TEXTURE0;
+
+	if ( IssueState( mStateTextureUnit != unit ) ) {
+		mStateTextureUnit = unit < EE_MAX_TEXTURE_UNITS ? unit : EEGL_STATE_UNKNOWN;
+
+		glActiveTexture( texture );
+	}
 }
 
 void cGL::BlendFunc ( GLenum sfactor, GLenum dfactor ) {
-	glBlendFunc( sfactor, dfactor );
+	if ( IssueState( mStateBlend[0] != sfactor || mStateBlend[1] != dfactor || mStateBlend[2] != sfactor || mStateBlend[3] != dfactor ) ) {
+		mStateBlend[0] = mStateBlend[2] = sfactor;
+		mStateBlend[1] = mStateBlend[3] = dfactor;
+
+		glBlendFunc( sfactor, dfactor );
+	}
+}
+
+void cGL::BlendFuncSeparate ( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha ) {
+	if ( IssueState( mStateBlend[0] != sfactorRGB || mStateBlend[1] != dfactorRGB || mStateBlend[2] != sfactorAlpha || mStateBlend[3] != dfactorAlpha ) ) {
+		mStateBlend[0] = sfactorRGB;
+		mStateBlend[1] = dfactorRGB;
+		mStateBlend[2] = sfactorAlpha;
+		mStateBlend[3] = dfactorAlpha;
+
+		glBlendFuncSeparateEXT( sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha );
+	}
 }
 
 void cGL::SetShader( cShaderProgram * Shader ) {
 	#ifdef EE_SHADERS_SUPPORTED
-	if ( NULL != Shader ) {
-		glUseProgram( Shader->Handler() );
-	} else {
-		glUseProgram( 0 );
+	GLuint program = NULL != Shader ? Shader->Handler() : 0;
+
+	if ( IssueState( mStateProgram != program ) ) {
+		mStateProgram = program;
+
+		glUseProgram( program );
 	}
 	#endif
 }
 
+void cGL::StateFilter( const bool& enabled ) {
+	mStateFilter = enabled;
+}
+
+const bool& cGL::StateFilter() const {
+	return mStateFilter;
+}
+
+const Uint32& cGL::StateChangesIssued() const {
+	return mStateChangesIssued;
+}
+
+const Uint32& cGL::StateChangesDropped() const {
+	return mStateChangesDropped;
+}
+
+void cGL::ResetStateChangesStats() {
+	mStateChangesIssued		= 0;
+	mStateChangesDropped	= 0;
+}
+
+void cGL::InvalidateStateCache() {
+	for ( Uint32 i = 0; i < EE_MAX_TEXTURE_UNITS; i++ ) {
+		mStateTexture[ i ] = EEGL_STATE_UNKNOWN;
+	}
+
+	for ( Uint32 i = 0; i < 4; i++ ) {
+		mStateBlend[ i ] = EEGL_STATE_UNKNOWN;
+	}
+
+	mStateProgram	= EEGL_STATE_UNKNOWN;
+	mLineWidth		= -1;
+
+	mStateCaps.clear();
+}
+
+void cGL::InvalidateStateCacheDeferred() {
+	mStateCacheDirty = true;
+}
+
+void cGL::UpdateStateCache() {
+	if ( mStateCacheDirty ) {
+		mStateCacheDirty = false;
+
+		InvalidateStateCache();
+	}
+}
+
+Uint32 cGL::MultiTextureUnits() {
+	return 1;
+}
+
+bool cGL::MultiTextureShader( const bool& enable ) {
+	return false;
+}
+
+bool cGL::IssueState( const bool& changed ) {
+	if ( changed || !mStateFilter ) {
+		mStateChangesIssued++;
+		return true;
+	}
+
+	mStateChangesDropped++;
+	return false;
+}
+
+bool cGL::StateIs( const std::map<GLenum, bool>& States, const GLenum& cap, const bool& enabled ) {
+	std::map<GLenum, bool>::const_iterator it = States.find( cap );
+
+	return it != States.end() && it->second == enabled;
+}
+
 bool cGL::IsLineSmooth() {
 	return BitOp::ReadBitKey( &mStateFlags, GLSF_LINE_SMOOTH );
 }
@@ -484,7 +629,7 @@ void cGL::LineSmooth( const bool& Enable ) {
 }
 
 void cGL::LineWidth(GLfloat width) {
-	if ( width != mLineWidth ) {
+	if ( IssueState( width != mLineWidth ) ) {
 		#if EE_PLATFORM != EE_PLATFORM_EMSCRIPTEN
 		if ( GLv_3CP != Version() )
 		#endif
@@ -640,6 +785,10 @@ void cGL::GenVertexArrays ( GLsizei n, GLuint *arrays ) {
 #endif
 }
 
+const GLuint& cGL::GetCurrentVertexArray() const {
+	return mCurVAO;
+}
+
 const bool& cGL::QuadsSupported() const {
 	return mQuadsSupported;
 }
@@ -51,7 +51,9 @@ namespace EE { namespace Graphics {
 	#endif
 #endif
 
-cRendererGL::cRendererGL() {
+cRendererGL::cRendererGL() :
+	mPointSize( -1 )
+{
 	#ifdef EE_GLES1
 	mQuadsSupported = false;
 	mQuadVertexs = 6;
@@ -198,11 +200,19 @@ void cRendererGL::Perspective ( GLfloat fovy, GLfloat aspect, GLfloat zNear, GLf
 }
 
 void cRendererGL::EnableClientState( GLenum array ) {
-	glEnableClientState( array );
+	if ( IssueState( !StateIs( mClientStates, array, true ) ) ) {
+		mClientStates[ array ] = true;
+
+		glEnableClientState( array );
+	}
 }
 
 void cRendererGL::DisableClientState( GLenum array ) {
-	glDisableClientState( array );
+	if ( IssueState( !StateIs( mClientStates, array, false ) ) ) {
+		mClientStates[ array ] = false;
+
+		glDisableClientState( array );
+	}
 }
 
 void cRendererGL::VertexPointer ( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer, GLuint allocate ) {
@@ -217,6 +227,14 @@ void cRendererGL::TexCoordPointer ( GLint size, GLenum type, GLsizei stride, con
 	glTexCoordPointer( size, type, stride, pointer );
 }
 
+void cRendererGL::InvalidateStateCache() {
+	cGL::InvalidateStateCache();
+
+	mClientStates.clear();
+
+	mPointSize = -1;
+}
+
 void cRendererGL::ClientActiveTexture( GLenum texture ) {
 	glClientActiveTexture( texture );
 }
@@ -43,6 +43,12 @@ const GLchar * EEGL3_SHADER_BASE_VS =
 const GLchar * EEGL3_SHADER_BASE_FS =
 #include "shaders/basegl3.frag"
 
+const GLchar * EEGL3_SHADER_MULTITEXTURE_VS =
+#include "shaders/multitexture.vert"
+
+const GLchar * EEGL3_SHADER_MULTITEXTURE_FS =
+#include "shaders/multitexture.frag"
+
 cRendererGL3::cRendererGL3() :
 	mProjectionMatrix_id(0),
 	mModelViewMatrix_id(0),
@@ -112,6 +118,12 @@ void cRendererGL3::Init() {
 		mShaders[ EEGL3_SHADER_BASE ]			= cShaderProgram::New( vs.c_str(), vs.size(), fs.c_str(), fs.size() );
 		mShaders[ EEGL3_SHADER_BASE ]->SetReloadCb( cb::Make1( this, &cRendererGL3::ReloadShader ) );
 
+		vs = EEGL3_SHADER_MULTITEXTURE_VS;
+		fs = EEGL3_SHADER_MULTITEXTURE_FS;
+
+		mShaders[ EEGL3_SHADER_MULTITEXTURE ]	= cShaderProgram::New( vs.c_str(), vs.size(), fs.c_str(), fs.size() );
+		mShaders[ EEGL3_SHADER_MULTITEXTURE ]->SetReloadCb( cb::Make1( this, &cRendererGL3::ReloadShader ) );
+
 		cShader::Ensure( true );
 
 		SetShader( EEGL3_SHADER_BASE );
@@ -119,6 +131,7 @@ void cRendererGL3::Init() {
 		mCurShader = NULL;
 
 		mShaders[ EEGL3_SHADER_BASE ]->Reload();
+		mShaders[ EEGL3_SHADER_MULTITEXTURE ]->Reload();
 
 		SetShader( EEGL3_SHADER_BASE );
 	}
@@ -151,7 +164,7 @@ void cRendererGL3::SetShader( cShaderProgram * Shader ) {
 		Shader = mShaders[ EEGL3_SHADER_BASE ];
 	}
 
-	if ( mCurShader == Shader ) {
+	if ( !IssueState( mCurShader != Shader ) ) {
 		return;
 	}
 
@@ -202,9 +215,11 @@ void cRendererGL3::SetShader( cShaderProgram * Shader ) {
 	MatrixMode( CM );
 
 	if ( -1 != mTexActiveLoc ) {
-		mCurShader->SetUniform( mTexActiveLoc, 1 );
+		mCurShader->SetUniform( mTexActiveLoc, mTexActive );
 	}
 
+	mCurShader->SetUniform( "dgl_PointSize", mPointSize );
+
 	mCurShader->SetUniform( mClippingEnabledLoc, 0 );
 
 	for ( i = 0; i < EE_MAX_PLANES; i++ ) {
@@ -218,11 +233,47 @@ void cRendererGL3::SetShader( cShaderProgram * Shader ) {
 	}
 }
 
+Uint32 cRendererGL3::MultiTextureUnits() {
+	return mShaders[ EEGL3_SHADER_MULTITEXTURE ]->IsValid() ? EE_MAX_TEXTURE_UNITS : 1;
+}
+
+bool cRendererGL3::MultiTextureShader( const bool& enable ) {
+	cShaderProgram * Multi = mShaders[ EEGL3_SHADER_MULTITEXTURE ];
+
+	if ( !enable ) {
+		if ( mCurShader == Multi ) {
+			SetShader( EEGL3_SHADER_BASE );
+		}
+
+		return true;
+	}
+
+	if ( mCurShader != mShaders[ EEGL3_SHADER_BASE ] || !Multi->IsValid() ) {
+		return mCurShader == Multi;
+	}
+
+	// The multi-texture shader doesn't clip
+	for ( Uint32 i = 0; i < EE_MAX_PLANES; i++ ) {
+		if ( 0 != mPlanesStates[ i ] ) {
+			return false;
+		}
+	}
+
+	SetShader( Multi );
+
+	Multi->SetUniform( "textureUnit0", 0 );
+	Multi->SetUniform( "textureUnit1", 1 );
+	Multi->SetUniform( "textureUnit2", 2 );
+	Multi->SetUniform( "textureUnit3", 3 );
+
+	return true;
+}
+
 void cRendererGL3::Enable( GLenum cap ) {
 	switch ( cap ) {
 		case GL_TEXTURE_2D:
 		{
-			if ( 0 == mTexActive ) {
+			if ( IssueState( 0 == mTexActive ) ) {
 				mTexActive = 1;
 
 				mCurShader->SetUniform( mTexActiveLoc, mTexActive );
@@ -239,7 +290,7 @@ void cRendererGL3::Enable( GLenum cap ) {
 		{
 			GLint plane = cap - GL_CLIP_PLANE0;
 
-			if ( 0 == mPlanesStates[ plane ] ) {
+			if ( IssueState( 0 == mPlanesStates[ plane ] ) ) {
 				mPlanesStates[ plane ] = 1;
 
 				PlaneStateCheck( true );
@@ -264,7 +315,7 @@ void cRendererGL3::Disable ( GLenum cap ) {
 	switch ( cap ) {
 		case GL_TEXTURE_2D:
 		{
-			if ( 1 == mTexActive ) {
+			if ( IssueState( 1 == mTexActive ) ) {
 				mTexActive = 0;
 
 				mCurShader->SetUniform( mTexActiveLoc, mTexActive );
@@ -281,7 +332,7 @@ void cRendererGL3::Disable ( GLenum cap ) {
 		{
 			GLint plane = cap - GL_CLIP_PLANE0;
 
-			if ( 1 == mPlanesStates[ plane ] ) {
+			if ( IssueState( 1 == mPlanesStates[ plane ] ) ) {
 				mPlanesStates[ plane ] = 0;
 
 				PlaneStateCheck( false );
@@ -306,7 +357,7 @@ void cRendererGL3::EnableClientState( GLenum array ) {
 	GLint state;
 
 	if ( GL_TEXTURE_COORD_ARRAY == array ) {
-		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) ) {
+		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) && IssueState( 1 != mTextureUnitsStates[ mCurActiveTex ] ) ) {
 			mTextureUnitsStates[ mCurActiveTex ] = 1;
 
 			glEnableVertexAttribArray( state );
@@ -314,7 +365,7 @@ void cRendererGL3::EnableClientState( GLenum array ) {
 	} else {
 		Int32 Pos = array - GL_VERTEX_ARRAY;
 
-		if ( -1 != ( state = mAttribsLoc[ Pos ] ) ) {
+		if ( -1 != ( state = mAttribsLoc[ Pos ] ) && IssueState( 1 != mAttribsLocStates[ Pos ] ) ) {
 			mAttribsLocStates[ Pos ] = 1;
 
 			glEnableVertexAttribArray( state );
@@ -326,7 +377,7 @@ void cRendererGL3::DisableClientState( GLenum array ) {
 	GLint state;
 
 	if ( GL_TEXTURE_COORD_ARRAY == array ) {
-		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) ) {
+		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) && IssueState( 0 != mTextureUnitsStates[ mCurActiveTex ] ) ) {
 			mTextureUnitsStates[ mCurActiveTex ] = 0;
 
 			glDisableVertexAttribArray( state );
@@ -334,7 +385,7 @@ void cRendererGL3::DisableClientState( GLenum array ) {
 	} else {
 		Int32 Pos = array - GL_VERTEX_ARRAY;
 
-		if ( -1 != ( state = mAttribsLoc[ Pos ] ) ) {
+		if ( -1 != ( state = mAttribsLoc[ Pos ] ) && IssueState( 0 != mAttribsLocStates[ Pos ] ) ) {
 			mAttribsLocStates[ Pos ] = 0;
 
 			glDisableVertexAttribArray( state );
@@ -346,7 +397,7 @@ void cRendererGL3::VertexPointer ( GLint size, GLenum type, GLsizei stride, cons
 	const GLint index = mAttribsLoc[ EEGL_VERTEX_ARRAY ];
 
 	if ( -1 != index ) {
-		if ( 0 == mAttribsLocStates[ EEGL_VERTEX_ARRAY ] ) {
+		if ( 1 != mAttribsLocStates[ EEGL_VERTEX_ARRAY ] ) {
 			mAttribsLocStates[ EEGL_VERTEX_ARRAY ] = 1;
 
 			glEnableVertexAttribArray( index );
@@ -360,7 +411,7 @@ void cRendererGL3::ColorPointer ( GLint size, GLenum type, GLsizei stride, const
 	const GLint index = mAttribsLoc[ EEGL_COLOR_ARRAY ];
 
 	if ( -1 != index ) {
-		if ( 0 == mAttribsLocStates[ EEGL_COLOR_ARRAY ] ) {
+		if ( 1 != mAttribsLocStates[ EEGL_COLOR_ARRAY ] ) {
 			mAttribsLocStates[ EEGL_COLOR_ARRAY ] = 1;
 
 			glEnableVertexAttribArray( index );
@@ -378,13 +429,18 @@ void cRendererGL3::TexCoordPointer ( GLint size, GLenum type, GLsizei stride, co
 	const GLint index = mTextureUnits[ mCurActiveTex ];
 
 	if ( -1 != index ) {
-		if ( 0 == mTextureUnitsStates[ mCurActiveTex ] ) {
+		if ( 1 != mTextureUnitsStates[ mCurActiveTex ] ) {
 			mTextureUnitsStates[ mCurActiveTex ] = 1;
 
 			glEnableVertexAttribArray( index );
 		}
 
-		glVertexAttribPointerARB( index, size, type, GL_FALSE, stride, pointer );
+		// The packed vertexs send the texture coordinates as normalized 16 bits integers
+		if ( type == GL_UNSIGNED_SHORT ) {
+			glVertexAttribPointerARB( index, size, type, GL_TRUE, stride, pointer );
+		} else {
+			glVertexAttribPointerARB( index, size, type, GL_FALSE, stride, pointer );
+		}
 	}
 }
 
@@ -591,9 +647,23 @@ void cRendererGL3::Clip2DPlaneDisable() {
 }
 
 void cRendererGL3::PointSize( GLfloat size ) {
-	mCurShader->SetUniform( "dgl_PointSize", size );
+	if ( IssueState( mPointSize != size ) ) {
+		mCurShader->SetUniform( "dgl_PointSize", size );
+
+		mPointSize = size;
+	}
+}
 
-	mPointSize = size;
+void cRendererGL3::InvalidateStateCache() {
+	cGL::InvalidateStateCache();
+
+	for ( Uint32 i = 0; i < EEGL_ARRAY_STATES_COUNT; i++ ) {
+		mAttribsLocStates[ i ] = -1;
+	}
+
+	for ( Uint32 i = 0; i < EE_MAX_TEXTURE_UNITS; i++ ) {
+		mTextureUnitsStates[ i ] = -1;
+	}
 }
 
 void cRendererGL3::ClipPlane( GLenum plane, const GLdouble * equation ) {
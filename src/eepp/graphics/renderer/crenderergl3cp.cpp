@@ -181,7 +181,7 @@ void cRendererGL3CP::SetShader( cShaderProgram * Shader ) {
 		Shader = mShaders[ EEGL3CP_SHADER_BASE ];
 	}
 
-	if ( mCurShader == Shader ) {
+	if ( !IssueState( mCurShader != Shader ) ) {
 		return;
 	}
 
@@ -232,9 +232,11 @@ void cRendererGL3CP::SetShader( cShaderProgram * Shader ) {
 	MatrixMode( CM );
 
 	if ( -1 != mTexActiveLoc ) {
-		mCurShader->SetUniform( mTexActiveLoc, 1 );
+		mCurShader->SetUniform( mTexActiveLoc, mTexActive );
 	}
 
+	mCurShader->SetUniform( "dgl_PointSize", mPointSize );
+
 	mCurShader->SetUniform( mClippingEnabledLoc, 0 );
 
 	for ( i = 0; i < EE_MAX_PLANES; i++ ) {
@@ -252,7 +254,7 @@ void cRendererGL3CP::Enable( GLenum cap ) {
 	switch ( cap ) {
 		case GL_TEXTURE_2D:
 		{
-			if ( 0 == mTexActive ) {
+			if ( IssueState( 0 == mTexActive ) ) {
 				mTexActive = 1;
 
 				mCurShader->SetUniform( mTexActiveLoc, mTexActive );
@@ -270,7 +272,7 @@ void cRendererGL3CP::Enable( GLenum cap ) {
 		{
 			GLint plane = cap - GL_CLIP_PLANE0;
 
-			if ( 0 == mPlanesStates[ plane ] ) {
+			if ( IssueState( 0 == mPlanesStates[ plane ] ) ) {
 				mPlanesStates[ plane ] = 1;
 
 				PlaneStateCheck( true );
@@ -295,7 +297,7 @@ void cRendererGL3CP::Disable ( GLenum cap ) {
 	switch ( cap ) {
 		case GL_TEXTURE_2D:
 		{
-			if ( 1 == mTexActive ) {
+			if ( IssueState( 1 == mTexActive ) ) {
 				mTexActive = 0;
 
 				mCurShader->SetUniform( mTexActiveLoc, mTexActive );
@@ -311,7 +313,7 @@ void cRendererGL3CP::Disable ( GLenum cap ) {
 		{
 			GLint plane = cap - GL_CLIP_PLANE0;
 
-			if ( 1 == mPlanesStates[ plane ] ) {
+			if ( IssueState( 1 == mPlanesStates[ plane ] ) ) {
 				mPlanesStates[ plane ] = 0;
 
 				PlaneStateCheck( false );
@@ -336,7 +338,7 @@ void cRendererGL3CP::EnableClientState( GLenum array ) {
 	GLint state;
 
 	if ( GL_TEXTURE_COORD_ARRAY == array ) {
-		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) ) {
+		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) && IssueState( 1 != mTextureUnitsStates[ mCurActiveTex ] ) ) {
 			mTextureUnitsStates[ mCurActiveTex ] = 1;
 
 			glEnableVertexAttribArray( state );
@@ -344,7 +346,7 @@ void cRendererGL3CP::EnableClientState( GLenum array ) {
 	} else {
 		Int32 Pos = array - GL_VERTEX_ARRAY;
 
-		if ( -1 != ( state = mAttribsLoc[ Pos ] ) ) {
+		if ( -1 != ( state = mAttribsLoc[ Pos ] ) && IssueState( 1 != mAttribsLocStates[ Pos ] ) ) {
 			mAttribsLocStates[ Pos ] = 1;
 
 			glEnableVertexAttribArray( state );
@@ -356,7 +358,7 @@ void cRendererGL3CP::DisableClientState( GLenum array ) {
 	GLint state;
 
 	if ( GL_TEXTURE_COORD_ARRAY == array ) {
-		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) ) {
+		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) && IssueState( 0 != mTextureUnitsStates[ mCurActiveTex ] ) ) {
 			mTextureUnitsStates[ mCurActiveTex ] = 0;
 
 			glDisableVertexAttribArray( state );
@@ -364,7 +366,7 @@ void cRendererGL3CP::DisableClientState( GLenum array ) {
 	} else {
 		Int32 Pos = array - GL_VERTEX_ARRAY;
 
-		if ( -1 != ( state = mAttribsLoc[ Pos ] ) ) {
+		if ( -1 != ( state = mAttribsLoc[ Pos ] ) && IssueState( 0 != mAttribsLocStates[ Pos ] ) ) {
 			mAttribsLocStates[ Pos ] = 0;
 
 			glDisableVertexAttribArray( state );
@@ -389,7 +391,7 @@ void cRendererGL3CP::VertexPointer ( GLint size, GLenum type, GLsizei stride, co
 		glBindBufferARB( GL_ARRAY_BUFFER, mVBO[ EEGL_VERTEX_ARRAY ]			);
 		glBufferSubDataARB( GL_ARRAY_BUFFER, 0, allocate, pointer );
 
-		if ( 0 == mAttribsLocStates[ EEGL_VERTEX_ARRAY ] ) {
+		if ( 1 != mAttribsLocStates[ EEGL_VERTEX_ARRAY ] ) {
 			mAttribsLocStates[ EEGL_VERTEX_ARRAY ] = 1;
 
 			glEnableVertexAttribArray( index );
@@ -420,7 +422,7 @@ void cRendererGL3CP::ColorPointer ( GLint size, GLenum type, GLsizei stride, con
 		glBindBufferARB( GL_ARRAY_BUFFER, mVBO[ EEGL_COLOR_ARRAY ]				);
 		glBufferSubDataARB( GL_ARRAY_BUFFER, 0, allocate, pointer );
 
-		if ( 0 == mAttribsLocStates[ EEGL_COLOR_ARRAY ] ) {
+		if ( 1 != mAttribsLocStates[ EEGL_COLOR_ARRAY ] ) {
 			mAttribsLocStates[ EEGL_COLOR_ARRAY ] = 1;
 
 			glEnableVertexAttribArray( index );
@@ -451,13 +453,18 @@ void cRendererGL3CP::TexCoordPointer ( GLint size, GLenum type, GLsizei stride,
 		glBindBufferARB( GL_ARRAY_BUFFER, mCurTexCoordArray );
 		glBufferSubDataARB( GL_ARRAY_BUFFER, 0, allocate, pointer );
 
-		if ( 0 == mTextureUnitsStates[ mCurActiveTex ] ) {
+		if ( 1 != mTextureUnitsStates[ mCurActiveTex ] ) {
 			mTextureUnitsStates[ mCurActiveTex ] = 1;
 
 			glEnableVertexAttribArray( index );
 		}
 
-		glVertexAttribPointerARB( index, size, type, GL_FALSE, stride, 0 );
+		// The packed vertexs send the texture coordinates as normalized 16 bits integers
+		if ( type == GL_UNSIGNED_SHORT ) {
+			glVertexAttribPointerARB( index, size, type, GL_TRUE, stride, 0 );
+		} else {
+			glVertexAttribPointerARB( index, size, type, GL_FALSE, stride, 0 );
+		}
 	}
 }
 
@@ -664,9 +671,23 @@ void cRendererGL3CP::Clip2DPlaneDisable() {
 }
 
 void cRendererGL3CP::PointSize( GLfloat size ) {
-	mCurShader->SetUniform( "dgl_PointSize", size );
+	if ( IssueState( mPointSize != size ) ) {
+		mCurShader->SetUniform( "dgl_PointSize", size );
+
+		mPointSize = size;
+	}
+}
+
+void cRendererGL3CP::InvalidateStateCache() {
+	cGL::InvalidateStateCache();
 
-	mPointSize = size;
+	for ( Uint32 i = 0; i < EEGL_ARRAY_STATES_COUNT; i++ ) {
+		mAttribsLocStates[ i ] = -1;
+	}
+
+	for ( Uint32 i = 0; i < EE_MAX_TEXTURE_UNITS; i++ ) {
+		mTextureUnitsStates[ i ] = -1;
+	}
 }
 
 void cRendererGL3CP::ClipPlane( GLenum plane, const GLdouble * equation ) {
@@ -61,6 +61,12 @@ const GLchar * EEGLES2_SHADER_PRIMITIVE_VS =
 const GLchar * EEGLES2_SHADER_PRIMITIVE_FS =
 #include "shaders/primitive.frag"
 
+const GLchar * EEGLES2_SHADER_MULTITEXTURE_VS =
+#include "shaders/multitexture.vert"
+
+const GLchar * EEGLES2_SHADER_MULTITEXTURE_FS =
+#include "shaders/multitexture.frag"
+
 cRendererGLES2::cRendererGLES2() :
 	mStack( eeNew( cMatrixStack, () ) ),
 	mProjectionMatrix_id(0),
@@ -146,6 +152,12 @@ void cRendererGLES2::Init() {
 		mShaders[ EEGLES2_SHADER_PRIMITIVE ]		= cShaderProgram::New( vs.c_str(), vs.size(), fs.c_str(), fs.size() );
 		mShaders[ EEGLES2_SHADER_PRIMITIVE ]->SetReloadCb( cb::Make1( this, &cRendererGLES2::ReloadShader ) );
 
+		vs = EEGLES2_SHADER_MULTITEXTURE_VS;
+		fs = EEGLES2_SHADER_MULTITEXTURE_FS;
+
+		mShaders[ EEGLES2_SHADER_MULTITEXTURE ]		= cShaderProgram::New( vs.c_str(), vs.size(), fs.c_str(), fs.size() );
+		mShaders[ EEGLES2_SHADER_MULTITEXTURE ]->SetReloadCb( cb::Make1( this, &cRendererGLES2::ReloadShader ) );
+
 		cShader::Ensure( true );
 
 		SetShader( EEGLES2_SHADER_BASE );
@@ -196,7 +208,7 @@ void cRendererGLES2::SetShader( cShaderProgram * Shader ) {
 		Shader = mShaders[ EEGLES2_SHADER_BASE ];
 	}
 
-	if ( mCurShader == Shader ) {
+	if ( !IssueState( mCurShader != Shader ) ) {
 		return;
 	}
 
@@ -256,6 +268,8 @@ void cRendererGLES2::SetShader( cShaderProgram * Shader ) {
 		mCurShader->SetUniform( mTexActiveLoc, mTexActive );
 	}
 
+	mCurShader->SetUniform( "dgl_PointSize", mPointSize );
+
 	if ( -1 != mClippingEnabledLoc ) {
 		mCurShader->SetUniform( mClippingEnabledLoc, 0 );
 	}
@@ -267,11 +281,41 @@ void cRendererGLES2::SetShader( cShaderProgram * Shader ) {
 	}
 }
 
+Uint32 cRendererGLES2::MultiTextureUnits() {
+	return mShaders[ EEGLES2_SHADER_MULTITEXTURE ]->IsValid() ? EE_MAX_TEXTURE_UNITS : 1;
+}
+
+bool cRendererGLES2::MultiTextureShader( const bool& enable ) {
+	cShaderProgram * Multi = mShaders[ EEGLES2_SHADER_MULTITEXTURE ];
+
+	if ( !enable ) {
+		if ( mCurShader == Multi ) {
+			SetShader( mTexActive ? EEGLES2_SHADER_BASE : EEGLES2_SHADER_PRIMITIVE );
+		}
+
+		return true;
+	}
+
+	// Only replaces the textured base shader, the clipped and point sprite shaders are kept
+	if ( mCurShader != mShaders[ EEGLES2_SHADER_BASE ] || !Multi->IsValid() ) {
+		return mCurShader == Multi;
+	}
+
+	SetShader( Multi );
+
+	Multi->SetUniform( "textureUnit0", 0 );
+	Multi->SetUniform( "textureUnit1", 1 );
+	Multi->SetUniform( "textureUnit2", 2 );
+	Multi->SetUniform( "textureUnit3", 3 );
+
+	return true;
+}
+
 void cRendererGLES2::Enable( GLenum cap ) {
 	switch ( cap ) {
 		case GL_TEXTURE_2D:
 		{
-			if ( 0 == mTexActive ) {
+			if ( IssueState( 0 == mTexActive ) ) {
 				mTexActive = 1;
 
 				SetShader( EEGLES2_SHADER_BASE );
@@ -317,7 +361,7 @@ void cRendererGLES2::Disable ( GLenum cap ) {
 	switch ( cap ) {
 		case GL_TEXTURE_2D:
 		{
-			if ( 1 == mTexActive ) {
+			if ( IssueState( 1 == mTexActive ) ) {
 				mTexActive = 0;
 
 				SetShader( EEGLES2_SHADER_PRIMITIVE );
@@ -365,7 +409,7 @@ void cRendererGLES2::EnableClientState( GLenum array ) {
 	GLint state;
 
 	if ( GL_TEXTURE_COORD_ARRAY == array ) {
-		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) ) {
+		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) && IssueState( 1 != mTextureUnitsStates[ mCurActiveTex ] ) ) {
 			mTextureUnitsStates[ mCurActiveTex ] = 1;
 
 			glEnableVertexAttribArray( state );
@@ -373,7 +417,7 @@ void cRendererGLES2::EnableClientState( GLenum array ) {
 	} else {
 		Int32 Pos = array - GL_VERTEX_ARRAY;
 
-		if ( -1 != ( state = mAttribsLoc[ Pos ] ) ) {
+		if ( -1 != ( state = mAttribsLoc[ Pos ] ) && IssueState( 1 != mAttribsLocStates[ Pos ] ) ) {
 			mAttribsLocStates[ Pos ] = 1;
 
 			glEnableVertexAttribArray( state );
@@ -385,7 +429,7 @@ void cRendererGLES2::DisableClientState( GLenum array ) {
 	GLint state;
 
 	if ( GL_TEXTURE_COORD_ARRAY == array ) {
-		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) ) {
+		if ( -1 != ( state = mTextureUnits[ mCurActiveTex ] ) && IssueState( 0 != mTextureUnitsStates[ mCurActiveTex ] ) ) {
 			mTextureUnitsStates[ mCurActiveTex ] = 0;
 
 			glDisableVertexAttribArray( state );
@@ -393,7 +437,7 @@ void cRendererGLES2::DisableClientState( GLenum array ) {
 	} else {
 		Int32 Pos = array - GL_VERTEX_ARRAY;
 
-		if ( -1 != ( state = mAttribsLoc[ Pos ] ) ) {
+		if ( -1 != ( state = mAttribsLoc[ Pos ] ) && IssueState( 0 != mAttribsLocStates[ Pos ] ) ) {
 			mAttribsLocStates[ Pos ] = 0;
 
 			glDisableVertexAttribArray( state );
@@ -405,7 +449,7 @@ void cRendererGLES2::VertexPointer ( GLint size, GLenum type, GLsizei stride, co
 	const GLint index = mAttribsLoc[ EEGL_VERTEX_ARRAY ];
 
 	if ( -1 != index ) {
-		if ( 0 == mAttribsLocStates[ EEGL_VERTEX_ARRAY ] ) {
+		if ( 1 != mAttribsLocStates[ EEGL_VERTEX_ARRAY ] ) {
 			mAttribsLocStates[ EEGL_VERTEX_ARRAY ] = 1;
 
 			glEnableVertexAttribArray( index );
@@ -419,7 +463,7 @@ void cRendererGLES2::ColorPointer ( GLint size, GLenum type, GLsizei stride, con
 	const GLint index = mAttribsLoc[ EEGL_COLOR_ARRAY ];
 
 	if ( -1 != index ) {
-		if ( 0 == mAttribsLocStates[ EEGL_COLOR_ARRAY ] ) {
+		if ( 1 != mAttribsLocStates[ EEGL_COLOR_ARRAY ] ) {
 			mAttribsLocStates[ EEGL_COLOR_ARRAY ] = 1;
 
 			glEnableVertexAttribArray( index );
@@ -451,13 +495,18 @@ void cRendererGLES2::TexCoordPointer ( GLint size, GLenum type, GLsizei stride,
 	const GLint index = mTextureUnits[ mCurActiveTex ];
 
 	if ( -1 != index ) {
-		if ( 0 == mTextureUnitsStates[ mCurActiveTex ] ) {
+		if ( 1 != mTextureUnitsStates[ mCurActiveTex ] ) {
 			mTextureUnitsStates[ mCurActiveTex ] = 1;
 
 			glEnableVertexAttribArray( index );
 		}
 
-		glVertexAttribPointerARB( index, size, type, GL_FALSE, stride, pointer );
+		// The packed vertexs send the texture coordinates as normalized 16 bits integers
+		if ( type == GL_UNSIGNED_SHORT ) {
+			glVertexAttribPointerARB( index, size, type, GL_TRUE, stride, pointer );
+		} else {
+			glVertexAttribPointerARB( index, size, type, GL_FALSE, stride, pointer );
+		}
 	}
 }
 
@@ -667,6 +716,10 @@ void cRendererGLES2::Clip2DPlaneDisable() {
 }
 
 void cRendererGLES2::PointSize( GLfloat size ) {
+	if ( !IssueState( mPointSize != size ) ) {
+		return;
+	}
+
 	#if !defined( EE_GLES2 ) && EE_PLATFORM != EE_PLATFORM_EMSCRIPTEN
 	glPointSize( size );
 	#endif
@@ -676,6 +729,18 @@ void cRendererGLES2::PointSize( GLfloat size ) {
 	mPointSize = size;
 }
 
+void cRendererGLES2::InvalidateStateCache() {
+	cGL::InvalidateStateCache();
+
+	for ( Uint32 i = 0; i < EEGL_ARRAY_STATES_COUNT; i++ ) {
+		mAttribsLocStates[ i ] = -1;
+	}
+
+	for ( Uint32 i = 0; i < EE_MAX_TEXTURE_UNITS; i++ ) {
+		mTextureUnitsStates[ i ] = -1;
+	}
+}
+
 void cRendererGLES2::ClipPlane( GLenum plane, const GLdouble * equation ) {
 	Int32 nplane	= plane - GL_CLIP_PLANE0;
 	Int32 location;
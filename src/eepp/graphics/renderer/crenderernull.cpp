@@ -0,0 +1,552 @@
+#include <eepp/graphics/renderer/crenderernull.hpp>
+#include <eepp/graphics/renderer/rendererhelper.hpp>
+
+namespace EE { namespace Graphics {
+
+cGLCommand::cGLCommand( EEGL_COMMAND cmd ) :
+	Cmd( cmd )
+{
+	for ( Uint32 i = 0; i < 4; i++ ) {
+		Params[i]	= 0;
+		FParams[i]	= 0;
+	}
+}
+
+cGLFrameStats::cGLFrameStats() {
+	Reset();
+}
+
+void cGLFrameStats::Reset() {
+	DrawCalls				= 0;
+	Vertexs					= 0;
+	TextureBinds			= 0;
+	StateChanges			= 0;
+	RedundantStateChanges	= 0;
+	MatrixOperations		= 0;
+}
+
+cRendererNull::cRendererNull() :
+	mStack( eeNew( cMatrixStack, () ) ),
+	mCurrentMode( GL_MODELVIEW ),
+	mFrames( 0 ),
+	mRecord( true ),
+	mActiveTexture( 0 ),
+	mBlendSrc( GL_ONE ),
+	mBlendDst( GL_ZERO ),
+	mBlendSrcAlpha( GL_ONE ),
+	mBlendDstAlpha( GL_ZERO ),
+	mPointSize( 1.f ),
+	mCurShader( NULL ),
+	mMultiTexture( false )
+{
+	mStack->mProjectionMatrix.push	( glm::mat4( 1.0f ) ); // identity matrix
+	mStack->mModelViewMatrix.push	( glm::mat4( 1.0f ) ); // identity matrix
+	mStack->mCurMatrix				= &mStack->mModelViewMatrix;
+
+	for ( Uint32 i = 0; i < EE_MAX_TEXTURE_UNITS; i++ )
+		mBoundTexture[i] = 0;
+
+	for ( Uint32 i = 0; i < 4; i++ )
+		mViewport[i] = 0;
+}
+
+cRendererNull::~cRendererNull() {
+	eeSAFE_DELETE( mStack );
+}
+
+EEGL_version cRendererNull::Version() {
+	return GLv_NULL;
+}
+
+std::string cRendererNull::VersionStr() {
+	return "Null Renderer";
+}
+
+void cRendererNull::Init() {
+	// There is no context to query, so no extension is reported.
+	mExtensions = 0;
+}
+
+void cRendererNull::QuadsSupported( const bool& supported ) {
+	mQuadsSupported	= supported;
+	mQuadVertexs	= supported ? 4 : 6;
+}
+
+void cRendererNull::RecordCommands( const bool& record ) {
+	mRecord = record;
+}
+
+const bool& cRendererNull::RecordCommands() const {
+	return mRecord;
+}
+
+const std::vector<cGLCommand>& cRendererNull::GetCommands() const {
+	return mCommands;
+}
+
+const std::vector<cGLCommand>& cRendererNull::GetLastFrameCommands() const {
+	return mLastCommands;
+}
+
+const cGLFrameStats& cRendererNull::GetFrameStats() const {
+	return mStats;
+}
+
+const cGLFrameStats& cRendererNull::GetLastFrameStats() const {
+	return mLastStats;
+}
+
+const Uint32& cRendererNull::GetFrameCount() const {
+	return mFrames;
+}
+
+void cRendererNull::EndFrame() {
+	mLastCommands.swap( mCommands );
+	mCommands.clear();
+
+	mLastStats = mStats;
+	mStats.Reset();
+
+	mFrames++;
+}
+
+cGLCommand& cRendererNull::Record( EEGL_COMMAND cmd ) {
+	static cGLCommand Discarded;
+
+	if ( !mRecord ) {
+		return Discarded;
+	}
+
+	mCommands.push_back( cGLCommand( cmd ) );
+
+	return mCommands.back();
+}
+
+void cRendererNull::StateChange( const bool& redundant ) {
+	mStats.StateChanges++;
+
+	if ( redundant )
+		mStats.RedundantStateChanges++;
+}
+
+void cRendererNull::SetCap( std::map<GLenum, bool>& States, const GLenum& cap, const bool& enable, EEGL_COMMAND cmd ) {
+	std::map<GLenum, bool>::iterator it = States.find( cap );
+
+	StateChange( it != States.end() && it->second == enable );
+
+	States[ cap ] = enable;
+
+	Record( cmd ).Params[0] = cap;
+}
+
+void cRendererNull::MatrixOp( EEGL_COMMAND cmd, GLfloat x, GLfloat y, GLfloat z, GLfloat w ) {
+	mStats.MatrixOperations++;
+
+	cGLCommand& Cmd = Record( cmd );
+	Cmd.Params[0]	= mCurrentMode;
+	Cmd.FParams[0]	= x;
+	Cmd.FParams[1]	= y;
+	Cmd.FParams[2]	= z;
+	Cmd.FParams[3]	= w;
+}
+
+void cRendererNull::Clear ( GLbitfield mask ) {
+	Record( EEGL_CMD_CLEAR ).Params[0] = mask;
+}
+
+void cRendererNull::ClearColor ( GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha ) {
+}
+
+void cRendererNull::Scissor ( GLint x, GLint y, GLsizei width, GLsizei height ) {
+	cGLCommand& Cmd = Record( EEGL_CMD_SCISSOR );
+	Cmd.Params[0] = x;
+	Cmd.Params[1] = y;
+	Cmd.Params[2] = width;
+	Cmd.Params[3] = height;
+}
+
+void cRendererNull::PolygonMode( GLenum face, GLenum mode ) {
+}
+
+const char * cRendererNull::GetString( GLenum name ) {
+	return NULL;
+}
+
+void cRendererNull::DrawArrays (GLenum mode, GLint first, GLsizei count) {
+	mStats.DrawCalls++;
+	mStats.Vertexs += count;
+
+	cGLCommand& Cmd = Record( EEGL_CMD_DRAW_ARRAYS );
+	Cmd.Params[0] = mode;
+	Cmd.Params[1] = first;
+	Cmd.Params[2] = count;
+}
+
+void cRendererNull::DrawElements( GLenum mode, GLsizei count, GLenum type, const GLvoid *indices ) {
+	mStats.DrawCalls++;
+	mStats.Vertexs += count;
+
+	cGLCommand& Cmd = Record( EEGL_CMD_DRAW_ELEMENTS );
+	Cmd.Params[0] = mode;
+	Cmd.Params[1] = count;
+	Cmd.Params[2] = type;
+}
+
+void cRendererNull::BindTexture ( GLenum target, GLuint texture ) {
+	mStats.TextureBinds++;
+
+	StateChange( mBoundTexture[ mActiveTexture ] == texture );
+
+	mBoundTexture[ mActiveTexture ] = texture;
+
+	cGLCommand& Cmd = Record( EEGL_CMD_BIND_TEXTURE );
+	Cmd.Params[0] = target;
+	Cmd.Params[1] = texture;
+	Cmd.Params[2] = mActiveTexture;
+}
+
+void cRendererNull::DeleteTextures ( GLsizei n, const GLuint * textures ) {
+	for ( GLsizei i = 0; i < n; i++ ) {
+		for ( Uint32 u = 0; u < EE_MAX_TEXTURE_UNITS; u++ ) {
+			if ( mBoundTexture[ u ] == textures[ i ] ) {
+				mBoundTexture[ u ] = 0;
+			}
+		}
+	}
+}
+
+void cRendererNull::ActiveTexture( GLenum texture ) {
+	Uint32 Unit = texture - GL_TEXTURE0;
+
+	if ( Unit >= EE_MAX_TEXTURE_UNITS )
+		Unit = 0;
+
+	StateChange( mActiveTexture == Unit );
+
+	mActiveTexture = Unit;
+
+	Record( EEGL_CMD_ACTIVE_TEXTURE ).Params[0] = texture;
+}
+
+void cRendererNull::BlendFunc ( GLenum sfactor, GLenum dfactor ) {
+	BlendFuncSeparate( sfactor, dfactor, sfactor, dfactor );
+}
+
+void cRendererNull::BlendFuncSeparate ( GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha ) {
+	StateChange( mBlendSrc == sfactorRGB && mBlendDst == dfactorRGB && mBlendSrcAlpha == sfactorAlpha && mBlendDstAlpha == dfactorAlpha );
+
+	mBlendSrc		= sfactorRGB;
+	mBlendDst		= dfactorRGB;
+	mBlendSrcAlpha	= sfactorAlpha;
+	mBlendDstAlpha	= dfactorAlpha;
+
+	cGLCommand& Cmd = Record( EEGL_CMD_BLEND_FUNC );
+	Cmd.Params[0] = sfactorRGB;
+	Cmd.Params[1] = dfactorRGB;
+	Cmd.Params[2] = sfactorAlpha;
+	Cmd.Params[3] = dfactorAlpha;
+}
+
+void cRendererNull::Viewport ( GLint x, GLint y, GLsizei width, GLsizei height ) {
+	mViewport[0] = x;
+	mViewport[1] = y;
+	mViewport[2] = width;
+	mViewport[3] = height;
+
+	cGLCommand& Cmd = Record( EEGL_CMD_VIEWPORT );
+	Cmd.Params[0] = x;
+	Cmd.Params[1] = y;
+	Cmd.Params[2] = width;
+	Cmd.Params[3] = height;
+}
+
+void cRendererNull::LineWidth ( GLfloat width ) {
+	StateChange( mLineWidth == width );
+
+	mLineWidth = width;
+
+	Record( EEGL_CMD_LINE_WIDTH ).FParams[0] = width;
+}
+
+void cRendererNull::GetViewport( GLint * viewport ) {
+	for ( Uint32 i = 0; i < 4; i++ )
+		viewport[i] = mViewport[i];
+}
+
+void cRendererNull::StencilFunc( GLenum func, GLint ref, GLuint mask ) {
+}
+
+void cRendererNull::StencilOp( GLenum fail, GLenum zfail, GLenum zpass ) {
+}
+
+void cRendererNull::StencilMask ( GLuint mask ) {
+}
+
+void cRendererNull::ColorMask ( GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha ) {
+}
+
+void cRendererNull::BindVertexArray ( GLuint array ) {
+	StateChange( mCurVAO == array );
+
+	mCurVAO = array;
+}
+
+void cRendererNull::DeleteVertexArrays ( GLsizei n, const GLuint *arrays ) {
+}
+
+void cRendererNull::GenVertexArrays ( GLsizei n, GLuint *arrays ) {
+	for ( GLsizei i = 0; i < n; i++ )
+		arrays[i] = 0;
+}
+
+void cRendererNull::PointSize( GLfloat size ) {
+	StateChange( mPointSize == size );
+
+	mPointSize = size;
+
+	Record( EEGL_CMD_POINT_SIZE ).FParams[0] = size;
+}
+
+GLfloat cRendererNull::PointSize() {
+	return mPointSize;
+}
+
+void cRendererNull::ClientActiveTexture( GLenum texture ) {
+}
+
+void cRendererNull::Disable ( GLenum cap ) {
+	if ( GL_BLEND == cap )
+		mBlendEnabled = false;
+
+	SetCap( mCaps, cap, false, EEGL_CMD_DISABLE );
+}
+
+void cRendererNull::Enable( GLenum cap ) {
+	if ( GL_BLEND == cap )
+		mBlendEnabled = true;
+
+	SetCap( mCaps, cap, true, EEGL_CMD_ENABLE );
+}
+
+void cRendererNull::EnableClientState( GLenum array ) {
+	SetCap( mClientStates, array, true, EEGL_CMD_ENABLE_CLIENT_STATE );
+}
+
+void cRendererNull::DisableClientState( GLenum array ) {
+	SetCap( mClientStates, array, false, EEGL_CMD_DISABLE_CLIENT_STATE );
+}
+
+void cRendererNull::VertexPointer ( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer, GLuint allocate ) {
+	cGLCommand& Cmd = Record( EEGL_CMD_VERTEX_POINTER );
+	Cmd.Params[0] = size;
+	Cmd.Params[1] = type;
+	Cmd.Params[2] = stride;
+	Cmd.Params[3] = allocate;
+}
+
+void cRendererNull::ColorPointer ( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer, GLuint allocate ) {
+	cGLCommand& Cmd = Record( EEGL_CMD_COLOR_POINTER );
+	Cmd.Params[0] = size;
+	Cmd.Params[1] = type;
+	Cmd.Params[2] = stride;
+	Cmd.Params[3] = allocate;
+}
+
+void cRendererNull::TexCoordPointer ( GLint size, GLenum type, GLsizei stride, const GLvoid *pointer, GLuint allocate ) {
+	cGLCommand& Cmd = Record( EEGL_CMD_TEXCOORD_POINTER );
+	Cmd.Params[0] = size;
+	Cmd.Params[1] = type;
+	Cmd.Params[2] = stride;
+	Cmd.Params[3] = allocate;
+}
+
+void cRendererNull::SetShader( cShaderProgram * Shader ) {
+	StateChange( mCurShader == Shader );
+
+	mCurShader = Shader;
+
+	Record( EEGL_CMD_SET_SHADER ).Params[0] = NULL != Shader ? (Int32)Shader->Handler() : 0;
+}
+
+Uint32 cRendererNull::MultiTextureUnits() {
+	return EE_MAX_TEXTURE_UNITS;
+}
+
+bool cRendererNull::MultiTextureShader( const bool& enable ) {
+	if ( enable && NULL != mCurShader ) {
+		return false;
+	}
+
+	StateChange( mMultiTexture == enable );
+
+	mMultiTexture = enable;
+
+	Record( EEGL_CMD_SET_SHADER ).Params[0] = enable ? -1 : 0;
+
+	return true;
+}
+
+void cRendererNull::Clip2DPlaneEnable( const Int32& x, const Int32& y, const Int32& Width, const Int32& Height ) {
+	cGLCommand& Cmd = Record( EEGL_CMD_CLIP_2D_ENABLE );
+	Cmd.Params[0] = x;
+	Cmd.Params[1] = y;
+	Cmd.Params[2] = Width;
+	Cmd.Params[3] = Height;
+
+	if ( mPushClip ) {
+		mPlanesClipped.push_back( eeRectf( x, y, Width, Height ) );
+	}
+}
+
+void cRendererNull::Clip2DPlaneDisable() {
+	if ( !mPlanesClipped.empty() ) {
+		mPlanesClipped.pop_back();
+	}
+
+	Record( EEGL_CMD_CLIP_2D_DISABLE );
+}
+
+void cRendererNull::ClipPlane( GLenum plane, const GLdouble *equation ) {
+	cGLCommand& Cmd = Record( EEGL_CMD_CLIP_PLANE );
+	Cmd.Params[0] = plane;
+
+	for ( Uint32 i = 0; i < 4; i++ )
+		Cmd.FParams[i] = (GLfloat)equation[i];
+}
+
+void cRendererNull::TexEnvi( GLenum target, GLenum pname, GLint param ) {
+}
+
+void cRendererNull::PushMatrix() {
+	mStack->mCurMatrix->push( mStack->mCurMatrix->top() );
+	MatrixOp( EEGL_CMD_PUSH_MATRIX );
+}
+
+void cRendererNull::PopMatrix() {
+	mStack->mCurMatrix->pop();
+	MatrixOp( EEGL_CMD_POP_MATRIX );
+}
+
+void cRendererNull::LoadIdentity() {
+	mStack->mCurMatrix->top() = glm::mat4(1.0);
+	MatrixOp( EEGL_CMD_LOAD_IDENTITY );
+}
+
+void cRendererNull::MultMatrixf ( const GLfloat * m ) {
+	mStack->mCurMatrix->top() *= toGLMmat4( m );
+	MatrixOp( EEGL_CMD_MULT_MATRIX );
+}
+
+void cRendererNull::LoadMatrixf( const GLfloat * m ) {
+	mStack->mCurMatrix->top() = toGLMmat4( m );
+	MatrixOp( EEGL_CMD_LOAD_MATRIX );
+}
+
+void cRendererNull::Translatef( GLfloat x, GLfloat y, GLfloat z ) {
+	mStack->mCurMatrix->top() *= glm::translate( glm::vec3( x, y, z ) );
+	MatrixOp( EEGL_CMD_TRANSLATE, x, y, z );
+}
+
+void cRendererNull::Rotatef( GLfloat angle, GLfloat x, GLfloat y, GLfloat z ) {
+	mStack->mCurMatrix->top() *= glm::rotate( angle, glm::vec3( x, y, z ) );
+	MatrixOp( EEGL_CMD_ROTATE, angle, x, y, z );
+}
+
+void cRendererNull::Scalef( GLfloat x, GLfloat y, GLfloat z ) {
+	mStack->mCurMatrix->top() *= glm::scale( glm::vec3( x, y, z ) );
+	MatrixOp( EEGL_CMD_SCALE, x, y, z );
+}
+
+void cRendererNull::Ortho( GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar ) {
+	mStack->mCurMatrix->top() *= glm::ortho( left, right, bottom, top , zNear, zFar );
+	MatrixOp( EEGL_CMD_PROJECTION, left, right, bottom, top );
+}
+
+void cRendererNull::LookAt( GLfloat eyeX, GLfloat eyeY, GLfloat eyeZ, GLfloat centerX, GLfloat centerY, GLfloat centerZ, GLfloat upX, GLfloat upY, GLfloat upZ ) {
+	mStack->mCurMatrix->top() *= glm::lookAt( glm::vec3(eyeX, eyeY, eyeZ), glm::vec3(centerX, centerY, centerZ), glm::vec3(upX, upY, upZ) );
+	MatrixOp( EEGL_CMD_PROJECTION, eyeX, eyeY, eyeZ );
+}
+
+void cRendererNull::Perspective ( GLfloat fovy, GLfloat aspect, GLfloat zNear, GLfloat zFar ) {
+	mStack->mCurMatrix->top() *= glm::perspective( fovy, aspect, zNear, zFar );
+	MatrixOp( EEGL_CMD_PROJECTION, fovy, aspect, zNear, zFar );
+}
+
+void cRendererNull::Frustum( GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat near_val, GLfloat far_val ) {
+	mStack->mCurMatrix->top() *= glm::frustum( left, right, bottom, top, near_val, far_val );
+	MatrixOp( EEGL_CMD_PROJECTION, left, right, bottom, top );
+}
+
+void cRendererNull::MatrixMode( GLenum mode ) {
+	mCurrentMode = mode;
+
+	switch ( mCurrentMode ) {
+		case GL_PROJECTION:
+		case GL_PROJECTION_MATRIX:
+		{
+			mStack->mCurMatrix = &mStack->mProjectionMatrix;
+			break;
+		}
+		case GL_MODELVIEW:
+		case GL_MODELVIEW_MATRIX:
+		{
+			mStack->mCurMatrix = &mStack->mModelViewMatrix;
+			break;
+		}
+	}
+
+	MatrixOp( EEGL_CMD_MATRIX_MODE );
+}
+
+void cRendererNull::GetCurrentMatrix( GLenum mode, GLfloat * m ) {
+	switch ( mode ) {
+		case GL_PROJECTION:
+		case GL_PROJECTION_MATRIX:
+		{
+			fromGLMmat4( mStack->mProjectionMatrix.top(), m );
+			break;
+		}
+		case GL_MODELVIEW:
+		case GL_MODELVIEW_MATRIX:
+		{
+			fromGLMmat4( mStack->mModelViewMatrix.top(), m );
+			break;
+		}
+	}
+}
+
+GLenum cRendererNull::GetCurrentMatrixMode() {
+	return mCurrentMode;
+}
+
+GLint cRendererNull::Project( GLfloat objx, GLfloat objy, GLfloat objz, const GLfloat modelMatrix[16], const GLfloat projMatrix[16], const GLint viewport[4], GLfloat *winx, GLfloat *winy, GLfloat *winz ) {
+	glm::vec3 tv3( glm::project( glm::vec3( objx, objy, objz ), toGLMmat4( modelMatrix ), toGLMmat4( projMatrix ), glm::vec4( viewport[0], viewport[1], viewport[2], viewport[3] ) ) );
+
+	if ( NULL != winx )
+		*winx = tv3.x;
+
+	if ( NULL != winy )
+		*winy = tv3.y;
+
+	if ( NULL != winz )
+		*winz = tv3.z;
+
+	return GL_TRUE;
+}
+
+GLint cRendererNull::UnProject( GLfloat winx, GLfloat winy, GLfloat winz, const GLfloat modelMatrix[16], const GLfloat projMatrix[16], const GLint viewport[4], GLfloat *objx, GLfloat *objy, GLfloat *objz ) {
+	glm::vec3 tv3( glm::unProject( glm::vec3( winx, winy, winz ), toGLMmat4( modelMatrix ), toGLMmat4( projMatrix ), glm::vec4( viewport[0], viewport[1], viewport[2], viewport[3] ) ) );
+
+	if ( NULL != objx )
+		*objx = tv3.x;
+
+	if ( NULL != objy )
+		*objy = tv3.y;
+
+	if ( NULL != objz )
+		*objz = tv3.z;
+
+	return GL_TRUE;
+}
+
+}}
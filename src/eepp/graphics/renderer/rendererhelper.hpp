@@ -2,9 +2,6 @@
 #define EE_GRAPHICS_PRIVATE_RENDERERHELPER_HPP
 
 #include <eepp/graphics/renderer/base.hpp>
-
-#ifdef EE_GL3_ENABLED
-
 #include <stack>
 #include <eepp/helper/glm/gtx/transform.hpp>
 
@@ -33,5 +30,3 @@ class cMatrixStack
 using namespace EE::Graphics::Private;
 
 #endif
-
-#endif
@@ -0,0 +1,31 @@
+#ifdef EE_GLES2
+"precision mediump float;\n"
+"precision lowp int;\n"
+#else
+"#version 120\n"
+#endif
+"uniform	sampler2D	textureUnit0;\n\
+uniform		sampler2D	textureUnit1;\n\
+uniform		sampler2D	textureUnit2;\n\
+uniform		sampler2D	textureUnit3;\n\
+varying				vec4 dgl_Color;\n\
+varying				float dgl_TexSlot;\n\
+#ifndef GL_ES\n\
+varying				vec4 dgl_TexCoord[ 1 ];\n\
+#else\n\
+varying		mediump	vec4 dgl_TexCoord[ 1 ];\n\
+#endif\n\
+void main(void)\n\
+{\n\
+	vec2 uv = dgl_TexCoord[ 0 ].xy;\n\
+	if ( dgl_TexSlot < 0.5 )\n\
+		gl_FragColor = dgl_Color * texture2D( textureUnit0, uv );\n\
+	else if ( dgl_TexSlot < 1.5 )\n\
+		gl_FragColor = dgl_Color * texture2D( textureUnit1, uv );\n\
+	else if ( dgl_TexSlot < 2.5 )\n\
+		gl_FragColor = dgl_Color * texture2D( textureUnit2, uv );\n\
+	else if ( dgl_TexSlot < 3.5 )\n\
+		gl_FragColor = dgl_Color * texture2D( textureUnit3, uv );\n\
+	else\n\
+		gl_FragColor = dgl_Color;\n\
+}";
@@ -0,0 +1,34 @@
+#ifdef EE_GLES2
+"precision mediump float;\n"
+"precision lowp int;\n"
+#else
+"#version 120\n"
+#endif
+"uniform			mat4 dgl_ProjectionMatrix;\n\
+uniform				mat4 dgl_ModelViewMatrix;\n\
+uniform				float dgl_PointSize;\n\
+attribute			vec4 dgl_Vertex;\n\
+attribute			vec4 dgl_FrontColor;\n\
+varying				vec4 dgl_Color;\n\
+varying				float dgl_TexSlot;\n\
+#ifndef GL_ES\n\
+attribute			vec4 dgl_MultiTexCoord0;\n\
+varying				vec4 dgl_TexCoord[ 1 ];\n\
+#else\n\
+attribute	highp	vec4 dgl_MultiTexCoord0;\n\
+varying		mediump	vec4 dgl_TexCoord[ 1 ];\n\
+#endif\n\
+void main(void)\n\
+{\n\
+#ifndef GL_ES\n\
+	float slot		= floor( ( dgl_MultiTexCoord0.x + 1.0 ) * 0.25 );\n\
+#else\n\
+	highp float slot = floor( ( dgl_MultiTexCoord0.x + 1.0 ) * 0.25 );\n\
+#endif\n\
+	gl_PointSize	= dgl_PointSize;\n\
+	dgl_Color		= dgl_FrontColor;\n\
+	dgl_TexSlot		= slot;\n\
+	dgl_TexCoord[0]	= vec4( dgl_MultiTexCoord0.x - slot * 4.0, dgl_MultiTexCoord0.yzw );\n\
+	gl_Position		= dgl_ProjectionMatrix * ( dgl_ModelViewMatrix * dgl_Vertex );\n\
+}\n\
+";
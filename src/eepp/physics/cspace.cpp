@@ -1,5 +1,6 @@
 #include <eepp/physics/cspace.hpp>
 #include <eepp/physics/cphysicsmanager.hpp>
+#include <eepp/system/cprofiler.hpp>
 
 #ifdef PHYSICS_RENDERER_ENABLED
 #include <eepp/window/cengine.hpp>
@@ -59,6 +60,8 @@ void * cSpace::Data() const {
 }
 
 void cSpace::Step( const cpFloat& dt ) {
+	eePROFILE_ZONE( "Physics Step" );
+
 	cpSpaceStep( mSpace, dt );
 }
 
@@ -0,0 +1,71 @@
+#include <eepp/system/cfixedtimestep.hpp>
+
+namespace EE { namespace System {
+
+cFixedTimestep::cFixedTimestep( const cTime& StepTime, const Uint32& MaxSteps ) :
+	mStepTime( StepTime ),
+	mStep( eemax( StepTime.AsMicroseconds(), (Int64)1 ) ),
+	mAccumulator( 0 ),
+	mMaxSteps( eemax( MaxSteps, (Uint32)1 ) ),
+	mStepsCount( 0 )
+{
+}
+
+void cFixedTimestep::StepTime( const cTime& StepTime ) {
+	mStepTime	= StepTime;
+	mStep		= eemax( StepTime.AsMicroseconds(), (Int64)1 );
+}
+
+const cTime& cFixedTimestep::StepTime() const {
+	return mStepTime;
+}
+
+void cFixedTimestep::MaxSteps( const Uint32& MaxSteps ) {
+	mMaxSteps = eemax( MaxSteps, (Uint32)1 );
+}
+
+const Uint32& cFixedTimestep::MaxSteps() const {
+	return mMaxSteps;
+}
+
+Uint32 cFixedTimestep::Advance( const cTime& Elapsed ) {
+	// The time is accumulated in microseconds, so the number of steps doesn't depend on floating point rounding
+	mAccumulator += eemax( Elapsed.AsMicroseconds(), (Int64)0 );
+
+	mAccumulator = eemin( mAccumulator, mStep * (Int64)mMaxSteps );
+
+	return PendingSteps();
+}
+
+bool cFixedTimestep::Step() {
+	if ( mAccumulator >= mStep ) {
+		mAccumulator -= mStep;
+		mStepsCount++;
+		return true;
+	}
+
+	return false;
+}
+
+Uint32 cFixedTimestep::PendingSteps() const {
+	return (Uint32)( mAccumulator / mStep );
+}
+
+eeFloat cFixedTimestep::Alpha() const {
+	return (eeFloat)( mAccumulator % mStep ) / (eeFloat)mStep;
+}
+
+const Uint64& cFixedTimestep::StepsCount() const {
+	return mStepsCount;
+}
+
+cTime cFixedTimestep::SimulationTime() const {
+	return Microseconds( (Int64)mStepsCount * mStep );
+}
+
+void cFixedTimestep::Reset() {
+	mAccumulator	= 0;
+	mStepsCount		= 0;
+}
+
+}}
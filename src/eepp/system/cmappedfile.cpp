@@ -0,0 +1,27 @@
+#include <eepp/system/cmappedfile.hpp>
+#include <eepp/system/platform/platformimpl.hpp>
+
+namespace EE { namespace System {
+
+cMappedFile::cMappedFile( const std::string& Filepath ) :
+	mMappedFileImpl( new Platform::cMappedFileImpl( Filepath ) )
+{
+}
+
+cMappedFile::~cMappedFile() {
+	delete mMappedFileImpl;
+}
+
+bool cMappedFile::IsOpen() const {
+	return NULL != mMappedFileImpl->GetData();
+}
+
+const Uint8 * cMappedFile::GetData() const {
+	return mMappedFileImpl->GetData();
+}
+
+Uint64 cMappedFile::GetSize() const {
+	return mMappedFileImpl->GetSize();
+}
+
+}}
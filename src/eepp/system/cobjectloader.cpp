@@ -54,6 +54,10 @@ bool cObjectLoader::IsLoading() {
 	return mLoading;
 }
 
+bool cObjectLoader::IsWaitingUpdate() {
+	return false;
+}
+
 bool cObjectLoader::Threaded() const {
 	return mThreaded;
 }
@@ -0,0 +1,345 @@
+#include <eepp/system/cprofiler.hpp>
+#include <eepp/system/clock.hpp>
+#include <eepp/system/ciostreamfile.hpp>
+#include <algorithm>
+#include <map>
+
+#if defined( EE_COMPILER_MSVC )
+#include <intrin.h>
+#endif
+
+namespace EE { namespace System {
+
+namespace Private {
+
+/** The ring buffer of the zones measured by a thread. Only the owner thread writes in it, the readers must ignore the oldest slots since they could being overwritten. */
+class cProfilerThread {
+	public:
+		cProfilerThread( const Uint32& index, const Uint32& capacity ) :
+			Index( index ),
+			Depth( 0 ),
+			Head( 0 ),
+			Zones( capacity )
+		{
+		}
+
+		void Push( const cProfilerEvent& Zone ) {
+			Zones[ Head & ( Zones.size() - 1 ) ] = Zone;
+
+			// The zone must be written before it's published to the readers
+			#if defined( EE_COMPILER_MSVC )
+			_ReadWriteBarrier();
+			#elif defined( __i386__ ) || defined( __x86_64__ )
+			__asm__ __volatile__ ( "" ::: "memory" );
+			#elif defined( __GNUC__ )
+			__sync_synchronize();
+			#endif
+
+			Head = Head + 1;
+		}
+
+		Uint32						Index;
+		Uint32						Depth;
+		volatile Uint32				Head;
+		std::vector<cProfilerEvent>	Zones;
+};
+
+static bool ZoneStartSort( const cProfilerEvent& a, const cProfilerEvent& b ) {
+	return a.Start < b.Start;
+}
+
+static std::string JsonEscape( const char * Str ) {
+	std::string Res;
+
+	for ( const char * c = Str; *c; c++ ) {
+		if ( '"' == *c || '\\' == *c ) {
+			Res += '\\';
+		}
+
+		Res += *c;
+	}
+
+	return Res;
+}
+
+}
+
+using namespace Private;
+
+cProfilerEvent::cProfilerEvent() :
+	Name( "" ),
+	Start( 0 ),
+	Duration( 0 ),
+	Frame( 0 ),
+	Thread( 0 ),
+	Depth( 0 )
+{
+}
+
+cProfilerFrame::cProfilerFrame() :
+	Number( 0 ),
+	Start( 0 ),
+	Duration( 0 ),
+	GpuDuration( -1 )
+{
+}
+
+SINGLETON_DECLARE_IMPLEMENTATION(cProfiler)
+
+cProfiler::cProfiler() :
+	mEnabled( false ),
+	mFrame( 0 )
+{
+}
+
+cProfiler::~cProfiler() {
+	for ( Uint32 i = 0; i < mThreads.size(); i++ ) {
+		eeSAFE_DELETE( mThreads[i] );
+	}
+}
+
+void cProfiler::Enabled( const bool& enabled ) {
+	mEnabled = enabled;
+}
+
+const bool& cProfiler::Enabled() const {
+	return mEnabled;
+}
+
+Int64 cProfiler::Now() const {
+	return mClock.GetElapsedTime().AsMicroseconds();
+}
+
+Uint32 cProfiler::FrameNumber() const {
+	return mFrame;
+}
+
+void cProfiler::FrameMark() {
+	Int64 now = Now();
+
+	cProfilerFrame& Cur = mFrames[ mFrame % FRAMES_COUNT ];
+
+	Cur.Duration = now - Cur.Start;
+
+	cProfilerFrame& Next = mFrames[ ( mFrame + 1 ) % FRAMES_COUNT ];
+
+	Next.Number			= mFrame + 1;
+	Next.Start			= now;
+	Next.Duration		= 0;
+	Next.GpuDuration	= -1;
+
+	mFrame = mFrame + 1;
+}
+
+void cProfiler::GpuFrameTime( const Uint32& Frame, const cTime& Time ) {
+	cProfilerFrame& Cur = mFrames[ Frame % FRAMES_COUNT ];
+
+	if ( Cur.Number == Frame ) {
+		Cur.GpuDuration = Time.AsMicroseconds();
+	}
+}
+
+cProfilerThread * cProfiler::GetThread() {
+	cProfilerThread * Thread = mThread;
+
+	if ( NULL == Thread ) {
+		cLock l( mThreadsMutex );
+
+		Thread = eeNew( cProfilerThread, ( mThreads.size(), THREAD_ZONES_COUNT ) );
+
+		mThreads.push_back( Thread );
+
+		mThread = Thread;
+	}
+
+	return Thread;
+}
+
+void cProfiler::AddZone( const char * Name, const Int64& Start, const Int64& End, const Uint32& Depth ) {
+	cProfilerThread * Thread = GetThread();
+	cProfilerEvent Zone;
+
+	Zone.Name		= Name;
+	Zone.Start		= Start;
+	Zone.Duration	= End - Start;
+	Zone.Frame		= mFrame;
+	Zone.Thread		= Thread->Index;
+	Zone.Depth		= Depth;
+
+	Thread->Push( Zone );
+}
+
+std::vector<cProfilerFrame> cProfiler::GetFrames( const Uint32& Count ) const {
+	Uint32 Frame = mFrame;
+	Uint32 Num = eemin( eemin( Count, Frame ), (Uint32)FRAMES_COUNT - 1 );
+	std::vector<cProfilerFrame> Frames;
+
+	for ( Uint32 i = Frame - Num; i < Frame; i++ ) {
+		Frames.push_back( mFrames[ i % FRAMES_COUNT ] );
+	}
+
+	return Frames;
+}
+
+std::vector<cProfilerEvent> cProfiler::GetZones( const Uint32& Count ) const {
+	Uint32 Frame = mFrame;
+	Uint32 Num = eemin( eemin( Count, Frame ), (Uint32)FRAMES_COUNT - 1 );
+	Uint32 First = Frame - Num;
+	std::vector<cProfilerEvent> Zones;
+
+	cLock l( mThreadsMutex );
+
+	for ( Uint32 t = 0; t < mThreads.size(); t++ ) {
+		cProfilerThread * Thread = mThreads[t];
+		Uint32 Head = Thread->Head;
+		Uint32 Size = Thread->Zones.size();
+
+		// Skip the oldest slots, the owner thread could be writing them
+		Uint32 Readable = eemin( Head, Size - Size / 8 );
+
+		for ( Uint32 i = 0; i < Readable; i++ ) {
+			const cProfilerEvent& Zone = Thread->Zones[ ( Head - 1 - i ) & ( Size - 1 ) ];
+
+			if ( Zone.Frame < First ) {
+				break;
+			}
+
+			if ( Zone.Frame < Frame ) {
+				Zones.push_back( Zone );
+			}
+		}
+	}
+
+	std::sort( Zones.begin(), Zones.end(), ZoneStartSort );
+
+	return Zones;
+}
+
+bool cProfiler::ExportChromeTrace( const std::string& Filepath, const Uint32& Count ) const {
+	cIOStreamFile fs( Filepath, std::ios::out | std::ios::binary );
+
+	if ( !fs.IsOpen() ) {
+		return false;
+	}
+
+	Uint32 Num = 0 == Count ? (Uint32)FRAMES_COUNT : Count;
+	std::vector<cProfilerFrame> Frames = GetFrames( Num );
+	std::vector<cProfilerEvent> Zones = GetZones( Num );
+	Uint32 Threads;
+
+	{
+		cLock l( mThreadsMutex );
+		Threads = mThreads.size();
+	}
+
+	// The frames and the GPU times are shown as two extra threads after the profiled ones
+	Uint32 FramesTid	= Threads;
+	Uint32 GpuTid		= Threads + 1;
+	std::string Data( "{\"traceEvents\":[\n" );
+
+	for ( Uint32 i = 0; i < Threads; i++ ) {
+		Data += String::StrFormated( "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Thread %u\"}},\n", i, i );
+	}
+
+	Data += String::StrFormated( "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"Frames\"}},\n", FramesTid );
+	Data += String::StrFormated( "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%u,\"args\":{\"name\":\"GPU\"}}", GpuTid );
+
+	for ( Uint32 i = 0; i < Frames.size(); i++ ) {
+		const cProfilerFrame& Frame = Frames[i];
+
+		Data += String::StrFormated( ",\n{\"name\":\"Frame %u\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.0f,\"dur\":%.0f,\"pid\":0,\"tid\":%u}", Frame.Number, (eeDouble)Frame.Start, (eeDouble)Frame.Duration, FramesTid );
+
+		if ( Frame.GpuDuration >= 0 ) {
+			Data += String::StrFormated( ",\n{\"name\":\"GPU Frame %u\",\"cat\":\"gpu\",\"ph\":\"X\",\"ts\":%.0f,\"dur\":%.0f,\"pid\":0,\"tid\":%u}", Frame.Number, (eeDouble)Frame.Start, (eeDouble)Frame.GpuDuration, GpuTid );
+		}
+	}
+
+	for ( Uint32 i = 0; i < Zones.size(); i++ ) {
+		const cProfilerEvent& Zone = Zones[i];
+
+		Data += ",\n{\"name\":\"" + JsonEscape( Zone.Name ) + "\"";
+		Data += String::StrFormated( ",\"cat\":\"zone\",\"ph\":\"X\",\"ts\":%.0f,\"dur\":%.0f,\"pid\":0,\"tid\":%u,\"args\":{\"frame\":%u}}", (eeDouble)Zone.Start, (eeDouble)Zone.Duration, Zone.Thread, Zone.Frame );
+	}
+
+	Data += "\n]}\n";
+
+	fs.Write( Data.c_str(), Data.size() );
+
+	return true;
+}
+
+std::string cProfiler::GetReport( const Uint32& Count ) const {
+	std::vector<cProfilerFrame> Frames = GetFrames( Count );
+	std::vector<cProfilerEvent> Zones = GetZones( Count );
+	std::string Report;
+	Uint32 z = 0;
+
+	for ( Uint32 i = 0; i < Frames.size(); i++ ) {
+		const cProfilerFrame& Frame = Frames[i];
+
+		if ( Frame.GpuDuration >= 0 ) {
+			Report += String::StrFormated( "Frame %u: %.3f ms ( GPU %.3f ms )\n", Frame.Number, Frame.Duration / 1000.0, Frame.GpuDuration / 1000.0 );
+		} else {
+			Report += String::StrFormated( "Frame %u: %.3f ms\n", Frame.Number, Frame.Duration / 1000.0 );
+		}
+
+		// Sum the time of the zones of the frame by name, keeping the order of the first appearance
+		std::map<std::string, Uint32> Index;
+		std::vector< std::pair<std::string, Int64> > Totals;
+		std::vector<Uint32> Calls;
+
+		for ( z = 0; z < Zones.size(); z++ ) {
+			const cProfilerEvent& Zone = Zones[z];
+
+			if ( Zone.Frame != Frame.Number ) {
+				continue;
+			}
+
+			std::map<std::string, Uint32>::iterator it = Index.find( Zone.Name );
+
+			if ( it == Index.end() ) {
+				Index[ Zone.Name ] = Totals.size();
+				Totals.push_back( std::make_pair( std::string( Zone.Name ), Zone.Duration ) );
+				Calls.push_back( 1 );
+			} else {
+				Totals[ it->second ].second += Zone.Duration;
+				Calls[ it->second ]++;
+			}
+		}
+
+		for ( Uint32 t = 0; t < Totals.size(); t++ ) {
+			Report += String::StrFormated( "\t%s: %.3f ms ( %u calls )\n", Totals[t].first.c_str(), Totals[t].second / 1000.0, Calls[t] );
+		}
+	}
+
+	return Report;
+}
+
+cProfilerZone::cProfilerZone( const char * Name ) :
+	mName( Name ),
+	mThread( NULL ),
+	mStart( 0 )
+{
+	cProfiler * Profiler = cProfiler::ExistsSingleton();
+
+	if ( NULL != Profiler && Profiler->mEnabled ) {
+		mThread	= Profiler->GetThread();
+		mStart	= Profiler->Now();
+
+		mThread->Depth++;
+	}
+}
+
+cProfilerZone::~cProfilerZone() {
+	if ( NULL != mThread ) {
+		cProfiler * Profiler = cProfiler::ExistsSingleton();
+
+		mThread->Depth--;
+
+		if ( NULL != Profiler ) {
+			Profiler->AddZone( mName, mStart, Profiler->Now(), mThread->Depth );
+		}
+	}
+}
+
+}}
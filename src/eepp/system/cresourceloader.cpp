@@ -1,5 +1,6 @@
 #include <eepp/system/cresourceloader.hpp>
 #include <eepp/system/sys.hpp>
+#include <eepp/system/cclock.hpp>
 
 namespace EE { namespace System {
 
@@ -7,7 +8,8 @@ cResourceLoader::cResourceLoader( const Uint32& MaxThreads ) :
 	mLoaded(false),
 	mLoading(false),
 	mThreaded(true),
-	mThreads(MaxThreads)
+	mThreads(MaxThreads),
+	mUploadBudget( Milliseconds( 2 ) )
 {
 	SetThreads();
 }
@@ -40,6 +42,14 @@ void cResourceLoader::Threaded( const bool& threaded ) {
 	}
 }
 
+void cResourceLoader::UploadBudget( const cTime& budget ) {
+	mUploadBudget = budget;
+}
+
+const cTime& cResourceLoader::UploadBudget() const {
+	return mUploadBudget;
+}
+
 void cResourceLoader::Add( cObjectLoader * Object ) {
 	mObjs.push_front( Object );
 }
@@ -89,6 +99,9 @@ void cResourceLoader::Load() {
 	std::list<cObjectLoader *> ObjsErase;
 
 	Uint32 count = 0;
+	bool OverBudget = false;
+	cTime UploadTime;
+	cClock UploadClock;
 
 	for ( it = mObjs.begin(); it != mObjs.end(); it++ ) {
 		Obj = (*it);
@@ -101,11 +114,26 @@ void cResourceLoader::Load() {
 					Obj->Load();
 				}
 
-				if ( Obj->IsLoading() ) {
+				// The resources waiting the update already released their loader thread
+				if ( Obj->IsLoading() && !Obj->IsWaitingUpdate() ) {
 					count++;
 				}
 
-				Obj->Update();
+				if ( !OverBudget ) {
+					bool Waiting = Obj->IsWaitingUpdate();
+
+					if ( Waiting ) {
+						UploadClock.Restart();
+					}
+
+					Obj->Update();
+
+					// Once the budget is spent the remaining resources are finished in the next updates
+					if ( Waiting && mThreaded && mUploadBudget != cTime::Zero ) {
+						UploadTime += UploadClock.GetElapsedTime();
+						OverBudget = UploadTime >= mUploadBudget;
+					}
+				}
 
 				if ( !Obj->IsLoaded() ) {
 					AllLoaded = false;
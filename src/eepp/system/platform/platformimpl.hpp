@@ -9,14 +9,16 @@
 	#include <eepp/system/platform/posix/cclockimpl.hpp>
 	#include <eepp/system/platform/posix/cconditionimpl.hpp>
 	#include <eepp/system/platform/posix/cthreadlocalimpl.hpp>
+	#include <eepp/system/platform/posix/cmappedfileimpl.hpp>
 #elif EE_PLATFORM == EE_PLATFORM_WIN
 	#include <eepp/system/platform/win/cthreadimpl.hpp>
 	#include <eepp/system/platform/win/cmuteximpl.hpp>
 	#include <eepp/system/platform/win/cclockimpl.hpp>
 	#include <eepp/system/platform/win/cconditionimpl.hpp>
 	#include <eepp/system/platform/win/cthreadlocalimpl.hpp>
+	#include <eepp/system/platform/win/cmappedfileimpl.hpp>
 #else
-	#error Threads, mutexes, conditions, timers and thread local storage not implemented for this platform.
+	#error Threads, mutexes, conditions, timers, thread local storage and mapped files not implemented for this platform.
 #endif
 
 #endif
@@ -0,0 +1,53 @@
+#include <eepp/system/platform/posix/cmappedfileimpl.hpp>
+
+#if defined( EE_PLATFORM_POSIX )
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace EE { namespace System { namespace Platform {
+
+cMappedFileImpl::cMappedFileImpl( const std::string& Filepath ) :
+	mData( NULL ),
+	mSize( 0 )
+{
+	int fd = open( Filepath.c_str(), O_RDONLY );
+
+	if ( -1 == fd ) {
+		return;
+	}
+
+	struct stat st;
+
+	if ( 0 == fstat( fd, &st ) && st.st_size > 0 ) {
+		void * data = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+		if ( MAP_FAILED != data ) {
+			mData = (Uint8*)data;
+			mSize = st.st_size;
+		}
+	}
+
+	// The mapping keeps its own reference to the file
+	close( fd );
+}
+
+cMappedFileImpl::~cMappedFileImpl() {
+	if ( NULL != mData ) {
+		munmap( mData, mSize );
+	}
+}
+
+const Uint8 * cMappedFileImpl::GetData() const {
+	return mData;
+}
+
+Uint64 cMappedFileImpl::GetSize() const {
+	return mSize;
+}
+
+}}}
+
+#endif
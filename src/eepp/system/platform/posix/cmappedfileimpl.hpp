@@ -0,0 +1,30 @@
+#ifndef EE_SYSTEMCMAPPEDFILEIMPLPOSIX_HPP
+#define EE_SYSTEMCMAPPEDFILEIMPLPOSIX_HPP
+
+#include <eepp/declares.hpp>
+
+#if defined( EE_PLATFORM_POSIX )
+
+#include <string>
+
+namespace EE { namespace System { namespace Platform {
+
+class cMappedFileImpl {
+	public:
+		cMappedFileImpl( const std::string& Filepath );
+
+		~cMappedFileImpl();
+
+		const Uint8 * GetData() const;
+
+		Uint64 GetSize() const;
+	private:
+		Uint8 *	mData;
+		Uint64	mSize;
+};
+
+}}}
+
+#endif
+
+#endif
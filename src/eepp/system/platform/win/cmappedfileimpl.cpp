@@ -0,0 +1,62 @@
+#include <eepp/system/platform/win/cmappedfileimpl.hpp>
+
+#if EE_PLATFORM == EE_PLATFORM_WIN
+
+namespace EE { namespace System { namespace Platform {
+
+cMappedFileImpl::cMappedFileImpl( const std::string& Filepath ) :
+	mFile( INVALID_HANDLE_VALUE ),
+	mMapping( NULL ),
+	mData( NULL ),
+	mSize( 0 )
+{
+	mFile = CreateFileA( Filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+
+	if ( INVALID_HANDLE_VALUE == mFile ) {
+		return;
+	}
+
+	LARGE_INTEGER size;
+
+	if ( !GetFileSizeEx( mFile, &size ) || 0 == size.QuadPart ) {
+		return;
+	}
+
+	mMapping = CreateFileMappingA( mFile, NULL, PAGE_READONLY, 0, 0, NULL );
+
+	if ( NULL == mMapping ) {
+		return;
+	}
+
+	mData = (Uint8*)MapViewOfFile( mMapping, FILE_MAP_READ, 0, 0, 0 );
+
+	if ( NULL != mData ) {
+		mSize = size.QuadPart;
+	}
+}
+
+cMappedFileImpl::~cMappedFileImpl() {
+	if ( NULL != mData ) {
+		UnmapViewOfFile( mData );
+	}
+
+	if ( NULL != mMapping ) {
+		CloseHandle( mMapping );
+	}
+
+	if ( INVALID_HANDLE_VALUE != mFile ) {
+		CloseHandle( mFile );
+	}
+}
+
+const Uint8 * cMappedFileImpl::GetData() const {
+	return mData;
+}
+
+Uint64 cMappedFileImpl::GetSize() const {
+	return mSize;
+}
+
+}}}
+
+#endif
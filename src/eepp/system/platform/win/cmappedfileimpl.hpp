@@ -0,0 +1,39 @@
+#ifndef EE_SYSTEMCMAPPEDFILEIMPLWIN_HPP
+#define EE_SYSTEMCMAPPEDFILEIMPLWIN_HPP
+
+#include <eepp/declares.hpp>
+
+#if EE_PLATFORM == EE_PLATFORM_WIN
+
+#ifndef WIN32_LEAN_AND_MEAN
+	#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+	#define NOMINMAX
+#endif
+#include <windows.h>
+#include <string>
+
+namespace EE { namespace System { namespace Platform {
+
+class cMappedFileImpl {
+	public:
+		cMappedFileImpl( const std::string& Filepath );
+
+		~cMappedFileImpl();
+
+		const Uint8 * GetData() const;
+
+		Uint64 GetSize() const;
+	private:
+		HANDLE	mFile;
+		HANDLE	mMapping;
+		Uint8 *	mData;
+		Uint64	mSize;
+};
+
+}}}
+
+#endif
+
+#endif
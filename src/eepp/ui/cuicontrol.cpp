@@ -44,6 +44,8 @@ cUIControl::cUIControl( const CreateParams& Params ) :
 }
 
 cUIControl::~cUIControl() {
+	Invalidate();
+
 	SafeDeleteSkinState();
 	eeSAFE_DELETE( mBackground );
 	eeSAFE_DELETE( mBorder );
@@ -119,13 +121,14 @@ bool cUIControl::IsInside( const eeVector2i& Pos ) const {
 }
 
 void cUIControl::Pos( const eeVector2i& Pos ) {
+	Invalidate();
 	mPos = Pos;
 	OnPosChange();
+	Invalidate();
 }
 
 void cUIControl::Pos( const Int32& x, const Int32& y ) {
-	mPos = eeVector2i( x, y );
-	OnPosChange();
+	Pos( eeVector2i( x, y ) );
 }
 
 const eeVector2i& cUIControl::Pos() const {
@@ -136,10 +139,14 @@ void cUIControl::Size( const eeSize& Size ) {
 	if ( Size != mSize ) {
 		eeVector2i sizeChange( Size.x - mSize.x, Size.y - mSize.y );
 
+		Invalidate();
+
 		mSize = Size;
 
 		OnSizeChange();
 
+		Invalidate();
+
 		if ( mFlags & UI_REPORT_SIZE_CHANGE_TO_CHILDS ) {
 			SendParentSizeChange( sizeChange );
 		}
@@ -159,6 +166,12 @@ const eeSize& cUIControl::Size() {
 }
 
 void cUIControl::Visible( const bool& visible ) {
+	if ( visible != mVisible ) {
+		// Invalidates while visible, so hiding the control redraws what it covered
+		mVisible = true;
+		Invalidate();
+	}
+
 	mVisible = visible;
 	OnVisibleChange();
 }
@@ -173,6 +186,7 @@ bool cUIControl::Hided() const {
 
 void cUIControl::Enabled( const bool& enabled ) {
 	mEnabled = enabled;
+	Invalidate();
 	OnEnabledChange();
 }
 
@@ -192,6 +206,8 @@ void cUIControl::Parent( cUIControl * parent ) {
 	if ( parent == mParentCtrl )
 		return;
 
+	Invalidate();
+
 	if ( NULL != mParentCtrl )
 		mParentCtrl->ChildRemove( this );
 
@@ -199,6 +215,8 @@ void cUIControl::Parent( cUIControl * parent ) {
 
 	if ( NULL != mParentCtrl )
 		mParentCtrl->ChildAdd( this );
+
+	Invalidate();
 }
 
 bool cUIControl::IsParentOf( cUIControl * Ctrl ) {
@@ -415,6 +433,7 @@ void cUIControl::VAlign( Uint32 valign ) {
 
 void cUIControl::FillBackground( bool enabled ) {
 	WriteFlag( UI_FILL_BACKGROUND, enabled ? 1 : 0 );
+	Invalidate();
 
 	if ( enabled && NULL == mBackground ) {
 		mBackground = eeNew( cUIBackground, () );
@@ -423,6 +442,7 @@ void cUIControl::FillBackground( bool enabled ) {
 
 void cUIControl::Border( bool enabled ) {
 	WriteFlag( UI_BORDER, enabled ? 1 : 0 );
+	Invalidate();
 
 	if ( enabled && NULL == mBorder ) {
 		mBorder = eeNew( cUIBorder, () );
@@ -466,6 +486,7 @@ void cUIControl::Flags( const Uint32& flags ) {
 
 void cUIControl::Blend( const EE_BLEND_MODE& blend ) {
 	mBlend = static_cast<Uint16> ( blend );
+	Invalidate();
 }
 
 EE_BLEND_MODE cUIControl::Blend() {
@@ -476,18 +497,21 @@ void cUIControl::ToFront() {
 	if ( NULL != mParentCtrl ) {
 		mParentCtrl->ChildRemove( this );
 		mParentCtrl->ChildAdd( this );
+		Invalidate();
 	}
 }
 
 void cUIControl::ToBack() {
 	if ( NULL != mParentCtrl ) {
 		mParentCtrl->ChildAddAt( this, 0 );
+		Invalidate();
 	}
 }
 
 void cUIControl::ToPos( const Uint32& Pos ) {
 	if ( NULL != mParentCtrl ) {
 		mParentCtrl->ChildAddAt( this, Pos );
+		Invalidate();
 	}
 }
 
@@ -964,6 +988,8 @@ void cUIControl::SetThemeControl( cUITheme * Theme, const std::string& ControlNa
 
 			mSkinState = eeNew( cUISkinState, ( tSkin ) );
 			mSkinState->SetState( InitialState );
+
+			Invalidate();
 		}
 	}
 }
@@ -981,6 +1007,8 @@ void cUIControl::SetSkin( const cUISkin& Skin ) {
 
 	mSkinState = eeNew( cUISkinState, ( SkinCopy ) );
 
+	Invalidate();
+
 	DoAfterSetTheme();
 }
 
@@ -991,6 +1019,8 @@ void cUIControl::SetSkinState( const Uint32& State ) {
 	if ( NULL != mSkinState ) {
 		mSkinState->SetState( State );
 
+		Invalidate();
+
 		OnStateChange();
 	}
 }
@@ -999,6 +1029,8 @@ void cUIControl::SetPrevSkinState() {
 	if ( NULL != mSkinState ) {
 		mSkinState->SetPrevState();
 
+		Invalidate();
+
 		OnStateChange();
 	}
 }
@@ -1061,6 +1093,35 @@ eeRecti cUIControl::GetScreenRect() {
 	return eeRecti( mScreenPos, mSize );
 }
 
+eeRecti cUIControl::GetScreenBounds() {
+	eePolygon2f Poly( eeAABB( (eeFloat)mScreenPos.x, (eeFloat)mScreenPos.y, (eeFloat)mScreenPos.x + mSize.Width(), (eeFloat)mScreenPos.y + mSize.Height() ) );
+	cUIControl * tCtrl = this;
+
+	// Applies the transformation of the control and its parents, the same way the controls are drawn
+	while ( NULL != tCtrl ) {
+		if ( tCtrl->IsAnimated() ) {
+			cUIControlAnim * tP = reinterpret_cast<cUIControlAnim *> ( tCtrl );
+			eeVector2f Center( (eeFloat)tCtrl->mScreenPos.x + (eeFloat)tCtrl->mSize.Width() * 0.5f, (eeFloat)tCtrl->mScreenPos.y + (eeFloat)tCtrl->mSize.Height() * 0.5f );
+
+			Poly.Scale( tP->Scale(), Center );
+			Poly.Rotate( tP->Angle(), Center );
+		}
+
+		tCtrl = tCtrl->Parent();
+	}
+
+	eeAABB Box( Poly.ToAABB() );
+
+	// One pixel more, the borders are drawn one pixel outside the control
+	return eeRecti( (Int32)eefloor( Box.Left ) - 1, (Int32)eefloor( Box.Top ) - 1, (Int32)eeceil( Box.Right ) + 1, (Int32)eeceil( Box.Bottom ) + 1 );
+}
+
+void cUIControl::Invalidate() {
+	if ( mVisible && cUIManager::instance()->PartialRedraw() ) {
+		cUIManager::instance()->Invalidate( GetScreenBounds() );
+	}
+}
+
 eeRecti cUIControl::MakePadding( bool PadLeft, bool PadRight, bool PadTop, bool PadBottom, bool SkipFlags ) {
 	eeRecti tPadding( 0, 0, 0, 0 );
 
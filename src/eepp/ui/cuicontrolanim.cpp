@@ -68,7 +68,9 @@ const eeFloat& cUIControlAnim::Angle() const {
 }
 
 void cUIControlAnim::Angle( const eeFloat& angle ) {
+	Invalidate();
 	mAngle = angle;
+	Invalidate();
 	OnAngleChange();
 }
 
@@ -77,7 +79,9 @@ const eeVector2f& cUIControlAnim::Scale() const {
 }
 
 void cUIControlAnim::Scale( const eeVector2f& scale ) {
+	Invalidate();
 	mScale = scale;
+	Invalidate();
 	OnScaleChange();
 }
 
@@ -91,6 +95,7 @@ const eeFloat& cUIControlAnim::Alpha() const {
 
 void cUIControlAnim::Alpha( const eeFloat& alpha ) {
 	mAlpha = alpha;
+	Invalidate();
 	OnAlphaChange();
 }
 
@@ -2,6 +2,9 @@
 #include <eepp/window/cengine.hpp>
 #include <eepp/window/ccursormanager.hpp>
 #include <eepp/graphics/cglobalbatchrenderer.hpp>
+#include <eepp/graphics/cframebuffer.hpp>
+#include <eepp/graphics/renderer/cgl.hpp>
+#include <eepp/system/cprofiler.hpp>
 #include <algorithm>
 
 namespace EE { namespace UI {
@@ -25,7 +28,10 @@ cUIManager::cUIManager() :
 	mFirstPress( false ),
 	mShootingDown( false ),
 	mControlDragging( false ),
-	mUseGlobalCursors( true )
+	mUseGlobalCursors( true ),
+	mPartialRedraw( false ),
+	mDirty( true ),
+	mCache( NULL )
 {
 }
 
@@ -69,6 +75,8 @@ void cUIManager::Init( Uint32 Flags, Window::cWindow * window ) {
 
 	mCbId = mKM->PushCallback( cb::Make1( this, &cUIManager::InputCallback ) );
 	mResizeCb = mWindow->PushResizeCallback( cb::Make1( this, &cUIManager::ResizeControl ) );
+
+	Invalidate();
 }
 
 void cUIManager::Shutdown() {
@@ -91,6 +99,8 @@ void cUIManager::Shutdown() {
 		mOverControl = NULL;
 		mFocusControl = NULL;
 
+		eeSAFE_DELETE( mCache );
+
 		mInit = false;
 	}
 
@@ -111,6 +121,11 @@ void cUIManager::InputCallback( InputEvent * Event ) {
 }
 
 void cUIManager::ResizeControl( cWindow * win ) {
+	// The cache is created again with the new window size
+	eeSAFE_DELETE( mCache );
+
+	Invalidate();
+
 	mControl->Size( mWindow->GetWidth(), mWindow->GetHeight() );
 	SendMsg( mControl, cUIMessage::MsgWindowResize );
 
@@ -159,6 +174,11 @@ void cUIManager::FocusControl( cUIControl * Ctrl ) {
 
 		mFocusControl = Ctrl;
 
+		if ( HighlightFocus() ) {
+			mLossFocusControl->Invalidate();
+			mFocusControl->Invalidate();
+		}
+
 		mLossFocusControl->OnFocusLoss();
 		SendMsg( mLossFocusControl, cUIMessage::MsgFocusLoss );
 
@@ -175,6 +195,54 @@ void cUIManager::OverControl( cUIControl * Ctrl ) {
 	mOverControl = Ctrl;
 }
 
+void cUIManager::PartialRedraw( const bool& enabled ) {
+	mPartialRedraw = enabled;
+
+	if ( !mPartialRedraw ) {
+		eeSAFE_DELETE( mCache );
+	}
+
+	Invalidate();
+}
+
+const bool& cUIManager::PartialRedraw() const {
+	return mPartialRedraw;
+}
+
+void cUIManager::Invalidate( const eeRecti& Rect ) {
+	if ( !mPartialRedraw || NULL == mWindow ) {
+		return;
+	}
+
+	eeRecti R( eemax( Rect.Left, 0 ), eemax( Rect.Top, 0 ), eemin( Rect.Right, (Int32)mWindow->GetWidth() ), eemin( Rect.Bottom, (Int32)mWindow->GetHeight() ) );
+
+	if ( R.Left >= R.Right || R.Top >= R.Bottom ) {
+		return;
+	}
+
+	if ( !mDirty ) {
+		mDirtyRect	= R;
+		mDirty		= true;
+	} else {
+		mDirtyRect	= eeRecti( eemin( mDirtyRect.Left, R.Left ), eemin( mDirtyRect.Top, R.Top ), eemax( mDirtyRect.Right, R.Right ), eemax( mDirtyRect.Bottom, R.Bottom ) );
+	}
+}
+
+void cUIManager::Invalidate() {
+	if ( NULL != mWindow ) {
+		mDirtyRect	= eeRecti( 0, 0, mWindow->GetWidth(), mWindow->GetHeight() );
+		mDirty		= true;
+	}
+}
+
+bool cUIManager::IsDirty() const {
+	return !mPartialRedraw || mDirty;
+}
+
+const eeRecti& cUIManager::GetDirtyRect() const {
+	return mDirtyRect;
+}
+
 void cUIManager::SendMsg( cUIControl * Ctrl, const Uint32& Msg, const Uint32& Flags ) {
 	cUIMessage tMsg( Ctrl, Msg, Flags );
 
@@ -182,6 +250,8 @@ void cUIManager::SendMsg( cUIControl * Ctrl, const Uint32& Msg, const Uint32& Fl
 }
 
 void cUIManager::Update() {
+	eePROFILE_ZONE( "UI Update" );
+
 	mElapsed = mWindow->Elapsed();
 
 	bool wasDraggingControl = IsControlDragging();
@@ -196,8 +266,16 @@ void cUIManager::Update() {
 			mOverControl->OnMouseExit( mKM->GetMousePos(), 0 );
 		}
 
+		if ( HighlightOver() && NULL != mOverControl ) {
+			mOverControl->Invalidate();
+		}
+
 		mOverControl = pOver;
 
+		if ( HighlightOver() && NULL != mOverControl ) {
+			mOverControl->Invalidate();
+		}
+
 		if ( NULL != mOverControl ) {
 			SendMsg( mOverControl, cUIMessage::MsgMouseEnter );
 			mOverControl->OnMouseEnter( mKM->GetMousePos(), 0 );
@@ -256,11 +334,63 @@ cUIControl * cUIManager::DownControl() const {
 }
 
 void cUIManager::Draw() {
+	eePROFILE_ZONE( "UI Draw" );
+
+	if ( mPartialRedraw ) {
+		DrawCache();
+		return;
+	}
+
 	cGlobalBatchRenderer::instance()->Draw();
 	mControl->InternalDraw();
 	cGlobalBatchRenderer::instance()->Draw();
 }
 
+void cUIManager::DrawCache() {
+	if ( NULL == mCache ) {
+		mCache = cFrameBuffer::New( mWindow->GetWidth(), mWindow->GetHeight(), false, mWindow );
+
+		Invalidate();
+	}
+
+	cGlobalBatchRenderer::instance()->Draw();
+
+	// Without frame buffers the UI is redrawn completely, but the frames without changes can still be skipped
+	if ( NULL == mCache ) {
+		mControl->InternalDraw();
+		cGlobalBatchRenderer::instance()->Draw();
+		mDirty = false;
+		return;
+	}
+
+	if ( mDirty ) {
+		eeColor BackColor( mWindow->BackColor() );
+
+		mCache->ClearColor( eeColorAf( BackColor.R() / 255.f, BackColor.G() / 255.f, BackColor.B() / 255.f, 1.f ) );
+		mCache->Bind();
+
+		// The frame buffer projection isn't flipped, so the scissor box uses the screen coordinates
+		GLi->Scissor( mDirtyRect.Left, mDirtyRect.Top, mDirtyRect.Right - mDirtyRect.Left, mDirtyRect.Bottom - mDirtyRect.Top );
+		GLi->Enable( GL_SCISSOR_TEST );
+
+		mCache->Clear();
+
+		mControl->InternalDraw();
+
+		cGlobalBatchRenderer::instance()->Draw();
+
+		GLi->Disable( GL_SCISSOR_TEST );
+
+		mCache->Unbind();
+
+		mDirty = false;
+	}
+
+	mCache->GetTexture()->Draw( 0.f, 0.f, 0.f, eeVector2f::One, eeColorA( 255, 255, 255, 255 ), ALPHA_NONE );
+
+	cGlobalBatchRenderer::instance()->Draw();
+}
+
 cUIWindow * cUIManager::MainControl() const {
 	return mControl;
 }
@@ -51,6 +51,15 @@ void cUIProgressBar::Draw() {
 	}
 }
 
+void cUIProgressBar::Update() {
+	// The filler moves every frame
+	if ( mVisible && NULL != mParallax && ( 0.f != mSpeed.x || 0.f != mSpeed.y ) ) {
+		Invalidate();
+	}
+
+	cUIComplexControl::Update();
+}
+
 void cUIProgressBar::SetTheme( cUITheme * Theme ) {
 	cUIControl::SetThemeControl( Theme, "progressbar" );
 
@@ -107,6 +116,7 @@ void cUIProgressBar::Progress( eeFloat Val ) {
 	mProgress = Val;
 
 	OnValueChange();
+	Invalidate();
 	UpdateTextBox();
 }
 
@@ -118,6 +128,7 @@ void cUIProgressBar::TotalSteps( const eeFloat& Steps ) {
 	mTotalSteps = Steps;
 
 	OnSizeChange();
+	Invalidate();
 	UpdateTextBox();
 }
 
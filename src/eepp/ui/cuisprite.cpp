@@ -58,6 +58,15 @@ void cUISprite::Draw() {
 	}
 }
 
+void cUISprite::Update() {
+	// The animated sprites change its frame while drawing
+	if ( mVisible && NULL != mSprite && mSprite->GetNumFrames() > 1 && !mSprite->AnimPaused() ) {
+		Invalidate();
+	}
+
+	cUIComplexControl::Update();
+}
+
 void cUISprite::CheckSubTextureUpdate() {
 	if ( NULL != mSprite && NULL != mSprite->GetCurrentSubTexture() && mSprite->GetCurrentSubTexture() != mSubTextureLast ) {
 		UpdateSize();
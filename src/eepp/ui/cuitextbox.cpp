@@ -102,6 +102,7 @@ void cUITextBox::Text( const String& text ) {
 	AutoShrink();
 	AutoSize();
 	AutoAlign();
+	Invalidate();
 	OnTextChanged();
 }
 
@@ -112,6 +113,7 @@ const eeColorA& cUITextBox::Color() const {
 void cUITextBox::Color( const eeColorA& color ) {
 	mFontColor = color;
 	mTextCache->Color( color );
+	Invalidate();
 
 	Alpha( color.A() );
 }
@@ -123,6 +125,7 @@ const eeColorA& cUITextBox::ShadowColor() const {
 void cUITextBox::ShadowColor( const eeColorA& color ) {
 	mFontShadowColor = color;
 	mTextCache->ShadowColor( mFontColor );
+	Invalidate();
 }
 
 const eeColorA& cUITextBox::SelectionBackColor() const {
@@ -42,6 +42,18 @@ void cUITextInput::Update() {
 
 	cUITextBox::Update();
 
+	// The cursor blinks here instead of while drawing, since the drawing can be skipped when nothing changed
+	if ( mVisible && mTextBuffer.Active() && mTextBuffer.SupportFreeEditing() ) {
+		mWaitCursorTime += cUIManager::instance()->Elapsed().AsMilliseconds();
+
+		if ( mWaitCursorTime >= 500.f ) {
+			mShowingWait = !mShowingWait;
+			mWaitCursorTime = 0.f;
+
+			Invalidate();
+		}
+	}
+
 	if ( mTextBuffer.ChangedSinceLastUpdate() ) {
 		eeVector2f offSet = mAlignOffset;
 
@@ -63,6 +75,7 @@ void cUITextInput::Update() {
 	}
 
 	if ( mCursorPos != mTextBuffer.CurPos() ) {
+		Invalidate();
 		AlignFix();
 		mCursorPos = mTextBuffer.CurPos();
 		OnCursorPosChange();
@@ -75,8 +88,6 @@ void cUITextInput::OnCursorPosChange() {
 
 void cUITextInput::DrawWaitingCursor() {
 	if ( mVisible && mTextBuffer.Active() && mTextBuffer.SupportFreeEditing() ) {
-		mWaitCursorTime += cUIManager::instance()->Elapsed().AsMilliseconds();
-
 		if ( mShowingWait ) {
 			bool disableSmooth = mShowingWait && GLi->IsLineSmooth();
 
@@ -97,11 +108,6 @@ void cUITextInput::DrawWaitingCursor() {
 			if ( disableSmooth )
 				GLi->LineSmooth( true );
 		}
-
-		if ( mWaitCursorTime >= 500.f ) {
-			mShowingWait = !mShowingWait;
-			mWaitCursorTime = 0.f;
-		}
 	}
 }
 
@@ -144,6 +150,7 @@ void cUITextInput::PushIgnoredChar( const Uint32& ch ) {
 void cUITextInput::ResetWaitCursor() {
 	mShowingWait = true;
 	mWaitCursorTime = 0.f;
+	Invalidate();
 }
 
 void cUITextInput::AlignFix() {
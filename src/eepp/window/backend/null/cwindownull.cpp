@@ -2,6 +2,7 @@
 #include <eepp/window/backend/null/cclipboardnull.hpp>
 #include <eepp/window/backend/null/cinputnull.hpp>
 #include <eepp/window/backend/null/ccursormanagernull.hpp>
+#include <eepp/graphics/renderer/crenderernull.hpp>
 
 namespace EE { namespace Window { namespace Backend { namespace Null {
 
@@ -15,7 +16,22 @@ cWindowNull::~cWindowNull() {
 }
 
 bool cWindowNull::Create( WindowSettings Settings, ContextSettings Context ) {
-	return false;
+	if ( NULL == cGL::ExistsSingleton() ) {
+		cGL::CreateSingleton( GLv_NULL );
+		cGL::instance()->Init();
+	}
+
+	if ( GLv_NULL != GLi->Version() ) {
+		return false;
+	}
+
+	CreateView();
+
+	Setup2D();
+
+	mWindow.Created = true;
+
+	return true;
 }
 
 void cWindowNull::ToggleFullscreen() {
@@ -66,6 +82,9 @@ void cWindowNull::Size( Uint32 Width, Uint32 Height, bool Windowed ) {
 }
 
 void cWindowNull::SwapBuffers() {
+	if ( NULL != GLi && GLv_NULL == GLi->Version() ) {
+		GLi->GetRendererNull()->EndFrame();
+	}
 }
 
 std::vector<DisplayMode> cWindowNull::GetDisplayModes() const {
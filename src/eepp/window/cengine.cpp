@@ -2,12 +2,17 @@
 #include <eepp/system/cpackmanager.hpp>
 #include <eepp/system/cinifile.hpp>
 #include <eepp/graphics/ctexturefactory.hpp>
+#include <eepp/graphics/ctexturecache.hpp>
+#include <eepp/graphics/cimagesaver.hpp>
 #include <eepp/graphics/cfontmanager.hpp>
 #include <eepp/graphics/cglobalbatchrenderer.hpp>
 #include <eepp/graphics/cshaderprogrammanager.hpp>
 #include <eepp/graphics/ctextureatlasmanager.hpp>
 #include <eepp/graphics/cframebuffermanager.hpp>
 #include <eepp/graphics/cvertexbuffermanager.hpp>
+#include <eepp/graphics/cquadindexbuffer.hpp>
+#include <eepp/graphics/cgputimer.hpp>
+#include <eepp/system/cprofiler.hpp>
 #include <eepp/ui/cuimanager.hpp>
 #include <eepp/audio/caudiolistener.hpp>
 #include <eepp/graphics/renderer/cgl.hpp>
@@ -57,8 +62,16 @@ cEngine::~cEngine() {
 
 	cGlobalBatchRenderer::DestroySingleton();
 
+	Graphics::Private::cQuadIndexBuffer::DestroySingleton();
+
+	Graphics::Private::cGpuTimer::DestroySingleton();
+
 	cTextureFactory::DestroySingleton();
 
+	cTextureCache::DestroySingleton();
+
+	cImageSaver::DestroySingleton();
+
 	cTextureAtlasManager::DestroySingleton();
 
 	cFontManager::DestroySingleton();
@@ -71,6 +84,8 @@ cEngine::~cEngine() {
 
 	cPackManager::DestroySingleton();
 
+	cProfiler::DestroySingleton();
+
 	cLog::DestroySingleton();
 
 	HaikuTTF::hkFontManager::DestroySingleton();
@@ -9,11 +9,14 @@
 #include <eepp/graphics/renderer/cgl.hpp>
 #include <eepp/graphics/ctexturefactory.hpp>
 #include <eepp/graphics/cglobalbatchrenderer.hpp>
+#include <eepp/graphics/cimage.hpp>
+#include <eepp/graphics/cimagesaver.hpp>
+#include <eepp/graphics/cgputimer.hpp>
 
 #include <eepp/system/filesystem.hpp>
+#include <eepp/system/cprofiler.hpp>
 #include <eepp/version.hpp>
 
-#include <eepp/helper/SOIL2/src/SOIL2/SOIL2.h>
 
 #ifdef EE_GLEW_AVAILABLE
 	#if EE_PLATFORM == EE_PLATFORM_WIN
@@ -49,12 +52,16 @@ namespace EE { namespace Window {
 
 cWindow::cFrameData::cFrameData() :
 	FrameElapsed(NULL),
-	ElapsedTime()
+	PacingClock(NULL),
+	ElapsedTime(),
+	FrameTimesCount(0),
+	FrameTimesIndex(0)
 {}
 
 cWindow::cFrameData::~cFrameData()
 {
 	eeSAFE_DELETE( FrameElapsed );
+	eeSAFE_DELETE( PacingClock );
 }
 
 cWindow::cWindow( WindowSettings Settings, ContextSettings Context, cClipboard * Clipboard, cInput * Input, cCursorManager * CursorManager ) :
@@ -142,8 +149,13 @@ void cWindow::CreateView() {
 }
 
 void cWindow::Setup2D( const bool& KeepView ) {
-	glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
-	glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+	// The context could be new, so nothing of the shadowed GL state can be trusted
+	GLi->InvalidateStateCache();
+
+	if ( GLv_NULL != GLi->Version() ) {
+		glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+		glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+	}
 
 	BackColor( mWindow.BackgroundColor );
 
@@ -191,7 +203,7 @@ const eeColor& cWindow::BackColor() const {
 	return mWindow.BackgroundColor;
 }
 
-bool cWindow::TakeScreenshot( std::string filepath, const EE_SAVE_TYPE& Format ) {
+bool cWindow::TakeScreenshot( std::string filepath, const EE_SAVE_TYPE& Format, const bool& Async ) {
 	cGlobalBatchRenderer::instance()->Draw();
 
 	bool CreateNewFile = false;
@@ -230,17 +242,43 @@ bool cWindow::TakeScreenshot( std::string filepath, const EE_SAVE_TYPE& Format )
 				return false;
 		}
 
-		return 0 != SOIL_save_screenshot(TmpPath.c_str(), Format, 0, 0, mWindow.WindowConfig.Width, mWindow.WindowConfig.Height );
+		return SaveScreenshot( TmpPath, Format, Async );
 	} else {
 		std::string Direc = FileSystem::FileRemoveFileName( filepath );
 
 		if ( !FileSystem::IsDirectory( Direc ) )
 			FileSystem::MakeDir( Direc );
 
-		return 0 != SOIL_save_screenshot(filepath.c_str(), Format, 0, 0, mWindow.WindowConfig.Width, mWindow.WindowConfig.Height );
+		return SaveScreenshot( filepath, Format, Async );
 	}
 }
 
+bool cWindow::SaveScreenshot( const std::string& filepath, const EE_SAVE_TYPE& Format, const bool& Async ) {
+	Uint32 Width	= mWindow.WindowConfig.Width;
+	Uint32 Height	= mWindow.WindowConfig.Height;
+
+	cImage * Img = eeNew( cImage, ( Width, Height, (Uint32)3, eeColorA(0,0,0,0), false ) );
+
+	glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+	glReadPixels( 0, 0, Width, Height, GL_RGB, GL_UNSIGNED_BYTE, Img->GetPixels() );
+	glPixelStorei( GL_PACK_ALIGNMENT, 4 );
+
+	// The front buffer rows go from bottom to top
+	Img->FlipVertical();
+
+	if ( Async ) {
+		cImageSaver::instance()->Save( Img, filepath, Format );
+
+		return true;
+	}
+
+	bool Res = Img->SaveToFile( filepath, Format );
+
+	eeSAFE_DELETE( Img );
+
+	return Res;
+}
+
 bool cWindow::Running() const {
 	return mWindow.Created;
 }
@@ -275,6 +313,42 @@ void cWindow::GetElapsedTime() {
 	}
 
 	mFrameData.ElapsedTime = mFrameData.FrameElapsed->Elapsed();
+
+	mFrameData.FrameTimes[ mFrameData.FrameTimesIndex ] = mFrameData.ElapsedTime.AsMilliseconds();
+	mFrameData.FrameTimesIndex = ( mFrameData.FrameTimesIndex + 1 ) % cFrameData::FRAME_TIMES_COUNT;
+	mFrameData.FrameTimesCount = eemin( mFrameData.FrameTimesCount + 1, (Uint32)cFrameData::FRAME_TIMES_COUNT );
+}
+
+FrameTimeStats cWindow::GetFrameTimeStats() const {
+	FrameTimeStats Stats;
+
+	if ( 0 == mFrameData.FrameTimesCount )
+		return Stats;
+
+	Stats.Samples	= mFrameData.FrameTimesCount;
+	Stats.Min		= mFrameData.FrameTimes[0];
+	Stats.Max		= mFrameData.FrameTimes[0];
+
+	for ( Uint32 i = 0; i < Stats.Samples; i++ ) {
+		eeDouble t = mFrameData.FrameTimes[i];
+
+		Stats.Average	+= t;
+		Stats.Min		= eemin( Stats.Min, t );
+		Stats.Max		= eemax( Stats.Max, t );
+	}
+
+	Stats.Average /= Stats.Samples;
+
+	for ( Uint32 i = 0; i < Stats.Samples; i++ ) {
+		eeDouble d = mFrameData.FrameTimes[i] - Stats.Average;
+
+		Stats.Variance += d * d;
+	}
+
+	Stats.Variance		/= Stats.Samples;
+	Stats.StdDeviation	= eesqrt( Stats.Variance );
+
+	return Stats;
 }
 
 void cWindow::CalculateFps() {
@@ -288,25 +362,56 @@ void cWindow::CalculateFps() {
 }
 
 void cWindow::LimitFps() {
-	if ( mFrameData.FPS.Limit > 0 ) {
-		mFrameData.FPS.Error = 0;
-		eeDouble RemainT = 1000.0 / mFrameData.FPS.Limit - ( mFrameData.ElapsedTime.AsMilliseconds() * 0.1f );
+	if ( NULL == mFrameData.PacingClock ) {
+		mFrameData.PacingClock = eeNew( cClock, () );
 
-		if ( RemainT < 0 ) {
-			mFrameData.FPS.Error = 0;
-		} else {
-			mFrameData.FPS.Error += 1000 % (Int32)mFrameData.FPS.Limit;
+		#if EE_PLATFORM == EE_PLATFORM_WIN
+		mFrameData.FPS.SleepMargin = 2000;
+		#else
+		mFrameData.FPS.SleepMargin = 1000;
+		#endif
+	}
+
+	Int64 Now = mFrameData.PacingClock->GetElapsedTime().AsMicroseconds();
+
+	if ( mFrameData.FPS.Limit <= 0 ) {
+		mFrameData.FPS.Deadline = Now;
+		return;
+	}
+
+	Int64 FrameTime	= (Int64)( 1000000.0 / mFrameData.FPS.Limit );
+	Int64 Deadline	= mFrameData.FPS.Deadline + FrameTime;
+
+	if ( Now - Deadline > FrameTime ) {
+		// More than a frame late ( a hitch, or the limit was just enabled ), start a new grid instead of rushing the next frames
+		mFrameData.FPS.Deadline = Now;
+		return;
+	}
+
+	Int64 Remain = Deadline - Now;
+
+	if ( Remain > mFrameData.FPS.SleepMargin ) {
+		Int64 SleepTime = Remain - mFrameData.FPS.SleepMargin;
 
-			if ( mFrameData.FPS.Error > (Int32)mFrameData.FPS.Limit ) {
-				++RemainT;
-				mFrameData.FPS.Error -= (Int32)mFrameData.FPS.Limit;
-			}
+		Sys::Sleep( Microseconds( SleepTime ) );
 
-			if ( RemainT > 0 ) {
-				Sys::Sleep( (Uint32) RemainT );
-			}
+		Int64 Slept		= mFrameData.PacingClock->GetElapsedTime().AsMicroseconds() - Now;
+		Int64 Overshoot	= Slept - SleepTime;
+
+		// Grow the margin to the worst overshoot seen, and shrink it slowly when the sleeps are accurate
+		if ( Overshoot > mFrameData.FPS.SleepMargin ) {
+			mFrameData.FPS.SleepMargin = Overshoot;
+		} else {
+			mFrameData.FPS.SleepMargin -= ( mFrameData.FPS.SleepMargin - eemax( Overshoot, (Int64)0 ) ) / 32;
 		}
+
+		mFrameData.FPS.SleepMargin = eemin( eemax( mFrameData.FPS.SleepMargin, (Int64)200 ), FrameTime / 2 );
 	}
+
+	// Spin the remaining time
+	while ( mFrameData.PacingClock->GetElapsedTime().AsMicroseconds() < Deadline );
+
+	mFrameData.FPS.Deadline = Deadline;
 }
 
 void cWindow::ViewCheckUpdate() {
@@ -325,18 +430,32 @@ void cWindow::Display( bool clear ) {
 	if ( mCurrentView->NeedUpdate() )
 		SetView( *mCurrentView );
 
+	if ( NULL != Graphics::Private::cGpuTimer::ExistsSingleton() )
+		Graphics::Private::cGpuTimer::instance()->FrameEnd();
+
 	SwapBuffers();
 
+	// The loader threads can't reset the state shadow of the main thread context by themselves
+	GLi->UpdateStateCache();
+
 	#if EE_PLATFORM != EE_PLATFORM_EMSCRIPTEN
 	if ( clear )
 		Clear();
 	#endif
 
+	LimitFps();
+
 	GetElapsedTime();
 
 	CalculateFps();
 
-	LimitFps();
+	cProfiler * Profiler = cProfiler::ExistsSingleton();
+
+	if ( NULL != Profiler && Profiler->Enabled() ) {
+		Profiler->FrameMark();
+
+		Graphics::Private::cGpuTimer::instance()->FrameMark( Profiler->FrameNumber() );
+	}
 }
 
 void cWindow::ClipEnable( const Int32& x, const Int32& y, const Uint32& Width, const Uint32& Height ) {
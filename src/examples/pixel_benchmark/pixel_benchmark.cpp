@@ -0,0 +1,154 @@
+#include <eepp/ee.hpp>
+
+// Size of the images used in the benchmark ( in pixels )
+static const Uint32 ImageSize	= 2048;
+
+// Number of times that every operation is repeated
+static const Uint32 Iterations	= 10;
+
+/// Prints the average time and the pixels per second of an operation
+void PrintResult( const std::string& Name, const cTime& Time ) {
+	eeDouble Ms			= Time.AsMilliseconds() / (eeDouble)Iterations;
+	eeDouble MPixels	= ( (eeDouble)ImageSize * (eeDouble)ImageSize ) / ( Ms * 1000.0 );
+
+	std::cout << Name;
+
+	for ( Uint32 i = Name.size(); i < 40; i++ ) {
+		std::cout << " ";
+	}
+
+	std::cout << Ms << " ms\t" << MPixels << " MPixels/s" << std::endl;
+}
+
+/// Creates an image filled with a pattern of colors, one of every 8 pixels has the color key
+cImage * CreateImage( const Uint32& Channels, const eeColorA& ColorKey ) {
+	cImage * Img = eeNew( cImage, ( ImageSize, ImageSize, Channels ) );
+	Uint8 * Pixels = Img->GetPixels();
+	Uint8 Key[4] = { ColorKey.R(), ColorKey.G(), ColorKey.B(), ColorKey.A() };
+
+	for ( Uint32 i = 0; i < ImageSize * ImageSize; i++ ) {
+		for ( Uint32 c = 0; c < Channels; c++ ) {
+			Pixels[ i * Channels + c ] = ( 0 == i % 8 ) ? Key[c] : (Uint8)( i * 7 + c * 53 );
+		}
+	}
+
+	// Some transparent and some opaque areas, like the sprites
+	if ( 4 == Channels ) {
+		for ( Uint32 i = 0; i < ImageSize * ImageSize; i++ ) {
+			Uint32 Area = ( i / 64 ) % 3;
+
+			Pixels[ i * 4 + 3 ] = 0 == Area ? 0 : ( 1 == Area ? 255 : Pixels[ i * 4 + 3 ] );
+		}
+	}
+
+	return Img;
+}
+
+EE_MAIN_FUNC int main (int argc, char * argv []) {
+	{
+		eeColorA ColorKey( 255, 0, 255, 255 );
+		cClock Clock;
+		Uint32 i;
+
+		std::cout << "Image size: " << ImageSize << "x" << ImageSize << ", " << Iterations << " iterations per operation" << std::endl;
+
+		// The color key pass of cTextureLoader
+		for ( Uint32 Channels = 1; Channels <= 4; Channels++ ) {
+			cImage * Img = CreateImage( Channels, ColorKey );
+
+			Clock.Restart();
+
+			for ( i = 0; i < Iterations; i++ ) {
+				Img->ReplaceColor( ColorKey, eeColorA( 0, 0, 0, 0 ) );
+				Img->ReplaceColor( eeColorA( 0, 0, 0, 0 ), ColorKey );
+			}
+
+			PrintResult( "ReplaceColor ( " + String::ToStr( Channels ) + " channels, x2 )", Clock.Elapsed() );
+
+			eeSAFE_DELETE( Img );
+		}
+
+		cImage * Rgba	= CreateImage( 4, ColorKey );
+		cImage * Rgb	= CreateImage( 3, ColorKey );
+		cImage * Page	= eeNew( cImage, ( ImageSize, ImageSize, 4 ) );
+
+		Clock.Restart();
+
+		for ( i = 0; i < Iterations; i++ )
+			Rgba->CreateMaskFromColor( ColorKey, 0 );
+
+		PrintResult( "CreateMaskFromColor ( RGBA )", Clock.Elapsed() );
+
+		Clock.Restart();
+
+		for ( i = 0; i < Iterations; i++ )
+			Page->FillWithColor( eeColorA( 0, 0, 0, 0 ) );
+
+		PrintResult( "FillWithColor ( RGBA )", Clock.Elapsed() );
+
+		// The atlas compositing of cTexturePacker
+		Clock.Restart();
+
+		for ( i = 0; i < Iterations; i++ )
+			Page->CopyImage( Rgba, 0, 0 );
+
+		PrintResult( "CopyImage ( RGBA to RGBA )", Clock.Elapsed() );
+
+		Clock.Restart();
+
+		for ( i = 0; i < Iterations; i++ )
+			Page->CopyImage( Rgb, 0, 0 );
+
+		PrintResult( "CopyImage ( RGB to RGBA )", Clock.Elapsed() );
+
+		Clock.Restart();
+
+		for ( i = 0; i < Iterations; i++ )
+			Page->Blit( Rgba, 0, 0 );
+
+		PrintResult( "Blit ( RGBA )", Clock.Elapsed() );
+
+		Clock.Restart();
+
+		for ( i = 0; i < Iterations; i++ )
+			Page->Flip();
+
+		PrintResult( "Flip ( RGBA )", Clock.Elapsed() );
+
+		Clock.Restart();
+
+		for ( i = 0; i < Iterations; i++ )
+			Page->FlipVertical();
+
+		PrintResult( "FlipVertical ( RGBA )", Clock.Elapsed() );
+
+		Clock.Restart();
+
+		for ( i = 0; i < Iterations; i++ )
+			Rgb->FlipVertical();
+
+		PrintResult( "FlipVertical ( RGB )", Clock.Elapsed() );
+
+		Clock.Restart();
+
+		for ( i = 0; i < Iterations; i++ )
+			Page->SwizzleChannels( 2, 1, 0, 3 );
+
+		PrintResult( "SwizzleChannels ( RGBA to BGRA )", Clock.Elapsed() );
+
+		Clock.Restart();
+
+		for ( i = 0; i < Iterations; i++ )
+			Rgba->PremultiplyAlpha();
+
+		PrintResult( "PremultiplyAlpha ( RGBA )", Clock.Elapsed() );
+
+		eeSAFE_DELETE( Rgba );
+		eeSAFE_DELETE( Rgb );
+		eeSAFE_DELETE( Page );
+	}
+
+	MemoryManager::ShowResults();
+
+	return EXIT_SUCCESS;
+}
@@ -14,6 +14,109 @@ cBatchRenderer * Batch = eeNew( cBatchRenderer, () );
 eeFloat ang = 0, scale = 1;
 bool side = false;
 
+// Renders many small batches and returns the average milliseconds per frame.
+// Every few quads the blend mode changes, forcing a flush, so the cost of submitting the vertexs dominates.
+eeDouble BenchmarkBatchUpload( cBatchRenderer * BR, bool Streaming, Uint32 Frames ) {
+	BR->BatchStreaming( Streaming );
+
+	cClock Clock;
+
+	for ( Uint32 f = 0; f < Frames; f++ ) {
+		win->Clear();
+
+		BR->QuadsBegin();
+
+		for ( Uint32 i = 0; i < 4096; i++ ) {
+			if ( 0 == i % 64 ) {
+				BR->SetBlendMode( ( i / 64 ) % 2 ? ALPHA_BLENDONE : ALPHA_NORMAL );
+			}
+
+			eeFloat x = (eeFloat)( i % 64 ) * 16.f;
+			eeFloat y = (eeFloat)( i / 64 ) * 12.f;
+
+			BR->QuadsSetColor( eeColorA( i % 255, 255 - i % 255, 255, 100 ) );
+			BR->BatchQuad( x, y, 14.f, 10.f );
+		}
+
+		BR->Draw();
+
+		win->Display();
+	}
+
+	// Wait the GPU to finish the work, so the measure includes it
+	glFinish();
+
+	return Clock.Elapsed().AsMilliseconds() / (eeDouble)Frames;
+}
+
+void RunBenchmark() {
+	cBatchRenderer * BR = cGlobalBatchRenderer::instance();
+	bool WasStreaming = BR->BatchStreaming();
+	Uint32 Frames = 120;
+
+	// Warm up both paths before measuring
+	BenchmarkBatchUpload( BR, false, 10 );
+	BenchmarkBatchUpload( BR, true, 10 );
+
+	eeDouble ClientArrays	= BenchmarkBatchUpload( BR, false, Frames );
+	eeDouble Streaming		= BenchmarkBatchUpload( BR, true, Frames );
+	bool StreamingActive	= BR->StreamingActive();
+
+	BR->BatchStreaming( WasStreaming );
+
+	eePRINTL( "Batch upload benchmark ( %d frames, 4096 quads and 64 flushes per frame ):", Frames );
+	eePRINTL( "	client arrays: %4.3f ms per frame", ClientArrays );
+	eePRINTL( "	streaming vbo: %4.3f ms per frame%s", Streaming, StreamingActive ? "" : " ( not supported, fell back to client arrays )" );
+}
+
+// Renders a textured batch with the given vertex layout and returns the vertexs submitted per millisecond.
+eeDouble BenchmarkVertexFormat( cBatchRenderer * BR, EE_BATCH_VERTEX_FORMAT Format, cTexture * Tex, Uint32 Frames ) {
+	BR->BatchVertexFormat( Format );
+
+	cClock Clock;
+
+	for ( Uint32 f = 0; f < Frames; f++ ) {
+		win->Clear();
+
+		BR->SetTexture( Tex );
+		BR->QuadsBegin();
+		BR->QuadsSetColor( eeColorA( 255, 255, 255, 100 ) );
+
+		for ( Uint32 i = 0; i < 8192; i++ ) {
+			BR->BatchQuad( (eeFloat)( i % 128 ) * 8.f, (eeFloat)( i / 128 ) * 8.f, 8.f, 8.f );
+		}
+
+		BR->Draw();
+
+		win->Display();
+	}
+
+	glFinish();
+
+	eeDouble Ms = Clock.Elapsed().AsMilliseconds();
+
+	return ( Frames * 8192 * 4 ) / ( Ms > 0 ? Ms : 1 );
+}
+
+void RunVertexFormatBenchmark() {
+	cBatchRenderer * BR = cGlobalBatchRenderer::instance();
+	EE_BATCH_VERTEX_FORMAT WasFormat = BR->BatchVertexFormat();
+	Uint32 Frames = 120;
+
+	BenchmarkVertexFormat( BR, BVF_FLOAT, FBO->GetTexture(), 10 );
+	BenchmarkVertexFormat( BR, BVF_PACKED, FBO->GetTexture(), 10 );
+
+	eeDouble Float		= BenchmarkVertexFormat( BR, BVF_FLOAT, FBO->GetTexture(), Frames );
+	eeDouble Packed		= BenchmarkVertexFormat( BR, BVF_PACKED, FBO->GetTexture(), Frames );
+	bool PackedActive	= BR->PackedActive();
+
+	BR->BatchVertexFormat( WasFormat );
+
+	eePRINTL( "Batch vertex format benchmark ( %d frames, 8192 textured quads per frame ):", Frames );
+	eePRINTL( "	float  ( %d bytes ): %4.1f vertexs per ms", (Int32)sizeof(eeVertex), Float );
+	eePRINTL( "	packed ( %d bytes ): %4.1f vertexs per ms%s", (Int32)sizeof(eeVertexPacked), Packed, PackedActive ? "" : " ( not supported by the renderer, fell back to float )" );
+}
+
 void MainLoop()
 {
 	// Clear the screen buffer
@@ -28,6 +131,16 @@ void MainLoop()
 		win->Close();
 	}
 
+	// Compare the client arrays and the streaming vertex buffer upload paths of the batch renderer
+	if ( win->GetInput()->IsKeyUp( KEY_B ) ) {
+		RunBenchmark();
+	}
+
+	// Compare the float and the packed vertex layouts of the batch renderer
+	if ( win->GetInput()->IsKeyUp( KEY_V ) ) {
+		RunVertexFormatBenchmark();
+	}
+
 	// Bind the Frame Buffer, everything rendered from here will be rendered in the frame buffer
 	FBO->Bind();
 	{